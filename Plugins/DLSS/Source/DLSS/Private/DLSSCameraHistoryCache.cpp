@@ -0,0 +1,281 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "DLSSCameraHistoryCache.h"
+
+#include "HAL/IConsoleManager.h"
+#include "RenderingThread.h"
+#include "SceneView.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDLSSCameraHistory, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("DLSS Camera History"), STATGROUP_DLSSCameraHistory, STATCAT_Advanced);
+DECLARE_MEMORY_STAT(TEXT("Retained Histories (estimated)"), STAT_DLSSCameraHistoryMemory, STATGROUP_DLSSCameraHistory);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Retained Histories"), STAT_DLSSCameraHistoryNumHistories, STATGROUP_DLSSCameraHistory);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Restored Histories"), STAT_DLSSCameraHistoryRestored, STATGROUP_DLSSCameraHistory);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Reset Histories (camera moved)"), STAT_DLSSCameraHistoryMoved, STATGROUP_DLSSCameraHistory);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Evicted Histories"), STAT_DLSSCameraHistoryEvicted, STATGROUP_DLSSCameraHistory);
+
+static TAutoConsoleVariable<int32> CVarNGXDLSSCameraHistoryMaxHistories(
+	TEXT("r.NGX.DLSS.CameraHistory.MaxHistories"),
+	4,
+	TEXT("Maximum number of DLSS histories, including the ones in use, that are retained for views with a camera id set via the 'Set DLSS Camera History Id' Blueprint function.\n")
+	TEXT("Each one keeps an NGX feature alive. 0 disables retaining histories across camera cuts (default = 4)\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarNGXDLSSCameraHistoryBudgetMB(
+	TEXT("r.NGX.DLSS.CameraHistory.BudgetMB"),
+	1024,
+	TEXT("Estimated video memory in MB that the retained DLSS camera histories may use before the least recently used ones get released (default = 1024)\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarNGXDLSSCameraHistoryMaxRestoreTranslation(
+	TEXT("r.NGX.DLSS.CameraHistory.MaxRestoreTranslation"),
+	1.0f,
+	TEXT("Maximum distance in cm a camera may have moved since its DLSS history was retained for that history to be continued on a cut back to it.\n")
+	TEXT("The history of a camera that moved further gets reset, since nothing reprojects it to the new camera position (default = 1)\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarNGXDLSSCameraHistoryMaxRestoreRotation(
+	TEXT("r.NGX.DLSS.CameraHistory.MaxRestoreRotation"),
+	0.1f,
+	TEXT("Maximum angle in degrees a camera may have rotated since its DLSS history was retained for that history to be continued on a cut back to it (default = 0.1)\n"),
+	ECVF_RenderThreadSafe);
+
+FDLSSCameraPose FDLSSCameraPose::FromViewMatrices(const FViewMatrices& ViewMatrices)
+{
+	FDLSSCameraPose Pose;
+	Pose.ViewOrigin = ViewMatrices.GetViewOrigin();
+	Pose.ViewRotation = FQuat(ViewMatrices.GetViewMatrix().RemoveTranslation());
+	Pose.ProjectionMatrix = ViewMatrices.GetProjectionNoAAMatrix();
+	return Pose;
+}
+
+bool FDLSSCameraPose::IsCloseTo(const FDLSSCameraPose& Other) const
+{
+	const float MaxTranslation = FMath::Max(CVarNGXDLSSCameraHistoryMaxRestoreTranslation.GetValueOnRenderThread(), 0.0f);
+	const float MaxRotation = FMath::DegreesToRadians(FMath::Max(CVarNGXDLSSCameraHistoryMaxRestoreRotation.GetValueOnRenderThread(), 0.0f));
+
+	// e.g. a field of view animation changes the projection
+	constexpr float ProjectionTolerance = 1.e-4f;
+
+	return FVector::Dist(ViewOrigin, Other.ViewOrigin) <= MaxTranslation
+		&& ViewRotation.AngularDistance(Other.ViewRotation) <= MaxRotation
+		&& ProjectionMatrix.Equals(Other.ProjectionMatrix, ProjectionTolerance);
+}
+
+uint64 EstimateDLSSHistoryGPUSizeBytes(FIntPoint OutputSize, ENGXDLSSDenoiserMode DenoiserMode)
+{
+	// history and intermediate buffers per output pixel. DLSS-RR additionally keeps history of its guide buffers
+	static_assert (int(ENGXDLSSDenoiserMode::MaxValue) == 1, "dear DLSS plugin NVIDIA developer, please update this code to handle the new ENGXDLSSDenoiserMode enum values");
+	const uint64 BytesPerPixel = (DenoiserMode == ENGXDLSSDenoiserMode::DLSSRR) ? 80 : 24;
+	return uint64(FMath::Max(OutputSize.X, 0)) * uint64(FMath::Max(OutputSize.Y, 0)) * BytesPerPixel;
+}
+
+FDLSSCameraHistoryCache& FDLSSCameraHistoryCache::Get()
+{
+	static FDLSSCameraHistoryCache Cache;
+	return Cache;
+}
+
+bool FDLSSCameraHistoryCache::IsEnabledForPlayer(int32 PlayerIndex) const
+{
+	check(IsInRenderingThread());
+	return CVarNGXDLSSCameraHistoryMaxHistories.GetValueOnRenderThread() > 0 && CameraIds.Contains(PlayerIndex);
+}
+
+FName FDLSSCameraHistoryCache::GetCameraId(int32 PlayerIndex) const
+{
+	check(IsInRenderingThread());
+	const FName* CameraId = CameraIds.Find(PlayerIndex);
+	return CameraId ? *CameraId : NAME_None;
+}
+
+void FDLSSCameraHistoryCache::SetCameraId(int32 PlayerIndex, FName CameraId)
+{
+	check(IsInRenderingThread());
+	if (CameraId.IsNone())
+	{
+		CameraIds.Remove(PlayerIndex);
+	}
+	else
+	{
+		CameraIds.FindOrAdd(PlayerIndex) = CameraId;
+	}
+}
+
+FDLSSStateRef FDLSSCameraHistoryCache::AcquireState(uint32 ViewKey, FName CameraId, FIntPoint OutputSize, ENGXDLSSDenoiserMode DenoiserMode, const FDLSSCameraPose& Pose,
+	const FDLSSStateRef& InputState, bool bCameraCut, bool& bOutRestored)
+{
+	check(IsInRenderingThread());
+	check(!CameraId.IsNone());
+
+	bOutRestored = false;
+
+	const int32 EntryIndex = Entries.IndexOfByPredicate([ViewKey, CameraId](const FEntry& Entry)
+	{
+		return Entry.ViewKey == ViewKey && Entry.CameraId == CameraId;
+	});
+
+	FDLSSStateRef DLSSState = InputState;
+	if (bCameraCut || !DLSSState)
+	{
+		const FEntry* Entry = (EntryIndex != INDEX_NONE) ? &Entries[EntryIndex] : nullptr;
+		if (Entry && Entry->DLSSState && Entry->DLSSState != InputState && Entry->OutputSize == OutputSize && Entry->DenoiserMode == DenoiserMode)
+		{
+			// if the camera moved meanwhile (e.g. an animated cinematic camera), the retained NGX feature still gets reused, but with its history reset
+			DLSSState = Entry->DLSSState;
+			bOutRestored = Entry->Pose.IsCloseTo(Pose);
+			if (bOutRestored)
+			{
+				INC_DWORD_STAT(STAT_DLSSCameraHistoryRestored);
+			}
+			else
+			{
+				INC_DWORD_STAT(STAT_DLSSCameraHistoryMoved);
+			}
+		}
+		else
+		{
+			const bool bInputStateOfOtherCamera = DLSSState && Entries.ContainsByPredicate([ViewKey, CameraId, &DLSSState](const FEntry& Other)
+			{
+				return Other.DLSSState == DLSSState && !(Other.ViewKey == ViewKey && Other.CameraId == CameraId);
+			});
+
+			if (!DLSSState || bInputStateOfOtherCamera)
+			{
+				DLSSState = MakeShared<FDLSSState, ESPMode::ThreadSafe>();
+			}
+		}
+	}
+
+	// this frame advances the history of the state, so it isn't the one of any other camera anymore
+	for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+	{
+		const FEntry& Other = Entries[Index];
+		if (Other.DLSSState == DLSSState && !(Other.ViewKey == ViewKey && Other.CameraId == CameraId))
+		{
+			RemoveEntryAt(Index);
+		}
+	}
+
+	FEntry* Entry = Entries.FindByPredicate([ViewKey, CameraId](const FEntry& Other)
+	{
+		return Other.ViewKey == ViewKey && Other.CameraId == CameraId;
+	});
+	if (!Entry)
+	{
+		Entry = &Entries.AddDefaulted_GetRef();
+		Entry->ViewKey = ViewKey;
+		Entry->CameraId = CameraId;
+	}
+
+	EstimatedMemorySize -= Entry->EstimatedSize;
+	Entry->DLSSState = DLSSState;
+	Entry->OutputSize = OutputSize;
+	Entry->DenoiserMode = DenoiserMode;
+	Entry->Pose = Pose;
+	Entry->EstimatedSize = EstimateDLSSHistoryGPUSizeBytes(OutputSize, DenoiserMode);
+	Entry->LastUsedFrame = GFrameCounterRenderThread;
+	EstimatedMemorySize += Entry->EstimatedSize;
+
+	Trim();
+
+	return DLSSState;
+}
+
+void FDLSSCameraHistoryCache::Trim()
+{
+	check(IsInRenderingThread());
+
+	const int32 MaxHistories = CVarNGXDLSSCameraHistoryMaxHistories.GetValueOnRenderThread();
+	if (MaxHistories <= 0)
+	{
+		Empty();
+		return;
+	}
+
+	const uint64 Budget = uint64(FMath::Max(CVarNGXDLSSCameraHistoryBudgetMB.GetValueOnRenderThread(), 0)) * 1024 * 1024;
+	while (Entries.Num() > MaxHistories || EstimatedMemorySize > Budget)
+	{
+		// histories used this frame stay, even if that exceeds the limits
+		int32 LeastRecentlyUsed = INDEX_NONE;
+		for (int32 Index = 0; Index < Entries.Num(); ++Index)
+		{
+			if (Entries[Index].LastUsedFrame != GFrameCounterRenderThread
+				&& (LeastRecentlyUsed == INDEX_NONE || Entries[Index].LastUsedFrame < Entries[LeastRecentlyUsed].LastUsedFrame))
+			{
+				LeastRecentlyUsed = Index;
+			}
+		}
+
+		if (LeastRecentlyUsed == INDEX_NONE)
+		{
+			break;
+		}
+
+		UE_LOG(LogDLSSCameraHistory, Verbose, TEXT("Evicting the DLSS history of camera %s of view %u, last used in frame %llu"),
+			*Entries[LeastRecentlyUsed].CameraId.ToString(), Entries[LeastRecentlyUsed].ViewKey, Entries[LeastRecentlyUsed].LastUsedFrame);
+		INC_DWORD_STAT(STAT_DLSSCameraHistoryEvicted);
+		RemoveEntryAt(LeastRecentlyUsed);
+	}
+
+	UpdateStats();
+}
+
+void FDLSSCameraHistoryCache::Empty()
+{
+	check(IsInRenderingThread());
+	Entries.Empty();
+	EstimatedMemorySize = 0;
+	UpdateStats();
+}
+
+void FDLSSCameraHistoryCache::RemoveEntryAt(int32 Index)
+{
+	EstimatedMemorySize -= Entries[Index].EstimatedSize;
+	Entries.RemoveAtSwap(Index);
+}
+
+void FDLSSCameraHistoryCache::UpdateStats() const
+{
+	SET_DWORD_STAT(STAT_DLSSCameraHistoryNumHistories, Entries.Num());
+	SET_MEMORY_STAT(STAT_DLSSCameraHistoryMemory, EstimatedMemorySize);
+}
+
+void FDLSSCameraHistoryCache::LogHistories() const
+{
+	check(IsInRenderingThread());
+	UE_LOG(LogDLSSCameraHistory, Log, TEXT("%d retained DLSS camera histories, %llu bytes estimated"), Entries.Num(), EstimatedMemorySize);
+	for (const FEntry& Entry : Entries)
+	{
+		UE_LOG(LogDLSSCameraHistory, Log, TEXT("  view %u camera %s: %dx%d%s, %llu bytes, last used in frame %llu"),
+			Entry.ViewKey, *Entry.CameraId.ToString(), Entry.OutputSize.X, Entry.OutputSize.Y,
+			(Entry.DenoiserMode == ENGXDLSSDenoiserMode::DLSSRR) ? TEXT(" DLSS-RR") : TEXT(""), Entry.EstimatedSize, Entry.LastUsedFrame);
+	}
+	for (const TPair<int32, FName>& CameraId : CameraIds)
+	{
+		UE_LOG(LogDLSSCameraHistory, Log, TEXT("  player %d uses camera %s"), CameraId.Key, *CameraId.Value.ToString());
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommand CCmdNGXDLSSCameraHistoryLog(
+	TEXT("r.NGX.DLSS.CameraHistory.Log"),
+	TEXT("Logs the DLSS histories retained across camera cuts and the camera ids of the players"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		ENQUEUE_RENDER_COMMAND(LogDLSSCameraHistories)([](FRHICommandListImmediate& RHICmdList)
+		{
+			FDLSSCameraHistoryCache::Get().LogHistories();
+		});
+	}));
+#endif
@@ -0,0 +1,83 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NGXRHI.h"
+
+struct FViewMatrices;
+
+// Where a camera looked from in the last frame a history was evaluated for. On a cut back to the camera the engine provides no motion relative to that frame,
+// so the retained history only lines up with the new frame if the camera is still where it was
+struct FDLSSCameraPose
+{
+	FVector ViewOrigin = FVector::ZeroVector;
+	FQuat ViewRotation = FQuat::Identity;
+	FMatrix ProjectionMatrix = FMatrix::Identity;
+
+	// without the temporal AA jitter
+	static FDLSSCameraPose FromViewMatrices(const FViewMatrices& ViewMatrices);
+	// within r.NGX.DLSS.CameraHistory.MaxRestoreTranslation and r.NGX.DLSS.CameraHistory.MaxRestoreRotation, with the same projection
+	bool IsCloseTo(const FDLSSCameraPose& Other) const;
+};
+
+// NGX only reports the video memory of all DLSS features together, so the footprint of a single feature is approximated from its output resolution
+extern uint64 EstimateDLSSHistoryGPUSizeBytes(FIntPoint OutputSize, ENGXDLSSDenoiserMode DenoiserMode);
+
+// Keeps the DLSS state, i.e. the NGX feature including its temporal history, of the last cameras a view rendered through, so that a cut back
+// to one of them (e.g. shot/reverse shot in a cinematic) continues its history instead of converging again from scratch.
+// Opt-in: only views of players with a camera id set via FDLSSUpscaler::SetCameraHistoryId take part. Render thread only
+class FDLSSCameraHistoryCache
+{
+public:
+	static FDLSSCameraHistoryCache& Get();
+
+	// r.NGX.DLSS.CameraHistory.MaxHistories > 0 and a camera id is set for the player
+	bool IsEnabledForPlayer(int32 PlayerIndex) const;
+	FName GetCameraId(int32 PlayerIndex) const;
+	void SetCameraId(int32 PlayerIndex, FName CameraId);
+
+	// Returns the DLSS state to evaluate the view with this frame and retains it for CameraId. On a camera cut, this is the state retained for CameraId
+	// if there is a compatible one. bOutRestored is set when the camera also didn't move since that state was last evaluated, so that the caller doesn't reset its history.
+	// Each state belongs to at most one camera, so a cut to a camera without a retained history gets a new state rather than resetting the one of another camera
+	FDLSSStateRef AcquireState(uint32 ViewKey, FName CameraId, FIntPoint OutputSize, ENGXDLSSDenoiserMode DenoiserMode, const FDLSSCameraPose& Pose,
+		const FDLSSStateRef& InputState, bool bCameraCut, bool& bOutRestored);
+
+	// Applies the cvars, evicting least recently used histories until both the count and the memory budget are met. Called once per frame
+	void Trim();
+	void Empty();
+
+	int32 GetNumHistories() const { return Entries.Num(); }
+	uint64 GetEstimatedMemorySize() const { return EstimatedMemorySize; }
+	void LogHistories() const;
+
+private:
+	struct FEntry
+	{
+		uint32 ViewKey = 0;
+		FName CameraId;
+		FDLSSStateRef DLSSState;
+		FIntPoint OutputSize = FIntPoint::ZeroValue;
+		ENGXDLSSDenoiserMode DenoiserMode = ENGXDLSSDenoiserMode::Off;
+		FDLSSCameraPose Pose;
+		uint64 EstimatedSize = 0;
+		uint64 LastUsedFrame = 0;
+	};
+
+	void RemoveEntryAt(int32 Index);
+	void UpdateStats() const;
+
+	// a handful of entries at most, so linear searches are fine
+	TArray<FEntry> Entries;
+	TMap<int32, FName> CameraIds;
+	uint64 EstimatedMemorySize = 0;
+};
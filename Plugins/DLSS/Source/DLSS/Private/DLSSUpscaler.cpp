@@ -12,6 +12,7 @@
 #include "DLSSUpscaler.h"
 
 #include "DLSS.h"
+#include "DLSSCameraHistoryCache.h"
 #include "DLSSSettings.h"
 #include "DLSSUpscalerHistory.h"
 #include "DLSSUpscalerModularFeature.h"
@@ -19,6 +20,7 @@
 #include "GBufferResolvePass.h"
 #include "VelocityCombinePass.h"
 #include "BiasCurrentColorPass.h"
+#include "DLSSInputPrepPass.h"
 
 #include "DynamicResolutionState.h"
 #include "Engine/GameViewportClient.h"
@@ -704,9 +706,34 @@ void FDLSSUpscaler::ReleaseStaticResources()
 {
 	UE_LOG(LogDLSS, VeryVerbose, TEXT("%s Enter"), ANSI_TO_TCHAR(__FUNCTION__));
 	ResolutionSettings.Empty();
+
+	// the retained histories keep NGX features alive, which have to be released before NGX shuts down
+	ENQUEUE_RENDER_COMMAND(ReleaseDLSSCameraHistories)([](FRHICommandListImmediate& RHICmdList)
+	{
+		FDLSSCameraHistoryCache::Get().Empty();
+	});
+	FlushRenderingCommands();
 	UE_LOG(LogDLSS, VeryVerbose, TEXT("%s Leave"), ANSI_TO_TCHAR(__FUNCTION__));
 }
 
+void FDLSSUpscaler::SetCameraHistoryId(int32 PlayerIndex, FName CameraId)
+{
+	check(IsInGameThread());
+	ENQUEUE_RENDER_COMMAND(SetDLSSCameraHistoryId)([PlayerIndex, CameraId](FRHICommandListImmediate& RHICmdList)
+	{
+		FDLSSCameraHistoryCache::Get().SetCameraId(PlayerIndex, CameraId);
+	});
+}
+
+void FDLSSUpscaler::ClearCameraHistories()
+{
+	check(IsInGameThread());
+	ENQUEUE_RENDER_COMMAND(ClearDLSSCameraHistories)([](FRHICommandListImmediate& RHICmdList)
+	{
+		FDLSSCameraHistoryCache::Get().Empty();
+	});
+}
+
 static const TCHAR* const GDLSSSceneViewFamilyUpscalerDebugName = TEXT("FDLSSSceneViewFamilyUpscaler");
 static const TCHAR* const GDLSSRRSceneViewFamilyUpscalerDebugName = TEXT("FDLSSSceneViewFamilyUpscaler(DLSS-RR)");
 
@@ -797,41 +824,86 @@ ITemporalUpscaler::FOutputs FDLSSSceneViewFamilyUpscaler::AddPasses(
 		
 		FCustomDepthTextures CustomDepthTextures = ((FViewFamilyInfo*)View.Family)->GetSceneTextures().CustomDepth;
 
-		FRDGTextureRef BiasCurrentColorTexture = nullptr;
-
-		if (CustomDepthTextures.IsValid() && CustomDepthTextures.Stencil != nullptr)
-		{
-			BiasCurrentColorTexture = AddBiasCurrentColorPass(
-				GraphBuilder, View,
-				InputViewRect,
-				CustomDepthTextures,
-				BiasCurrentColorMaskCustomOffset);
-		}
-		
-
 #if SUPPORT_GUIDE_GBUFFER
 		FRDGTextureRef AlternateMotionVectorTexture = PassInputs.GuideBuffers.AlternateMotionVector.Texture;
 #else
 		FRDGTextureRef AlternateMotionVectorTexture = nullptr;
 #endif
 
-		FRDGTextureRef CombinedVelocityTexture = AddVelocityCombinePass(
+		const bool bHasBiasCurrentColor = CustomDepthTextures.IsValid() && CustomDepthTextures.Stencil != nullptr;
+		const bool bResolveGBuffer = DLSSParameters.DenoiserMode == ENGXDLSSDenoiserMode::DLSSRR;
+		// the compute GBuffer resolve classifies sky tiles and packs the guide buffers, which the fused input prep pass doesn't, so that one only does velocity and bias then
+		const bool bFusedGBufferResolve = bResolveGBuffer && !ShouldUseGBufferResolveCompute();
+		const bool bFusedInputPrep = CanUseDLSSInputPrepPass(
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+			PassInputs,
+#endif
+			bDilateMotionVectors,
+			bFusedGBufferResolve);
+
+		FRDGTextureRef BiasCurrentColorTexture = nullptr;
+		FRDGTextureRef CombinedVelocityTexture = nullptr;
+		FGBufferResolveOutputs ResolvedGBuffer;
+
+		FDLSSInputPrepOutputs BatchedInputPrepOutputs;
+		const EDLSSInputPrepBatch InputPrepBatch = (bFusedInputPrep && !bFusedGBufferResolve) ? GetBatchedInputPrepOutputs(
 			GraphBuilder, View,
+			InputViewRect,
 			DLSSParameters.SceneDepthInput,
 			InputVelocity,
 			AlternateMotionVectorTexture,
-			InputViewRect,
-			DLSSParameters.OutputViewRect,
-			DLSSParameters.TemporalJitterPixels,
-			bDilateMotionVectors);
+			CustomDepthTextures,
+			BiasCurrentColorMaskCustomOffset,
+			BatchedInputPrepOutputs) : EDLSSInputPrepBatch::None;
 
-		DLSSParameters.SceneVelocityInput = CombinedVelocityTexture;
-		DLSSParameters.BiasCurrentColorInput = BiasCurrentColorTexture;
-		DLSSParameters.bHighResolutionMotionVectors = bDilateMotionVectors;
+		RecordDLSSInputPrepPassStats(bFusedInputPrep, DLSSParameters.SceneDepthInput, InputVelocity, AlternateMotionVectorTexture, bHasBiasCurrentColor, bFusedGBufferResolve, InputViewRect, InputPrepBatch);
 
-		if (DLSSParameters.DenoiserMode == ENGXDLSSDenoiserMode::DLSSRR)
+		if (InputPrepBatch != EDLSSInputPrepBatch::None)
+		{
+			BiasCurrentColorTexture = BatchedInputPrepOutputs.BiasCurrentColor;
+			CombinedVelocityTexture = BatchedInputPrepOutputs.CombinedVelocity;
+		}
+		else if (bFusedInputPrep)
 		{
-			FGBufferResolveOutputs ResolvedGBuffer = AddGBufferResolvePass(
+			const FDLSSInputPrepOutputs InputPrepOutputs = AddDLSSInputPrepPass(
+				GraphBuilder, View,
+				DLSSParameters.SceneDepthInput,
+				InputVelocity,
+				AlternateMotionVectorTexture,
+				CustomDepthTextures,
+				BiasCurrentColorMaskCustomOffset,
+				InputViewRect,
+				bFusedGBufferResolve);
+
+			BiasCurrentColorTexture = InputPrepOutputs.BiasCurrentColor;
+			CombinedVelocityTexture = InputPrepOutputs.CombinedVelocity;
+			ResolvedGBuffer = InputPrepOutputs.ResolvedGBuffer;
+		}
+		else
+		{
+			if (bHasBiasCurrentColor)
+			{
+				BiasCurrentColorTexture = AddBiasCurrentColorPass(
+					GraphBuilder, View,
+					InputViewRect,
+					CustomDepthTextures,
+					BiasCurrentColorMaskCustomOffset);
+			}
+
+			CombinedVelocityTexture = AddVelocityCombinePass(
+				GraphBuilder, View,
+				DLSSParameters.SceneDepthInput,
+				InputVelocity,
+				AlternateMotionVectorTexture,
+				InputViewRect,
+				DLSSParameters.OutputViewRect,
+				DLSSParameters.TemporalJitterPixels,
+				bDilateMotionVectors);
+		}
+
+		if (bResolveGBuffer && !(bFusedInputPrep && bFusedGBufferResolve))
+		{
+			ResolvedGBuffer = AddGBufferResolvePass(
 				GraphBuilder, 
 				View, 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
@@ -839,7 +911,14 @@ ITemporalUpscaler::FOutputs FDLSSSceneViewFamilyUpscaler::AddPasses(
 #endif
 				InputViewRect, 
 				true);
+		}
+
+		DLSSParameters.SceneVelocityInput = CombinedVelocityTexture;
+		DLSSParameters.BiasCurrentColorInput = BiasCurrentColorTexture;
+		DLSSParameters.bHighResolutionMotionVectors = bDilateMotionVectors;
 
+		if (bResolveGBuffer)
+		{
 			DLSSParameters.SceneVelocityInput = CombinedVelocityTexture;
 
 			DLSSParameters.DiffuseAlbedo = ResolvedGBuffer.DiffuseAlbedo;
@@ -876,6 +955,75 @@ ITemporalUpscaler::FOutputs FDLSSSceneViewFamilyUpscaler::AddPasses(
 	return Outputs;
 }
 
+EDLSSInputPrepBatch FDLSSSceneViewFamilyUpscaler::GetBatchedInputPrepOutputs(
+	FRDGBuilder& GraphBuilder,
+	const FSceneView& View,
+	FIntRect InputViewRect,
+	FRDGTextureRef InSceneDepthTexture,
+	FRDGTextureRef InVelocityTexture,
+	FRDGTextureRef AlternateMotionVectorTexture,
+	const FCustomDepthTextures& CustomDepthTextures,
+	uint8 BiasCurrentColorMaskCustomOffset,
+	FDLSSInputPrepOutputs& OutOutputs
+) const
+{
+	check(IsInRenderingThread());
+
+	EDLSSInputPrepBatch Batch = EDLSSInputPrepBatch::Later;
+
+	if (BatchedInputPrep.GraphBuilder != &GraphBuilder || BatchedInputPrep.FrameCounter != GFrameCounterRenderThread)
+	{
+		BatchedInputPrep = FBatchedInputPrep();
+		BatchedInputPrep.GraphBuilder = &GraphBuilder;
+		BatchedInputPrep.FrameCounter = GFrameCounterRenderThread;
+		BatchedInputPrep.SceneDepth = InSceneDepthTexture;
+		BatchedInputPrep.Velocity = InVelocityTexture;
+		BatchedInputPrep.AlternateMotionVectors = AlternateMotionVectorTexture;
+
+		// the views the engine is going to run the temporal upscaler for, a view that doesn't get here after all just leaves its outputs unused
+		TArray<const FSceneView*, TInlineAllocator<kDLSSInputPrepMaxBatchedViews>> Views;
+		for (const FSceneView* FamilyView : View.Family->Views)
+		{
+			if (FamilyView && IsTemporalAccumulationBasedMethod(FamilyView->AntiAliasingMethod))
+			{
+				Views.Add(FamilyView);
+			}
+		}
+
+		if (Views.Contains(&View))
+		{
+			BatchedInputPrep.Outputs = AddDLSSInputPrepBatchedPass(
+				GraphBuilder, Views,
+				InSceneDepthTexture,
+				InVelocityTexture,
+				AlternateMotionVectorTexture,
+				CustomDepthTextures,
+				BiasCurrentColorMaskCustomOffset);
+
+			if (BatchedInputPrep.Outputs.Num() > 0)
+			{
+				BatchedInputPrep.Views = Views;
+			}
+		}
+
+		Batch = EDLSSInputPrepBatch::First;
+	}
+
+	// the batched dispatch assumed the family shares the scene textures and used the ViewRect of each view
+	const int32 ViewIndex = BatchedInputPrep.Views.Find(&View);
+	if (ViewIndex == INDEX_NONE ||
+		BatchedInputPrep.SceneDepth != InSceneDepthTexture ||
+		BatchedInputPrep.Velocity != InVelocityTexture ||
+		BatchedInputPrep.AlternateMotionVectors != AlternateMotionVectorTexture ||
+		static_cast<const FViewInfo&>(View).ViewRect != InputViewRect)
+	{
+		return EDLSSInputPrepBatch::None;
+	}
+
+	OutOutputs = BatchedInputPrep.Outputs[ViewIndex];
+	return Batch;
+}
+
 FDLSSOutputs FDLSSSceneViewFamilyUpscaler::AddDLSSPass(
 	FRDGBuilder& GraphBuilder,
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
@@ -965,6 +1113,20 @@ FDLSSOutputs FDLSSSceneViewFamilyUpscaler::AddDLSSPass(
 	}
 	FDLSSStateRef DLSSState = (InputDLSSHistory && InputDLSSHistory->DLSSState) ? InputDLSSHistory->DLSSState : MakeShared<FDLSSState, ESPMode::ThreadSafe>();
 
+	// with a camera id set for the player, a cut back to a camera that didn't move continues the history retained for it instead of resetting
+	bool bResetHistory = bCameraCut;
+	bool bCameraHistoryChangedState = false;
+	FDLSSCameraHistoryCache& CameraHistoryCache = FDLSSCameraHistoryCache::Get();
+	if (View.State && CameraHistoryCache.IsEnabledForPlayer(View.PlayerIndex))
+	{
+		bool bRestoredHistory = false;
+		const FDLSSStateRef InputDLSSState = InputDLSSHistory ? InputDLSSHistory->DLSSState : nullptr;
+		DLSSState = CameraHistoryCache.AcquireState(View.GetViewKey(), CameraHistoryCache.GetCameraId(View.PlayerIndex), DestRect.Size(), Inputs.DenoiserMode,
+			FDLSSCameraPose::FromViewMatrices(View.ViewMatrices), InputDLSSState, bCameraCut, bRestoredHistory);
+		bResetHistory = bCameraCut && !bRestoredHistory;
+		bCameraHistoryChangedState = (DLSSState != InputDLSSState);
+	}
+
 	{
 		FDLSSShaderParameters* PassParameters = GraphBuilder.AllocParameters<FDLSSShaderParameters>();
 
@@ -1085,7 +1247,7 @@ FDLSSOutputs FDLSSSceneViewFamilyUpscaler::AddDLSSPass(
 			PassParameters,
 			ERDGPassFlags::Compute | ERDGPassFlags::Raster | ERDGPassFlags::Copy |  ERDGPassFlags::SkipRenderPass,
 			// FRHICommandListImmediate forces it to run on render thread, FRHICommandList doesn't
-			[LocalNGXRHIExtensions, PassParameters, Inputs, AdjustedInputViewRect, bCameraCut, DeltaWorldTimeMS, Sharpness, NGXDLSSPreset, NGXDLSSRRPreset, NGXPerfQuality, DLSSState, bUseAutoExposure, bEnableAlphaUpscaling, bReleaseMemoryOnDelete, bUseBiasCurrentColorMask](FRHICommandListImmediate& RHICmdList)
+			[LocalNGXRHIExtensions, PassParameters, Inputs, AdjustedInputViewRect, bResetHistory, DeltaWorldTimeMS, Sharpness, NGXDLSSPreset, NGXDLSSRRPreset, NGXPerfQuality, DLSSState, bUseAutoExposure, bEnableAlphaUpscaling, bReleaseMemoryOnDelete, bUseBiasCurrentColorMask](FRHICommandListImmediate& RHICmdList)
 			{
 				FRHIDLSSArguments DLSSArguments;
 				FMemory::Memzero(&DLSSArguments, sizeof(DLSSArguments));
@@ -1095,7 +1257,7 @@ FDLSSOutputs FDLSSSceneViewFamilyUpscaler::AddDLSSPass(
 				DLSSArguments.DestRect = Inputs.OutputViewRect;
 
 				DLSSArguments.Sharpness = Sharpness;
-				DLSSArguments.bReset = bCameraCut;
+				DLSSArguments.bReset = bResetHistory;
 
 				DLSSArguments.JitterOffset = Inputs.TemporalJitterPixels;
 				DLSSArguments.MotionVectorScale = FVector2f::UnitVector;
@@ -1159,9 +1321,17 @@ FDLSSOutputs FDLSSSceneViewFamilyUpscaler::AddDLSSPass(
 						PassParameters->Normal->MarkResourceAsUsed();
 					DLSSArguments.InputNormals = PassParameters->Normal->GetRHI();
 
-					check(PassParameters->Roughness)
+					if (PassParameters->Roughness)
+					{
 						PassParameters->Roughness->MarkResourceAsUsed();
-					DLSSArguments.InputRoughness = PassParameters->Roughness->GetRHI();
+						DLSSArguments.InputRoughness = PassParameters->Roughness->GetRHI();
+					}
+					else
+					{
+						// the GBuffer resolve packed the roughness into the normal alpha. NGX doesn't read InputRoughness then, but the RHIs expect a resource
+						DLSSArguments.InputRoughness = DLSSArguments.InputNormals;
+						DLSSArguments.bPackedRoughness = true;
+					}
 
 #if SUPPORT_GUIDE_GBUFFER
 					if (PassParameters->ReflectionHitDistance)
@@ -1219,7 +1389,7 @@ FDLSSOutputs FDLSSSceneViewFamilyUpscaler::AddDLSSPass(
 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
 	check(OutputCustomHistoryInterface);
-	(*OutputCustomHistoryInterface) = new FDLSSUpscalerHistory(DLSSState, Inputs.DenoiserMode);
+	(*OutputCustomHistoryInterface) = new FDLSSUpscalerHistory(DLSSState, Inputs.DenoiserMode, DestRect.Size());
 #else
 	if (!View.bStatePrevViewInfoIsReadOnly && OutputHistory)
 	{
@@ -1234,9 +1404,9 @@ FDLSSOutputs FDLSSSceneViewFamilyUpscaler::AddDLSSPass(
 
 	if (!View.bStatePrevViewInfoIsReadOnly && OutputCustomHistoryInterface)
 	{
-		if (!OutputCustomHistoryInterface->GetReference())
+		if (!OutputCustomHistoryInterface->GetReference() || bCameraHistoryChangedState)
 		{
-			(*OutputCustomHistoryInterface) = new FDLSSUpscalerHistory(DLSSState, Inputs.DenoiserMode);
+			(*OutputCustomHistoryInterface) = new FDLSSUpscalerHistory(DLSSState, Inputs.DenoiserMode, DestRect.Size());
 		}
 	}
 #endif
@@ -1252,8 +1422,7 @@ const TCHAR* FDLSSUpscalerHistory::GetDebugName() const
 
 uint64 FDLSSUpscalerHistory::GetGPUSizeBytes() const
 {
-	// TODO
-	return 0;
+	return EstimateDLSSHistoryGPUSizeBytes(OutputSize, DenoiserMode);
 }
 #endif
 
@@ -1261,6 +1430,8 @@ void FDLSSUpscaler::Tick(FRHICommandListImmediate& RHICmdList)
 {
 	check(NGXRHIExtensions);
 	check(IsInRenderingThread());
+	FDLSSCameraHistoryCache::Get().Trim();
+
 	// Pass it over to the RHI thread which handles the lifetime of the NGX DLSS resources
 	RHICmdList.EnqueueLambda(
 		[this](FRHICommandListImmediate& Cmd)
@@ -22,8 +22,8 @@
 #define LOCTEXT_NAMESPACE "FDLSSModule"
 
 
-FDLSSUpscalerHistory::FDLSSUpscalerHistory(FDLSSStateRef InDLSSState, ENGXDLSSDenoiserMode InDenoiserMode)
-	: DLSSState(InDLSSState), DenoiserMode(InDenoiserMode)
+FDLSSUpscalerHistory::FDLSSUpscalerHistory(FDLSSStateRef InDLSSState, ENGXDLSSDenoiserMode InDenoiserMode, FIntPoint InOutputSize)
+	: DLSSState(InDLSSState), DenoiserMode(InDenoiserMode), OutputSize(InOutputSize)
 {
 }
 
@@ -41,6 +41,8 @@ private:
 	FDLSSStateRef DLSSState;
 	// in 5.3+ the debug name must match the upscaler's debug name, and since the name includes whether we're running DLSS-RR the history needs to know the denoiser mode
 	ENGXDLSSDenoiserMode DenoiserMode;
+	// to estimate the video memory of the NGX feature
+	FIntPoint OutputSize;
 
 #if UE_VERSION_OLDER_THAN(5,6,0)
 	virtual uint32 AddRef() const final
@@ -62,7 +64,7 @@ private:
 		return FRefCountBase::GetRefCount();
 	}
 
-	FDLSSUpscalerHistory(FDLSSStateRef InDLSSState, ENGXDLSSDenoiserMode InDenoiserMode);
+	FDLSSUpscalerHistory(FDLSSStateRef InDLSSState, ENGXDLSSDenoiserMode InDenoiserMode, FIntPoint InOutputSize);
 	~FDLSSUpscalerHistory();
 
 };
@@ -18,6 +18,8 @@
 
 #include "DLSSUpscaler.h"
 #include "NGXRHI.h"
+#include "DLSSInputPrepPass.h"
+#include "DLSSPersistentResources.h"
 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
 #include "TemporalUpscaler.h"
@@ -132,6 +134,32 @@ private:
 	const FDLSSUpscaler* Upscaler;
 	const EDLSSQualityMode DLSSQualityMode;
 
+	// With several views in the family, e.g. instanced stereo, the first view to get to AddPasses adds the input prep of all of them
+	// in one dispatch and the later views pick up their outputs. Render thread only
+	struct FBatchedInputPrep
+	{
+		const FRDGBuilder* GraphBuilder = nullptr;
+		uint64 FrameCounter = 0;
+		FRDGTextureRef SceneDepth = nullptr;
+		FRDGTextureRef Velocity = nullptr;
+		FRDGTextureRef AlternateMotionVectors = nullptr;
+		TArray<const FSceneView*, TInlineAllocator<kDLSSInputPrepMaxBatchedViews>> Views;
+		TArray<FDLSSInputPrepOutputs> Outputs;
+	};
+	mutable FBatchedInputPrep BatchedInputPrep;
+
+	EDLSSInputPrepBatch GetBatchedInputPrepOutputs(
+		FRDGBuilder& GraphBuilder,
+		const FSceneView& View,
+		FIntRect InputViewRect,
+		FRDGTextureRef InSceneDepthTexture,
+		FRDGTextureRef InVelocityTexture,
+		FRDGTextureRef AlternateMotionVectorTexture,
+		const struct FCustomDepthTextures& CustomDepthTextures,
+		uint8 BiasCurrentColorMaskCustomOffset,
+		FDLSSInputPrepOutputs& OutOutputs
+	) const;
+
 	FDLSSOutputs AddDLSSPass(
 		FRDGBuilder& GraphBuilder,
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
@@ -159,11 +187,10 @@ END_SHADER_PARAMETER_STRUCT()
 inline void AddDebugLayerCompatibilitySetupPasses(FRDGBuilder& GraphBuilder, FDebugLayerCompatibilityShaderParameters* PassParameters)
 {
 	RDG_EVENT_SCOPE(GraphBuilder, "UE5.5AndOlderDebugLayerCompatibilitySetup");
+	// persistent, so only the first graph creates and clears them
 	FRDGTextureDesc Desc = FRDGTextureDesc::Create2D(FIntPoint(1, 1), PF_FloatRGBA, FClearValueBinding::Black, TexCreate_RenderTargetable);
-	PassParameters->DebugLayerCompatibilityHelperSource = GraphBuilder.CreateTexture(Desc, TEXT("UE5.5AndOlderDebugLayerCompatibilityHelperSource"));
-	PassParameters->DebugLayerCompatibilityHelperDest = GraphBuilder.CreateTexture(Desc, TEXT("UE5.5AndOlderDebugLayerCompatibilityHelperDest"));
-	AddClearRenderTargetPass(GraphBuilder, PassParameters->DebugLayerCompatibilityHelperSource);
-	AddClearRenderTargetPass(GraphBuilder, PassParameters->DebugLayerCompatibilityHelperDest);
+	PassParameters->DebugLayerCompatibilityHelperSource = FDLSSPersistentResources::Get().RegisterClearedTexture(GraphBuilder, TEXT("UE5.5AndOlderDebugLayerCompatibilityHelperSource"), Desc);
+	PassParameters->DebugLayerCompatibilityHelperDest = FDLSSPersistentResources::Get().RegisterClearedTexture(GraphBuilder, TEXT("UE5.5AndOlderDebugLayerCompatibilityHelperDest"), Desc);
 }
 
 inline void DebugLayerCompatibilityRHISetup(const FDebugLayerCompatibilityShaderParameters& PassParameters, FRHIDLSSArguments& InDLSSArguments)
@@ -67,6 +67,12 @@ public:
 
 	static void ReleaseStaticResources();
 
+	// Retains the DLSS history of each camera the views of a player (FSceneView::PlayerIndex) render through under the given id, so that cutting
+	// back to a camera continues its history instead of restarting convergence. NAME_None stops retaining. Game thread
+	static void SetCameraHistoryId(int32 PlayerIndex, FName CameraId);
+	// Releases the histories retained via SetCameraHistoryId, e.g. at the end of a cinematic. Game thread
+	static void ClearCameraHistories();
+
 	static float GetMinUpsampleResolutionFraction()
 	{
 		return MinDynamicResolutionFraction;
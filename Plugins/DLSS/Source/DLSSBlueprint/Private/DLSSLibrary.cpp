@@ -841,6 +841,42 @@ UDLSSMode UDLSSLibrary::GetDefaultDLSSMode()
 	}
 }
 
+void UDLSSLibrary::SetDLSSCameraHistoryId(FName CameraId, int32 PlayerIndex)
+{
+#if WITH_DLSS
+	if (!TryInitDLSSLibrary())
+	{
+		UE_LOG(LogDLSSBlueprint, Error, TEXT("SetDLSSCameraHistoryId should not be called before PostEngineInit"));
+		return;
+	}
+
+	if (DLSSSRSupport != UDLSSSupport::Supported)
+	{
+		return;
+	}
+
+	FDLSSUpscaler::SetCameraHistoryId(PlayerIndex, CameraId);
+#endif
+}
+
+void UDLSSLibrary::ClearDLSSCameraHistories()
+{
+#if WITH_DLSS
+	if (!TryInitDLSSLibrary())
+	{
+		UE_LOG(LogDLSSBlueprint, Error, TEXT("ClearDLSSCameraHistories should not be called before PostEngineInit"));
+		return;
+	}
+
+	if (DLSSSRSupport != UDLSSSupport::Supported)
+	{
+		return;
+	}
+
+	FDLSSUpscaler::ClearCameraHistories();
+#endif
+}
+
 #if WITH_DLSS
 static UDLSSSupport ToUDLSSSupport(EDLSSSupport InDLSSSupport)
 {
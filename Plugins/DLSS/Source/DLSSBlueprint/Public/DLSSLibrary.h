@@ -152,6 +152,20 @@ public:
 	UFUNCTION(BlueprintPure, Category = "DLSS", meta = (DisplayName = "Get Default DLSS Mode"))
 	static DLSSBLUEPRINT_API UDLSSMode GetDefaultDLSSMode();
 
+	/**
+	 * Retain the DLSS history of the camera a player currently views through under CameraId, so that cutting back to that camera later (e.g. shot/reverse shot in a cinematic)
+	 * continues its history instead of restarting temporal convergence. Call it with a unique id per camera whenever the camera changes, e.g. from a Sequencer event track at each cut.
+	 * A history is only continued if the camera is still where it was when cut away from (r.NGX.DLSS.CameraHistory.MaxRestoreTranslation/MaxRestoreRotation), otherwise it gets reset.
+	 * PlayerIndex is the controller id of the local player, or -1 for views without a player such as Movie Render Queue. 'None' stops retaining histories for that player.
+	 * The number and memory of the retained histories are limited by r.NGX.DLSS.CameraHistory.MaxHistories and r.NGX.DLSS.CameraHistory.BudgetMB
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DLSS", meta = (DisplayName = "Set DLSS Camera History Id"))
+	static DLSSBLUEPRINT_API void SetDLSSCameraHistoryId(FName CameraId, int32 PlayerIndex = 0);
+
+	/** Release all DLSS histories retained by 'Set DLSS Camera History Id', e.g. at the end of a cinematic */
+	UFUNCTION(BlueprintCallable, Category = "DLSS", meta = (DisplayName = "Clear DLSS Camera Histories"))
+	static DLSSBLUEPRINT_API void ClearDLSSCameraHistories();
+
 private:
 	static UDLSSSupport DLSSSRSupport;
 	static UDLSSSupport DLSSRRSupport;
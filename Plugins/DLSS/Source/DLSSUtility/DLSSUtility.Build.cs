@@ -47,7 +47,8 @@ public class DLSSUtility : ModuleRules
 			{
 					"Engine",
 					"RHI",
-					"Projects"
+					"Projects",
+					"NVInputPassUtils",
 			}
 			);
 	}
@@ -10,6 +10,11 @@
 */
 
 #include "BiasCurrentColorPass.h"
+#include "DLSSAsyncCompute.h"
+#include "DLSSPersistentResources.h"
+
+#include "HAL/IConsoleManager.h"
+#include "RHIGPUReadback.h"
 #include "Runtime/Launch/Resources/Version.h"
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
 #include "DataDrivenShaderPlatformInfo.h"
@@ -20,16 +25,43 @@
 #include "RenderGraphUtils.h"
 #include "ScenePrivate.h"
 
+DEFINE_LOG_CATEGORY_STATIC(LogDLSSBiasCurrentColor, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("DLSS Bias Current Color"), STATGROUP_DLSSBiasCurrentColor, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Responsive Pixels"), STAT_DLSSBiasCurrentColorResponsivePixels, STATGROUP_DLSSBiasCurrentColor);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Responsive Tiles"), STAT_DLSSBiasCurrentColorResponsiveTiles, STATGROUP_DLSSBiasCurrentColor);
+DECLARE_DWORD_COUNTER_STAT(TEXT("View Pixels"), STAT_DLSSBiasCurrentColorViewPixels, STATGROUP_DLSSBiasCurrentColor);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Skipped Passes"), STAT_DLSSBiasCurrentColorSkippedPasses, STATGROUP_DLSSBiasCurrentColor);
+
+static TAutoConsoleVariable<int32> CVarNGXDLSSBiasCurrentColorMaskCompact(
+	TEXT("r.NGX.DLSS.BiasCurrentColorMask.Compact"),
+	1,
+	TEXT("Whether the DLSS bias current color mask is written as R8 instead of R16F, with only the 8x8 tiles containing a responsive pixel written after a clear (default = 1)\n")
+	TEXT("This also reads back the number of responsive pixels and tiles of each view into the STATGROUP_DLSSBiasCurrentColor counters. ")
+	TEXT("Views whose mask comes from the fused input prep pass (r.NGX.DLSS.InputPrep.Fused) write every pixel and aren't counted, nor skipped by EmptySkipInterval\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarNGXDLSSBiasCurrentColorMaskEmptySkipInterval(
+	TEXT("r.NGX.DLSS.BiasCurrentColorMask.EmptySkipInterval"),
+	0,
+	TEXT("With r.NGX.DLSS.BiasCurrentColorMask.Compact, once a view had no responsive pixels, only create its mask every N frames and pass a persistent cleared mask to DLSS in between. ")
+	TEXT("Responsive pixels that appear are then picked up N frames late at most, plus the readback latency (default = 0)\n")
+	TEXT("0: always create the mask\n"),
+	ECVF_RenderThreadSafe);
+
 const int32 kBiasCurrentColorComputeTileSizeX = FComputeShaderUtils::kGolden2DGroupSize;
 const int32 kBiasCurrentColorComputeTileSizeY = FComputeShaderUtils::kGolden2DGroupSize;
 
 
 class FDilateMotionVectorsDimTest : SHADER_PERMUTATION_BOOL("DILATE_MOTION_VECTORS");
+class FTileClassifiedBiasCurrentColorDim : SHADER_PERMUTATION_BOOL("TILE_CLASSIFIED_BIAS_CURRENT_COLOR");
 
 class FCreateBiasCurrentColorCS : public FGlobalShader
 {
 public:
-	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	using FPermutationDomain = TShaderPermutationDomain<FTileClassifiedBiasCurrentColorDim>;
+
+	static bool IsSupportedPlatform(const FGlobalShaderPermutationParameters& Parameters)
 	{
 		// Only cook for the platforms/RHIs where DLSS is supported, which is DX11, DX12 and Vulkan [on Win64]
 		return 	IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5) &&
@@ -37,6 +69,12 @@ public:
 				IsVulkanPlatform(Parameters.Platform) || IsD3DPlatform(Parameters.Platform));
 	}
 
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		// the tile classified permutation has its own entry point, see FCreateBiasCurrentColorTiledCS
+		return IsSupportedPlatform(Parameters) && !FPermutationDomain(Parameters.PermutationId).Get<FTileClassifiedBiasCurrentColorDim>();
+	}
+
 	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
 	{
 		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
@@ -59,92 +97,217 @@ public:
 		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D, OutBiasCurrentColorTexture)
 		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, BiasCurrentColor)
 
+		// TILE_CLASSIFIED_BIAS_CURRENT_COLOR only
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, OutMaskCoverageResults)
+
 		END_SHADER_PARAMETER_STRUCT()
 };
 
 
 IMPLEMENT_GLOBAL_SHADER(FCreateBiasCurrentColorCS, "/Plugin/DLSS/Private/CreateBiasCurrentColor.usf", "CreateBiasCurrentColorMain", SF_Compute);
 
-FRDGTextureRef AddBiasCurrentColorPass(
-	FRDGBuilder& GraphBuilder,
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
-	const FSceneView& View,
-#else
-	const FViewInfo& View,
-#endif
-	const FIntRect& InputViewRect,
-	FRDGTextureRef InSceneDepthTexture,
-	uint32 biasCurrentColorMaskCustomOffset
-)
+class FCreateBiasCurrentColorTiledCS : public FCreateBiasCurrentColorCS
 {
+public:
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsSupportedPlatform(Parameters) && FPermutationDomain(Parameters.PermutationId).Get<FTileClassifiedBiasCurrentColorDim>();
+	}
 
-	const FIntRect OutputViewRect = FIntRect(FIntPoint::ZeroValue, InputViewRect.Size());
-	
-	FRDGTextureDesc BiasCurrentColorDesc = FRDGTextureDesc::Create2D(
-		OutputViewRect.Size(),
-		PF_R16F,
-		FClearValueBinding::Black,
-		TexCreate_ShaderResource | TexCreate_UAV);
-	const TCHAR* OutputName = TEXT("DLSSBiasCurrentColor");
+	DECLARE_GLOBAL_SHADER(FCreateBiasCurrentColorTiledCS);
+	SHADER_USE_PARAMETER_STRUCT(FCreateBiasCurrentColorTiledCS, FCreateBiasCurrentColorCS);
+};
 
-	FRDGTextureRef BiasCurrentColorTexture = GraphBuilder.CreateTexture(BiasCurrentColorDesc, OutputName);
+IMPLEMENT_GLOBAL_SHADER(FCreateBiasCurrentColorTiledCS, "/Plugin/DLSS/Private/CreateBiasCurrentColor.usf", "CreateBiasCurrentColorTiledMain", SF_Compute);
 
-	FCreateBiasCurrentColorCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FCreateBiasCurrentColorCS::FParameters>();
+EPixelFormat GetBiasCurrentColorMaskFormat()
+{
+	// DLSS only tests the mask against 0, so 8 bits are plenty
+	return CVarNGXDLSSBiasCurrentColorMaskCompact.GetValueOnRenderThread() != 0 ? PF_R8 : PF_R16F;
+}
 
-	// input stencil
+// Reads back how many pixels and tiles of each view's mask are responsive, without ever waiting on the GPU, and remembers which views
+// had an empty mask for r.NGX.DLSS.BiasCurrentColorMask.EmptySkipInterval. Only the unfused pass feeds it, the fused input prep pass
+// writes the mask without tile classification. Render thread only, a global resource so the readbacks get freed at RHI shutdown
+class FBiasCurrentColorCoverageTracker : public FRenderResource
+{
+public:
+	static FBiasCurrentColorCoverageTracker& Get();
+
+	virtual void ReleaseRHI() override
 	{
-		PassParameters->StencilTexture = GraphBuilder.CreateSRV(FRDGTextureSRVDesc::CreateWithPixelFormat(InSceneDepthTexture, PF_X24_G8));
-		
-		FScreenPassTextureViewport depthStencilViewport(InSceneDepthTexture, InputViewRect);
-		FScreenPassTextureViewportParameters depthStencilViewportParameters = GetScreenPassTextureViewportParameters(depthStencilViewport);
-		PassParameters->DepthStencil = depthStencilViewportParameters;
+		for (FPendingReadback& Pending : PendingReadbacks)
+		{
+			Pending.Readback.Reset();
+			Pending.CoverageResults = nullptr;
+		}
+		FirstPendingReadback = 0;
+		NumPendingReadbacks = 0;
+		bReadbackQueued = false;
+		Views.Empty();
 	}
-	// input custom offset
+
+	bool ShouldSkipMask(uint32 ViewKey)
 	{
-		PassParameters->CustomOffset = biasCurrentColorMaskCustomOffset;
+		ProcessReadbacks();
+
+		FViewMask& Mask = Views.FindOrAdd(ViewKey);
+		Mask.LastUsedFrame = GFrameCounterRenderThread;
+
+		const uint64 SkipInterval = uint64(FMath::Max(0, CVarNGXDLSSBiasCurrentColorMaskEmptySkipInterval.GetValueOnRenderThread()));
+		return SkipInterval > 0 && Mask.bEmpty && GFrameCounterRenderThread < Mask.LastCreatedFrame + SkipInterval;
 	}
-	// output constructed DLSS BiasCurrentColorMask
+
+	// returns the buffer the tiled pass accumulates its counters in, or nullptr if no readback is available this frame
+	FRDGBufferRef AddCoverageReadback(FRDGBuilder& GraphBuilder, uint32 ViewKey, FIntPoint ViewSize)
 	{
-		PassParameters->OutBiasCurrentColorTexture = GraphBuilder.CreateUAV(BiasCurrentColorTexture);
+		FViewMask& Mask = Views.FindOrAdd(ViewKey);
+		Mask.LastCreatedFrame = GFrameCounterRenderThread;
 
-		FScreenPassTextureViewport BiasCurrentColorViewport(BiasCurrentColorTexture, OutputViewRect);
-		FScreenPassTextureViewportParameters BiasCurrentColorViewportParameters = GetScreenPassTextureViewportParameters(BiasCurrentColorViewport);
-		PassParameters->BiasCurrentColor = BiasCurrentColorViewportParameters;
+		FRDGBufferRef CoverageResults = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), NumCoverageResults), TEXT("DLSSBiasCurrentColorCoverage"));
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(CoverageResults, PF_R32_UINT), 0u);
+
+		// never wait on the GPU here, the counters just skip a frame
+		if (NumPendingReadbacks < MaxPendingReadbacks)
+		{
+			FPendingReadback& Pending = PendingReadbacks[(FirstPendingReadback + NumPendingReadbacks) % MaxPendingReadbacks];
+			if (!Pending.Readback.IsValid())
+			{
+				Pending.Readback = MakeUnique<FRHIGPUBufferReadback>(TEXT("DLSS.BiasCurrentColorCoverageReadback"));
+			}
+			Pending.ViewKey = ViewKey;
+			Pending.ViewSize = ViewSize;
+			Pending.CoverageResults = CoverageResults;
+			++NumPendingReadbacks;
+			bReadbackQueued = true;
+		}
+
+		RemoveStaleViews();
+		return CoverageResults;
 	}
-	const FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(View.GetFeatureLevel());
-	TShaderMapRef<FCreateBiasCurrentColorCS> ComputeShader(ShaderMap);
-
-	FComputeShaderUtils::AddPass(
-		GraphBuilder,
-		RDG_EVENT_NAME("Create BiasCurrentColorMask %s (%dx%d -> %dx%d)",
-			TEXT("BiasCurrentColor"),
-			InputViewRect.Width(), InputViewRect.Height(),
-			OutputViewRect.Width(), OutputViewRect.Height()
-		),
-		ComputeShader,
-		PassParameters,
-		FComputeShaderUtils::GetGroupCount(OutputViewRect.Size(), FComputeShaderUtils::kGolden2DGroupSize));
 
-	return BiasCurrentColorTexture;
+	// after the tiled pass got added
+	void EnqueueCopy(FRDGBuilder& GraphBuilder)
+	{
+		if (!bReadbackQueued)
+		{
+			return;
+		}
+
+		FPendingReadback& Pending = PendingReadbacks[(FirstPendingReadback + NumPendingReadbacks - 1) % MaxPendingReadbacks];
+		AddEnqueueCopyPass(GraphBuilder, Pending.Readback.Get(), Pending.CoverageResults, NumCoverageResults * sizeof(uint32));
+		Pending.CoverageResults = nullptr;
+		bReadbackQueued = false;
+	}
+
+private:
+	void ProcessReadbacks()
+	{
+		// readbacks complete in submission order, so stop at the first one that isn't ready yet
+		while (NumPendingReadbacks > 0 && PendingReadbacks[FirstPendingReadback].Readback->IsReady())
+		{
+			FPendingReadback& Pending = PendingReadbacks[FirstPendingReadback];
+
+			const uint32* Results = static_cast<const uint32*>(Pending.Readback->Lock(NumCoverageResults * sizeof(uint32)));
+			const uint32 NumResponsivePixels = Results[0];
+			const uint32 NumResponsiveTiles = Results[1];
+			Pending.Readback->Unlock();
+
+			INC_DWORD_STAT_BY(STAT_DLSSBiasCurrentColorResponsivePixels, NumResponsivePixels);
+			INC_DWORD_STAT_BY(STAT_DLSSBiasCurrentColorResponsiveTiles, NumResponsiveTiles);
+			INC_DWORD_STAT_BY(STAT_DLSSBiasCurrentColorViewPixels, Pending.ViewSize.X * Pending.ViewSize.Y);
+
+			UE_LOG(LogDLSSBiasCurrentColor, VeryVerbose, TEXT("View %u: %u responsive pixels (%.3f%%) in %u tiles"),
+				Pending.ViewKey, NumResponsivePixels, 100.0 * NumResponsivePixels / FMath::Max(1, Pending.ViewSize.X * Pending.ViewSize.Y), NumResponsiveTiles);
+
+			// the view may have been removed in the meantime
+			if (FViewMask* Mask = Views.Find(Pending.ViewKey))
+			{
+				Mask->bEmpty = NumResponsivePixels == 0;
+			}
+
+			FirstPendingReadback = (FirstPendingReadback + 1) % MaxPendingReadbacks;
+			--NumPendingReadbacks;
+		}
+	}
+
+	void RemoveStaleViews()
+	{
+		for (auto It = Views.CreateIterator(); It; ++It)
+		{
+			if (GFrameCounterRenderThread > It.Value().LastUsedFrame + StaleViewFrames)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	static constexpr int32 NumCoverageResults = 2;
+	static constexpr int32 MaxPendingReadbacks = 8;
+	static constexpr uint64 StaleViewFrames = 1000;
+
+	struct FViewMask
+	{
+		uint64 LastCreatedFrame = 0;
+		uint64 LastUsedFrame = 0;
+		bool bEmpty = false;
+	};
+
+	struct FPendingReadback
+	{
+		TUniquePtr<FRHIGPUBufferReadback> Readback;
+		// only valid between AddCoverageReadback and EnqueueCopy
+		FRDGBufferRef CoverageResults = nullptr;
+		uint32 ViewKey = 0;
+		FIntPoint ViewSize = FIntPoint::ZeroValue;
+	};
+
+	TMap<uint32, FViewMask> Views;
+
+	FPendingReadback PendingReadbacks[MaxPendingReadbacks];
+	int32 FirstPendingReadback = 0;
+	int32 NumPendingReadbacks = 0;
+	bool bReadbackQueued = false;
+};
+
+static TGlobalResource<FBiasCurrentColorCoverageTracker> GBiasCurrentColorCoverageTracker;
+
+FBiasCurrentColorCoverageTracker& FBiasCurrentColorCoverageTracker::Get()
+{
+	return GBiasCurrentColorCoverageTracker;
 }
 
-FRDGTextureRef AddBiasCurrentColorPass(
-	FRDGBuilder& GraphBuilder, 
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3 
-	const FSceneView & View, 
+static FRDGTextureRef AddBiasCurrentColorPassInternal(
+	FRDGBuilder& GraphBuilder,
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	const FSceneView& View,
 #else
-	const FViewInfo& View, 
+	const FViewInfo& View,
 #endif
-	const FIntRect& InputViewRect, 
-	struct FCustomDepthTextures CustomDepthTextures,
-	uint8 CustomOffset)
+	const FIntRect& InputViewRect,
+	FRDGTextureSRVRef StencilTexture,
+	FRDGTextureRef DepthStencilTexture,
+	uint32 CustomOffset)
 {
-	
 	const FIntRect OutputViewRect = FIntRect(FIntPoint::ZeroValue, InputViewRect.Size());
+	const bool bCompact = CVarNGXDLSSBiasCurrentColorMaskCompact.GetValueOnRenderThread() != 0;
+
+	FBiasCurrentColorCoverageTracker& Tracker = FBiasCurrentColorCoverageTracker::Get();
+	const uint32 ViewKey = View.GetViewKey();
+
+	if (bCompact && Tracker.ShouldSkipMask(ViewKey))
+	{
+		INC_DWORD_STAT(STAT_DLSSBiasCurrentColorSkippedPasses);
+
+		// all zero, so it only needs to cover the view rect with or without its offset. Quantized so views of similar sizes share it
+		const FIntPoint EmptyMaskExtent = FIntPoint::DivideAndRoundUp(InputViewRect.Max, 64) * 64;
+		const FRDGTextureDesc EmptyMaskDesc = FRDGTextureDesc::Create2D(EmptyMaskExtent, PF_R8, FClearValueBinding::Black, TexCreate_ShaderResource | TexCreate_RenderTargetable);
+		return FDLSSPersistentResources::Get().RegisterClearedTexture(GraphBuilder, TEXT("DLSS.BiasCurrentColor.Empty"), EmptyMaskDesc);
+	}
 
 	FRDGTextureDesc BiasCurrentColorDesc = FRDGTextureDesc::Create2D(
 		OutputViewRect.Size(),
-		PF_R16F,
+		GetBiasCurrentColorMaskFormat(),
 		FClearValueBinding::Black,
 		TexCreate_ShaderResource | TexCreate_UAV);
 	const TCHAR* OutputName = TEXT("DLSSBiasCurrentColor");
@@ -155,9 +318,9 @@ FRDGTextureRef AddBiasCurrentColorPass(
 
 	// input stencil
 	{
-		PassParameters->StencilTexture = CustomDepthTextures.Stencil; //GraphBuilder.CreateSRV(FRDGTextureSRVDesc::CreateWithPixelFormat(InSceneDepthTexture, PF_X24_G8));
+		PassParameters->StencilTexture = StencilTexture;
 
-		FScreenPassTextureViewport DepthStencilViewport(CustomDepthTextures.Depth, InputViewRect);
+		FScreenPassTextureViewport DepthStencilViewport(DepthStencilTexture, InputViewRect);
 		FScreenPassTextureViewportParameters DepthStencilViewportParameters = GetScreenPassTextureViewportParameters(DepthStencilViewport);
 		PassParameters->DepthStencil = DepthStencilViewportParameters;
 	}
@@ -167,26 +330,98 @@ FRDGTextureRef AddBiasCurrentColorPass(
 	}
 	// output constructed DLSS BiasCurrentColorMask
 	{
-		PassParameters->OutBiasCurrentColorTexture = GraphBuilder.CreateUAV(BiasCurrentColorTexture);
+		FRDGTextureUAVRef BiasCurrentColorUAV = GraphBuilder.CreateUAV(BiasCurrentColorTexture);
+		PassParameters->OutBiasCurrentColorTexture = BiasCurrentColorUAV;
 
 		FScreenPassTextureViewport BiasCurrentColorViewport(BiasCurrentColorTexture, OutputViewRect);
 		FScreenPassTextureViewportParameters BiasCurrentColorViewportParameters = GetScreenPassTextureViewportParameters(BiasCurrentColorViewport);
 		PassParameters->BiasCurrentColor = BiasCurrentColorViewportParameters;
+
+		// the tiles without responsive pixels don't get written
+		if (bCompact)
+		{
+			AddClearUAVPass(GraphBuilder, BiasCurrentColorUAV, 0.0f);
+			PassParameters->OutMaskCoverageResults = GraphBuilder.CreateUAV(Tracker.AddCoverageReadback(GraphBuilder, ViewKey, OutputViewRect.Size()), PF_R32_UINT);
+		}
 	}
 	const FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(View.GetFeatureLevel());
-	TShaderMapRef<FCreateBiasCurrentColorCS> ComputeShader(ShaderMap);
-
-	FComputeShaderUtils::AddPass(
-		GraphBuilder,
-		RDG_EVENT_NAME("Create BiasCurrentColorMask %s (%dx%d -> %dx%d)",
-			TEXT("BiasCurrentColor"),
-			InputViewRect.Width(), InputViewRect.Height(),
-			OutputViewRect.Width(), OutputViewRect.Height()
-		),
-		ComputeShader,
-		PassParameters,
-		FComputeShaderUtils::GetGroupCount(OutputViewRect.Size(), FComputeShaderUtils::kGolden2DGroupSize));
+
+	FCreateBiasCurrentColorCS::FPermutationDomain PermutationVector;
+	PermutationVector.Set<FTileClassifiedBiasCurrentColorDim>(bCompact);
+
+	const FIntVector GroupCount = FComputeShaderUtils::GetGroupCount(OutputViewRect.Size(), FComputeShaderUtils::kGolden2DGroupSize);
+	if (bCompact)
+	{
+		TShaderMapRef<FCreateBiasCurrentColorTiledCS> ComputeShader(ShaderMap, PermutationVector);
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("Create BiasCurrentColorMask %s (%dx%d -> %dx%d)",
+				TEXT("BiasCurrentColor Tiled"),
+				InputViewRect.Width(), InputViewRect.Height(),
+				OutputViewRect.Width(), OutputViewRect.Height()
+			),
+			GetDLSSComputePassFlags(EDLSSComputePass::BiasCurrentColor),
+			ComputeShader,
+			PassParameters,
+			GroupCount);
+
+		Tracker.EnqueueCopy(GraphBuilder);
+	}
+	else
+	{
+		TShaderMapRef<FCreateBiasCurrentColorCS> ComputeShader(ShaderMap, PermutationVector);
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("Create BiasCurrentColorMask %s (%dx%d -> %dx%d)",
+				TEXT("BiasCurrentColor"),
+				InputViewRect.Width(), InputViewRect.Height(),
+				OutputViewRect.Width(), OutputViewRect.Height()
+			),
+			GetDLSSComputePassFlags(EDLSSComputePass::BiasCurrentColor),
+			ComputeShader,
+			PassParameters,
+			GroupCount);
+	}
 
 	return BiasCurrentColorTexture;
+}
 
+
+FRDGTextureRef AddBiasCurrentColorPass(
+	FRDGBuilder& GraphBuilder,
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	const FSceneView& View,
+#else
+	const FViewInfo& View,
+#endif
+	const FIntRect& InputViewRect,
+	FRDGTextureRef InSceneDepthTexture,
+	uint32 biasCurrentColorMaskCustomOffset
+)
+{
+	return AddBiasCurrentColorPassInternal(
+		GraphBuilder, View,
+		InputViewRect,
+		GraphBuilder.CreateSRV(FRDGTextureSRVDesc::CreateWithPixelFormat(InSceneDepthTexture, PF_X24_G8)),
+		InSceneDepthTexture,
+		biasCurrentColorMaskCustomOffset);
+}
+
+FRDGTextureRef AddBiasCurrentColorPass(
+	FRDGBuilder& GraphBuilder, 
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3 
+	const FSceneView & View, 
+#else
+	const FViewInfo& View, 
+#endif
+	const FIntRect& InputViewRect, 
+	struct FCustomDepthTextures CustomDepthTextures,
+	uint8 CustomOffset)
+{
+	return AddBiasCurrentColorPassInternal(
+		GraphBuilder, View,
+		InputViewRect,
+		CustomDepthTextures.Stencil,
+		CustomDepthTextures.Depth,
+		CustomOffset);
 }
@@ -0,0 +1,79 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "DLSSAsyncCompute.h"
+#include "NVInputPassUtils.h"
+
+#include "HAL/IConsoleManager.h"
+#include "RenderingThread.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDLSSAsyncCompute, Log, All);
+
+static TAutoConsoleVariable<int32> CVarNGXDLSSAsyncCompute(
+	TEXT("r.NGX.DLSS.AsyncCompute"),
+	0,
+	TEXT("Whether the DLSS input passes listed in r.NGX.DLSS.AsyncCompute.Passes get added as async compute passes (default = 0)\n")
+	TEXT("They only overlap with graphics work if the RHI supports async compute and r.RDG.AsyncCompute is enabled\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<FString> CVarNGXDLSSAsyncComputePasses(
+	TEXT("r.NGX.DLSS.AsyncCompute.Passes"),
+	TEXT("VelocityCombine,BiasCurrentColor,InputPrep,GBufferResolve"),
+	TEXT("Comma separated list of the DLSS input passes r.NGX.DLSS.AsyncCompute applies to. Can be set per project or platform in the [SystemSettings] ini section\n")
+	TEXT("Valid names: VelocityCombine, BiasCurrentColor, InputPrep, GBufferResolve (default = VelocityCombine,BiasCurrentColor,InputPrep,GBufferResolve)\n"),
+	ECVF_RenderThreadSafe);
+
+static const TCHAR* const GDLSSComputePassNames[] =
+{
+	TEXT("VelocityCombine"),
+	TEXT("BiasCurrentColor"),
+	TEXT("InputPrep"),
+	TEXT("GBufferResolve"),
+};
+static_assert(UE_ARRAY_COUNT(GDLSSComputePassNames) == uint32(EDLSSComputePass::Num), "GDLSSComputePassNames does not match EDLSSComputePass");
+
+namespace
+{
+	// r.NGX.DLSS.AsyncCompute.Passes parsed into one bit per EDLSSComputePass. Render thread only
+	TNVAsyncComputePolicy<EDLSSComputePass> GDLSSAsyncComputePolicy(GDLSSComputePassNames);
+
+	void UpdateDLSSAsyncComputePolicy()
+	{
+		if (GDLSSAsyncComputePolicy.Update(CVarNGXDLSSAsyncComputePasses.GetValueOnRenderThread()))
+		{
+			for (const FString& UnknownPass : GDLSSAsyncComputePolicy.GetUnknownPasses())
+			{
+				UE_LOG(LogDLSSAsyncCompute, Warning, TEXT("Ignoring unknown pass '%s' in r.NGX.DLSS.AsyncCompute.Passes"), *UnknownPass);
+			}
+		}
+	}
+}
+
+const TCHAR* GetDLSSComputePassName(EDLSSComputePass Pass)
+{
+	return GDLSSComputePassNames[int32(Pass)];
+}
+
+ERDGPassFlags GetDLSSComputePassFlags(EDLSSComputePass Pass)
+{
+	check(IsInRenderingThread());
+
+	if (CVarNGXDLSSAsyncCompute.GetValueOnRenderThread() != 0)
+	{
+		UpdateDLSSAsyncComputePolicy();
+		if (GDLSSAsyncComputePolicy.IsAsync(Pass))
+		{
+			return ERDGPassFlags::AsyncCompute;
+		}
+	}
+
+	return ERDGPassFlags::Compute;
+}
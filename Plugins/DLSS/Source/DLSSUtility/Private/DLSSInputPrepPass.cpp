@@ -0,0 +1,587 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "DLSSInputPrepPass.h"
+#include "BiasCurrentColorPass.h"
+#include "DLSSAsyncCompute.h"
+
+#include "HAL/IConsoleManager.h"
+#include "RenderGraphUtils.h"
+#include "Runtime/Launch/Resources/Version.h"
+#if __has_include("DataDrivenShaderPlatformInfo.h")
+#include "DataDrivenShaderPlatformInfo.h"
+#endif
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+#include "PostProcess/SceneRenderTargets.h"
+#endif
+#include "SceneRendering.h"
+#include "SceneTextureParameters.h"
+#include "ScenePrivate.h"
+#include "SystemTextures.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDLSSInputPrep, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("DLSS Input Prep"), STATGROUP_DLSSInputPrep, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Fused Pass Setup"), STAT_DLSSInputPrepSetup, STATGROUP_DLSSInputPrep);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fused Views"), STAT_DLSSInputPrepFusedViews, STATGROUP_DLSSInputPrep);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Views"), STAT_DLSSInputPrepBatchedViews, STATGROUP_DLSSInputPrep);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dispatches"), STAT_DLSSInputPrepDispatches, STATGROUP_DLSSInputPrep);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dispatches (Other Choice)"), STAT_DLSSInputPrepOtherDispatches, STATGROUP_DLSSInputPrep);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shared Inputs Read (KB)"), STAT_DLSSInputPrepKBRead, STATGROUP_DLSSInputPrep);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shared Inputs Read (KB, Other Choice)"), STAT_DLSSInputPrepOtherKBRead, STATGROUP_DLSSInputPrep);
+
+DECLARE_GPU_STAT(DLSSInputPrep);
+
+static TAutoConsoleVariable<int32> CVarNGXDLSSInputPrepFused(
+	TEXT("r.NGX.DLSS.InputPrep.Fused"),
+	1,
+	TEXT("Whether the DLSS bias current color, velocity combine and, for DLSS-RR, GBuffer resolve passes get fused into a single dispatch (default = 1)\n")
+	TEXT("Falls back to the separate passes with dilated motion vectors and with engine provided guide buffers\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarNGXDLSSInputPrepBatchViews(
+	TEXT("r.NGX.DLSS.InputPrep.BatchViews"),
+	1,
+	TEXT("Whether the fused DLSS input preparation of all views of a family, e.g. both eyes with instanced stereo or split screen, happens in a single dispatch (default = 1)\n")
+	TEXT("Only without the DLSS-RR GBuffer resolve, which needs the full view uniform buffer of each view. Compare with r.NGX.DLSS.InputPrep.LogStats and stat GPU\n"),
+	ECVF_RenderThreadSafe);
+
+const int32 kDLSSInputPrepComputeTileSizeX = FComputeShaderUtils::kGolden2DGroupSize;
+const int32 kDLSSInputPrepComputeTileSizeY = FComputeShaderUtils::kGolden2DGroupSize;
+
+// DLSSInputPrep.usf has an output slot per batched view
+static_assert(kDLSSInputPrepMaxBatchedViews == 4, "update the batched view outputs in DLSSInputPrep.usf and FDLSSInputPrepCS");
+
+static void AccumulateDLSSInputPrepSetupCycles(uint64 Cycles);
+
+class FInputPrepAlternateMotionVectorDim : SHADER_PERMUTATION_BOOL("SUPPORT_ALTERNATE_MOTION_VECTOR");
+class FInputPrepBiasCurrentColorDim : SHADER_PERMUTATION_BOOL("BIAS_CURRENT_COLOR");
+class FInputPrepGBufferResolveDim : SHADER_PERMUTATION_BOOL("GBUFFER_RESOLVE");
+class FInputPrepDisableSubsurfaceCheckerboardDim : SHADER_PERMUTATION_BOOL("FORCE_DISABLE_SUBSURFACE_CHECKERBOARD");
+class FInputPrepBatchedViewsDim : SHADER_PERMUTATION_BOOL("BATCHED_VIEWS");
+
+class FDLSSInputPrepCS : public FGlobalShader
+{
+public:
+	using FPermutationDomain = TShaderPermutationDomain<FInputPrepAlternateMotionVectorDim, FInputPrepBiasCurrentColorDim, FInputPrepGBufferResolveDim, FInputPrepDisableSubsurfaceCheckerboardDim, FInputPrepBatchedViewsDim>;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		FPermutationDomain PermutationVector(Parameters.PermutationId);
+
+		// the checkerboard only matters for the GBuffer resolve
+		if (!PermutationVector.Get<FInputPrepGBufferResolveDim>() && PermutationVector.Get<FInputPrepDisableSubsurfaceCheckerboardDim>())
+		{
+			return false;
+		}
+
+		// the GBuffer resolve reads the view uniform buffer, of which only the first view would be bound
+		if (PermutationVector.Get<FInputPrepBatchedViewsDim>() && PermutationVector.Get<FInputPrepGBufferResolveDim>())
+		{
+			return false;
+		}
+
+		// Only cook for the platforms/RHIs where DLSS is supported, which is DX11,DX12 and Vulkan [on Win64]
+		return 	IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5) &&
+				IsPCPlatform(Parameters.Platform) && (
+					IsVulkanPlatform(Parameters.Platform) ||
+					IsD3DPlatform(Parameters.Platform));
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEX"), kDLSSInputPrepComputeTileSizeX);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEY"), kDLSSInputPrepComputeTileSizeY);
+		OutEnvironment.SetDefine(TEXT("STENCIL_MASK"), STENCIL_TEMPORAL_RESPONSIVE_AA_MASK);
+		OutEnvironment.SetDefine(TEXT("MAX_BATCHED_VIEWS"), kDLSSInputPrepMaxBatchedViews);
+	}
+
+	DECLARE_GLOBAL_SHADER(FDLSSInputPrepCS);
+	SHADER_USE_PARAMETER_STRUCT(FDLSSInputPrepCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_STRUCT_REF(FViewUniformShaderParameters, View)
+
+		// velocity combine, see FVelocityCombineCS
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, VelocityTexture)
+		SHADER_PARAMETER_SAMPLER(SamplerState, VelocityTextureSampler)
+		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, Velocity)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, DepthTexture)
+		SHADER_PARAMETER_SAMPLER(SamplerState, DepthTextureSampler)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float2>, AlternateMotionVectorsTexture)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D, OutVelocityCombinedTexture)
+		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, CombinedVelocity)
+
+		// bias current color, see FCreateBiasCurrentColorCS
+		SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture2D, StencilTexture)
+		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, DepthStencil)
+		SHADER_PARAMETER(int, CustomOffset)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D, OutBiasCurrentColorTexture)
+		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, BiasCurrentColor)
+
+		// GBuffer resolve, see FGBufferResolvePS
+		SHADER_PARAMETER_STRUCT_INCLUDE(FSceneTextureShaderParameters, SceneTextures)
+		SHADER_PARAMETER_TEXTURE(Texture2D, PreIntegratedGF)
+		SHADER_PARAMETER_SAMPLER(SamplerState, PreIntegratedGFSampler)
+		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, InputViewPort)
+		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, OutputViewPort)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D, OutDiffuseAlbedoTexture)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D, OutSpecularAlbedoTexture)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D, OutNormalTexture)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D, OutRoughnessTexture)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D, OutLinearDepthTexture)
+
+		// batched views, the outputs of the first view are the ones above
+		SHADER_PARAMETER_ARRAY(FIntVector4, BatchedInputViewRect, [kDLSSInputPrepMaxBatchedViews])
+		SHADER_PARAMETER_ARRAY(FVector4f, BatchedViewSizeAndInvSize, [kDLSSInputPrepMaxBatchedViews])
+		SHADER_PARAMETER_ARRAY(FMatrix44f, BatchedClipToPrevClip, [kDLSSInputPrepMaxBatchedViews])
+		SHADER_PARAMETER(FVector2f, BatchedVelocityExtent)
+		SHADER_PARAMETER(FVector2f, BatchedDepthStencilExtent)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D, OutVelocityCombinedTexture1)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D, OutVelocityCombinedTexture2)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D, OutVelocityCombinedTexture3)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D, OutBiasCurrentColorTexture1)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D, OutBiasCurrentColorTexture2)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D, OutBiasCurrentColorTexture3)
+	END_SHADER_PARAMETER_STRUCT()
+};
+
+IMPLEMENT_GLOBAL_SHADER(FDLSSInputPrepCS, "/Plugin/DLSS/Private/DLSSInputPrep.usf", "DLSSInputPrepMain", SF_Compute);
+
+bool CanUseDLSSInputPrepPass(
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	const ITemporalUpscaler::FInputs& PassInputs,
+#endif
+	bool bDilateMotionVectors,
+	bool bResolveGBuffer
+)
+{
+	// dilated motion vectors are at output resolution, the other inputs at render resolution
+	if (CVarNGXDLSSInputPrepFused.GetValueOnRenderThread() == 0 || bDilateMotionVectors)
+	{
+		return false;
+	}
+
+	// the fused GBuffer resolve only implements the path that decodes the scene GBuffer
+#if SUPPORT_GUIDE_GBUFFER
+	const bool bPrecomposite =
+		PassInputs.GuideBuffers.DiffuseGuideBuffer.IsValid() &&
+		PassInputs.GuideBuffers.SpecularGuideBuffer.IsValid() &&
+		PassInputs.GuideBuffers.NormalRoughnessGuideBuffer.IsValid() &&
+		PassInputs.GuideBuffers.DepthGuideBuffer.IsValid();
+
+	if (bResolveGBuffer && (bPrecomposite || PassInputs.GuideBuffers.ReflectionHitDistance.IsValid()))
+	{
+		return false;
+	}
+#endif
+
+#if SUPPORT_GUIDE_SSS_DOF
+	if (bResolveGBuffer && (PassInputs.GuideBuffers.SSSGuideBuffer.IsValid() || PassInputs.GuideBuffers.DOFGuideBuffer.IsValid()))
+	{
+		return false;
+	}
+#endif
+
+	return true;
+}
+
+FDLSSInputPrepOutputs AddDLSSInputPrepPass(
+	FRDGBuilder& GraphBuilder,
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	const FSceneView& View,
+#else
+	const FViewInfo& View,
+#endif
+	FRDGTextureRef InSceneDepthTexture,
+	FRDGTextureRef InVelocityTexture,
+	FRDGTextureRef AlternateMotionVectorTexture,
+	const FCustomDepthTextures& CustomDepthTextures,
+	uint8 BiasCurrentColorMaskCustomOffset,
+	FIntRect InputViewRect,
+	bool bResolveGBuffer
+)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DLSSInputPrepSetup);
+	const uint64 SetupStartCycles = FPlatformTime::Cycles64();
+	RDG_GPU_STAT_SCOPE(GraphBuilder, DLSSInputPrep);
+
+	FDLSSInputPrepOutputs Outputs;
+
+	// every output covers the input view rect, shifted to the top left corner
+	const FIntRect OutputViewRect = FIntRect(FIntPoint::ZeroValue, InputViewRect.Size());
+	const FIntPoint OutputExtent = OutputViewRect.Size();
+
+	const bool bHasAlternateMotionVectors = AlternateMotionVectorTexture != nullptr;
+	const bool bHasBiasCurrentColor = CustomDepthTextures.IsValid() && CustomDepthTextures.Stencil != nullptr;
+
+	FDLSSInputPrepCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FDLSSInputPrepCS::FParameters>();
+	PassParameters->View = View.ViewUniformBuffer;
+
+	// velocity combine
+	{
+		PassParameters->VelocityTexture = InVelocityTexture;
+		PassParameters->VelocityTextureSampler = TStaticSamplerState<SF_Point>::GetRHI();
+
+		// we use InSceneDepthTexture here and not InVelocityTexture since the latter can be a 1x1 black texture
+		check(InVelocityTexture->Desc.Extent == FIntPoint(1, 1) || InVelocityTexture->Desc.Extent == InSceneDepthTexture->Desc.Extent);
+		PassParameters->Velocity = GetScreenPassTextureViewportParameters(FScreenPassTextureViewport(InSceneDepthTexture, InputViewRect));
+
+		PassParameters->DepthTexture = InSceneDepthTexture;
+		PassParameters->DepthTextureSampler = TStaticSamplerState<SF_Point>::GetRHI();
+		PassParameters->AlternateMotionVectorsTexture = AlternateMotionVectorTexture;
+
+		Outputs.CombinedVelocity = GraphBuilder.CreateTexture(
+			FRDGTextureDesc::Create2D(OutputExtent, PF_G16R16F, FClearValueBinding::Black, TexCreate_ShaderResource | TexCreate_UAV),
+			TEXT("DLSSCombinedVelocity"));
+		PassParameters->OutVelocityCombinedTexture = GraphBuilder.CreateUAV(Outputs.CombinedVelocity);
+		PassParameters->CombinedVelocity = GetScreenPassTextureViewportParameters(FScreenPassTextureViewport(Outputs.CombinedVelocity, OutputViewRect));
+	}
+
+	// bias current color
+	if (bHasBiasCurrentColor)
+	{
+		PassParameters->StencilTexture = CustomDepthTextures.Stencil;
+		PassParameters->DepthStencil = GetScreenPassTextureViewportParameters(FScreenPassTextureViewport(CustomDepthTextures.Depth, InputViewRect));
+		PassParameters->CustomOffset = BiasCurrentColorMaskCustomOffset;
+
+		Outputs.BiasCurrentColor = GraphBuilder.CreateTexture(
+			FRDGTextureDesc::Create2D(OutputExtent, GetBiasCurrentColorMaskFormat(), FClearValueBinding::Black, TexCreate_ShaderResource | TexCreate_UAV),
+			TEXT("DLSSBiasCurrentColor"));
+		PassParameters->OutBiasCurrentColorTexture = GraphBuilder.CreateUAV(Outputs.BiasCurrentColor);
+		PassParameters->BiasCurrentColor = GetScreenPassTextureViewportParameters(FScreenPassTextureViewport(Outputs.BiasCurrentColor, OutputViewRect));
+	}
+
+	// GBuffer resolve, same formats as AddGBufferResolvePass, but written as UAVs
+	bool bDisableSubsurfaceCheckerboard = false;
+	if (bResolveGBuffer)
+	{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		PassParameters->SceneTextures = CreateSceneTextureShaderParameters(GraphBuilder, View, ESceneTextureSetupMode::All);
+#else
+		PassParameters->SceneTextures = CreateSceneTextureShaderParameters(GraphBuilder, View.GetSceneTexturesChecked(), View.GetFeatureLevel(), ESceneTextureSetupMode::All);
+#endif
+		PassParameters->PreIntegratedGF = GSystemTextures.PreintegratedGF->GetRHI();
+		PassParameters->PreIntegratedGFSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+		PassParameters->InputViewPort = GetScreenPassTextureViewportParameters(FScreenPassTextureViewport(InputViewRect));
+		PassParameters->OutputViewPort = GetScreenPassTextureViewportParameters(FScreenPassTextureViewport(OutputExtent));
+
+		auto CreateOutput = [&GraphBuilder, OutputExtent](EPixelFormat Format, const TCHAR* Name)
+		{
+			return GraphBuilder.CreateTexture(FRDGTextureDesc::Create2D(OutputExtent, Format, FClearValueBinding::None, TexCreate_ShaderResource | TexCreate_UAV), Name);
+		};
+
+		FGBufferResolveOutputs& ResolvedGBuffer = Outputs.ResolvedGBuffer;
+		ResolvedGBuffer.DiffuseAlbedo = CreateOutput(PF_FloatR11G11B10, TEXT("DLSS.DiffuseAlbedo"));
+		ResolvedGBuffer.SpecularAlbedo = CreateOutput(PF_FloatR11G11B10, TEXT("DLSS.SpecularAlbedo"));
+		ResolvedGBuffer.Normals = CreateOutput(PF_FloatRGBA, TEXT("DLSS.Normal"));
+		ResolvedGBuffer.Roughness = CreateOutput(PF_R32_FLOAT, TEXT("DLSS.Roughness"));
+		ResolvedGBuffer.LinearDepth = CreateOutput(PF_R32_FLOAT, TEXT("DLSS.Depth"));
+
+		PassParameters->OutDiffuseAlbedoTexture = GraphBuilder.CreateUAV(ResolvedGBuffer.DiffuseAlbedo);
+		PassParameters->OutSpecularAlbedoTexture = GraphBuilder.CreateUAV(ResolvedGBuffer.SpecularAlbedo);
+		PassParameters->OutNormalTexture = GraphBuilder.CreateUAV(ResolvedGBuffer.Normals);
+		PassParameters->OutRoughnessTexture = GraphBuilder.CreateUAV(ResolvedGBuffer.Roughness);
+		PassParameters->OutLinearDepthTexture = GraphBuilder.CreateUAV(ResolvedGBuffer.LinearDepth);
+
+		static const auto CVarDisableSubsurfaceCheckerboard = IConsoleManager::Get().FindConsoleVariable(TEXT("r.NGX.DLSS.DisableSubsurfaceCheckerboard"));
+		bDisableSubsurfaceCheckerboard = CVarDisableSubsurfaceCheckerboard && CVarDisableSubsurfaceCheckerboard->GetBool();
+	}
+
+	FDLSSInputPrepCS::FPermutationDomain PermutationVector;
+	PermutationVector.Set<FInputPrepAlternateMotionVectorDim>(bHasAlternateMotionVectors);
+	PermutationVector.Set<FInputPrepBiasCurrentColorDim>(bHasBiasCurrentColor);
+	PermutationVector.Set<FInputPrepGBufferResolveDim>(bResolveGBuffer);
+	PermutationVector.Set<FInputPrepDisableSubsurfaceCheckerboardDim>(bDisableSubsurfaceCheckerboard);
+
+	const FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(View.GetFeatureLevel());
+	TShaderMapRef<FDLSSInputPrepCS> ComputeShader(ShaderMap, PermutationVector);
+
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("DLSS Input Prep%s%s%s (%dx%d)",
+			bHasAlternateMotionVectors ? TEXT(" AlternateMotionVectors") : TEXT(" SceneMotionVectors"),
+			bHasBiasCurrentColor ? TEXT(" BiasCurrentColor") : TEXT(""),
+			bResolveGBuffer ? TEXT(" GBufferResolve") : TEXT(""),
+			InputViewRect.Width(), InputViewRect.Height()
+		),
+		GetDLSSComputePassFlags(EDLSSComputePass::InputPrep),
+		ComputeShader,
+		PassParameters,
+		FComputeShaderUtils::GetGroupCount(OutputExtent, FIntPoint(kDLSSInputPrepComputeTileSizeX, kDLSSInputPrepComputeTileSizeY)));
+
+	AccumulateDLSSInputPrepSetupCycles(FPlatformTime::Cycles64() - SetupStartCycles);
+	return Outputs;
+}
+
+TArray<FDLSSInputPrepOutputs> AddDLSSInputPrepBatchedPass(
+	FRDGBuilder& GraphBuilder,
+	TConstArrayView<const FSceneView*> Views,
+	FRDGTextureRef InSceneDepthTexture,
+	FRDGTextureRef InVelocityTexture,
+	FRDGTextureRef AlternateMotionVectorTexture,
+	const FCustomDepthTextures& CustomDepthTextures,
+	uint8 BiasCurrentColorMaskCustomOffset
+)
+{
+	TArray<FDLSSInputPrepOutputs> Outputs;
+
+	if (CVarNGXDLSSInputPrepBatchViews.GetValueOnRenderThread() == 0 || Views.Num() < 2 || Views.Num() > kDLSSInputPrepMaxBatchedViews)
+	{
+		return Outputs;
+	}
+
+	// the per view constants come from the CPU copy of each view's uniform buffer
+	for (const FSceneView* View : Views)
+	{
+		if (!View->bIsViewInfo || !static_cast<const FViewInfo*>(View)->CachedViewUniformShaderParameters.IsValid())
+		{
+			return Outputs;
+		}
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_DLSSInputPrepSetup);
+	const uint64 SetupStartCycles = FPlatformTime::Cycles64();
+	RDG_GPU_STAT_SCOPE(GraphBuilder, DLSSInputPrep);
+
+	const FViewInfo& FirstView = *static_cast<const FViewInfo*>(Views[0]);
+	const bool bHasAlternateMotionVectors = AlternateMotionVectorTexture != nullptr;
+	const bool bHasBiasCurrentColor = CustomDepthTextures.IsValid() && CustomDepthTextures.Stencil != nullptr;
+
+	FDLSSInputPrepCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FDLSSInputPrepCS::FParameters>();
+	// the per pixel code reads the view dependent values from the batched constants below instead
+	PassParameters->View = FirstView.ViewUniformBuffer;
+
+	// shared inputs
+	{
+		check(InVelocityTexture->Desc.Extent == FIntPoint(1, 1) || InVelocityTexture->Desc.Extent == InSceneDepthTexture->Desc.Extent);
+		PassParameters->VelocityTexture = InVelocityTexture;
+		PassParameters->VelocityTextureSampler = TStaticSamplerState<SF_Point>::GetRHI();
+		PassParameters->DepthTexture = InSceneDepthTexture;
+		PassParameters->DepthTextureSampler = TStaticSamplerState<SF_Point>::GetRHI();
+		PassParameters->AlternateMotionVectorsTexture = AlternateMotionVectorTexture;
+		PassParameters->BatchedVelocityExtent = FVector2f(InSceneDepthTexture->Desc.Extent);
+
+		if (bHasBiasCurrentColor)
+		{
+			PassParameters->StencilTexture = CustomDepthTextures.Stencil;
+			PassParameters->CustomOffset = BiasCurrentColorMaskCustomOffset;
+			PassParameters->BatchedDepthStencilExtent = FVector2f(CustomDepthTextures.Depth->Desc.Extent);
+		}
+	}
+
+	FRDGTextureUAVRef* VelocityUAVs[] = { &PassParameters->OutVelocityCombinedTexture, &PassParameters->OutVelocityCombinedTexture1, &PassParameters->OutVelocityCombinedTexture2, &PassParameters->OutVelocityCombinedTexture3 };
+	FRDGTextureUAVRef* BiasCurrentColorUAVs[] = { &PassParameters->OutBiasCurrentColorTexture, &PassParameters->OutBiasCurrentColorTexture1, &PassParameters->OutBiasCurrentColorTexture2, &PassParameters->OutBiasCurrentColorTexture3 };
+
+	FIntPoint MaxViewSize = FIntPoint::ZeroValue;
+
+	// per view constants and outputs
+	Outputs.SetNum(Views.Num());
+	for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
+	{
+		const FViewInfo& View = *static_cast<const FViewInfo*>(Views[ViewIndex]);
+		const FIntRect InputViewRect = View.ViewRect;
+		const FIntPoint OutputExtent = InputViewRect.Size();
+		MaxViewSize = MaxViewSize.ComponentMax(OutputExtent);
+
+		PassParameters->BatchedInputViewRect[ViewIndex] = FIntVector4(InputViewRect.Min.X, InputViewRect.Min.Y, InputViewRect.Max.X, InputViewRect.Max.Y);
+		PassParameters->BatchedViewSizeAndInvSize[ViewIndex] = View.CachedViewUniformShaderParameters->ViewSizeAndInvSize;
+		PassParameters->BatchedClipToPrevClip[ViewIndex] = View.CachedViewUniformShaderParameters->ClipToPrevClip;
+
+		FDLSSInputPrepOutputs& ViewOutputs = Outputs[ViewIndex];
+		ViewOutputs.CombinedVelocity = GraphBuilder.CreateTexture(
+			FRDGTextureDesc::Create2D(OutputExtent, PF_G16R16F, FClearValueBinding::Black, TexCreate_ShaderResource | TexCreate_UAV),
+			TEXT("DLSSCombinedVelocity"));
+		*VelocityUAVs[ViewIndex] = GraphBuilder.CreateUAV(ViewOutputs.CombinedVelocity);
+
+		if (bHasBiasCurrentColor)
+		{
+			ViewOutputs.BiasCurrentColor = GraphBuilder.CreateTexture(
+				FRDGTextureDesc::Create2D(OutputExtent, GetBiasCurrentColorMaskFormat(), FClearValueBinding::Black, TexCreate_ShaderResource | TexCreate_UAV),
+				TEXT("DLSSBiasCurrentColor"));
+			*BiasCurrentColorUAVs[ViewIndex] = GraphBuilder.CreateUAV(ViewOutputs.BiasCurrentColor);
+		}
+	}
+
+	// the shader branches on the view index, so the unused slots are never written and just need something bound
+	for (int32 ViewIndex = Views.Num(); ViewIndex < kDLSSInputPrepMaxBatchedViews; ++ViewIndex)
+	{
+		*VelocityUAVs[ViewIndex] = PassParameters->OutVelocityCombinedTexture;
+		*BiasCurrentColorUAVs[ViewIndex] = PassParameters->OutBiasCurrentColorTexture;
+	}
+
+	FDLSSInputPrepCS::FPermutationDomain PermutationVector;
+	PermutationVector.Set<FInputPrepAlternateMotionVectorDim>(bHasAlternateMotionVectors);
+	PermutationVector.Set<FInputPrepBiasCurrentColorDim>(bHasBiasCurrentColor);
+	PermutationVector.Set<FInputPrepBatchedViewsDim>(true);
+
+	const FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(FirstView.GetFeatureLevel());
+	TShaderMapRef<FDLSSInputPrepCS> ComputeShader(ShaderMap, PermutationVector);
+
+	FIntVector GroupCount = FComputeShaderUtils::GetGroupCount(MaxViewSize, FIntPoint(kDLSSInputPrepComputeTileSizeX, kDLSSInputPrepComputeTileSizeY));
+	GroupCount.Z = Views.Num();
+
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("DLSS Input Prep Batched%s%s (%d views, up to %dx%d)",
+			bHasAlternateMotionVectors ? TEXT(" AlternateMotionVectors") : TEXT(" SceneMotionVectors"),
+			bHasBiasCurrentColor ? TEXT(" BiasCurrentColor") : TEXT(""),
+			Views.Num(), MaxViewSize.X, MaxViewSize.Y
+		),
+		GetDLSSComputePassFlags(EDLSSComputePass::InputPrep),
+		ComputeShader,
+		PassParameters,
+		GroupCount);
+
+	AccumulateDLSSInputPrepSetupCycles(FPlatformTime::Cycles64() - SetupStartCycles);
+	return Outputs;
+}
+
+namespace
+{
+	struct FDLSSInputPrepCost
+	{
+		uint32 NumDispatches = 0;
+		uint64 BytesRead = 0;
+
+		FDLSSInputPrepCost& operator+=(const FDLSSInputPrepCost& Other)
+		{
+			NumDispatches += Other.NumDispatches;
+			BytesRead += Other.BytesRead;
+			return *this;
+		}
+	};
+
+	struct FDLSSInputPrepFrameStats
+	{
+		uint64 FrameCounter = 0;
+		uint32 NumViews = 0;
+		uint32 NumFusedViews = 0;
+		uint32 NumBatchedViews = 0;
+		// CPU time of AddDLSSInputPrepPass and AddDLSSInputPrepBatchedPass
+		uint64 SetupCycles = 0;
+		FDLSSInputPrepCost Fused;
+		FDLSSInputPrepCost Separate;
+	};
+
+	// render thread only
+	FDLSSInputPrepFrameStats GDLSSInputPrepCurrentFrameStats;
+	FDLSSInputPrepFrameStats GDLSSInputPrepLastFrameStats;
+
+	FDLSSInputPrepFrameStats& GetDLSSInputPrepCurrentFrameStats()
+	{
+		check(IsInRenderingThread());
+
+		if (GDLSSInputPrepCurrentFrameStats.FrameCounter != GFrameCounterRenderThread)
+		{
+			if (GDLSSInputPrepCurrentFrameStats.NumViews > 0)
+			{
+				GDLSSInputPrepLastFrameStats = GDLSSInputPrepCurrentFrameStats;
+			}
+			GDLSSInputPrepCurrentFrameStats = FDLSSInputPrepFrameStats();
+			GDLSSInputPrepCurrentFrameStats.FrameCounter = GFrameCounterRenderThread;
+		}
+		return GDLSSInputPrepCurrentFrameStats;
+	}
+
+	uint64 GetDLSSInputPrepBytesPerPixel(FRDGTextureRef Texture)
+	{
+		return Texture ? GPixelFormats[Texture->Desc.Format].BlockBytes : 0;
+	}
+
+	// Reads of the scene depth, velocity, alternate motion vectors and custom stencil, which the separate passes share. The GBuffer and
+	// the outputs are read or written exactly once either way, so they are left out
+	FDLSSInputPrepCost EstimateDLSSInputPrepCost(bool bFused, EDLSSInputPrepBatch Batch, FRDGTextureRef InSceneDepthTexture, FRDGTextureRef InVelocityTexture, FRDGTextureRef AlternateMotionVectorTexture, bool bBiasCurrentColor, bool bResolveGBuffer, FIntRect InputViewRect)
+	{
+		const uint64 NumPixels = uint64(InputViewRect.Area());
+		const uint64 DepthBytes = GetDLSSInputPrepBytesPerPixel(InSceneDepthTexture) * NumPixels;
+		// the 1x1 black velocity texture stays in the cache
+		const uint64 VelocityBytes = (InVelocityTexture && InVelocityTexture->Desc.Extent != FIntPoint(1, 1)) ? GetDLSSInputPrepBytesPerPixel(InVelocityTexture) * NumPixels : 0;
+		const uint64 AlternateMotionVectorBytes = GetDLSSInputPrepBytesPerPixel(AlternateMotionVectorTexture) * NumPixels;
+		const uint64 StencilBytes = bBiasCurrentColor ? NumPixels : 0;
+
+		FDLSSInputPrepCost Cost;
+		// the later views of a batch share the dispatch of the first one
+		Cost.NumDispatches = bFused ? (Batch == EDLSSInputPrepBatch::Later ? 0 : 1) : 1 + (bBiasCurrentColor ? 1 : 0) + (bResolveGBuffer ? 1 : 0);
+		Cost.BytesRead = DepthBytes + VelocityBytes + AlternateMotionVectorBytes + StencilBytes;
+		if (!bFused && bResolveGBuffer)
+		{
+			// the GBuffer resolve pass reads the scene depth again
+			Cost.BytesRead += DepthBytes;
+		}
+		return Cost;
+	}
+}
+
+static void AccumulateDLSSInputPrepSetupCycles(uint64 Cycles)
+{
+	GetDLSSInputPrepCurrentFrameStats().SetupCycles += Cycles;
+}
+
+void RecordDLSSInputPrepPassStats(
+	bool bFused,
+	FRDGTextureRef InSceneDepthTexture,
+	FRDGTextureRef InVelocityTexture,
+	FRDGTextureRef AlternateMotionVectorTexture,
+	bool bBiasCurrentColor,
+	bool bResolveGBuffer,
+	FIntRect InputViewRect,
+	EDLSSInputPrepBatch Batch
+)
+{
+	const FDLSSInputPrepCost Fused = EstimateDLSSInputPrepCost(true, Batch, InSceneDepthTexture, InVelocityTexture, AlternateMotionVectorTexture, bBiasCurrentColor, bResolveGBuffer, InputViewRect);
+	const FDLSSInputPrepCost Separate = EstimateDLSSInputPrepCost(false, Batch, InSceneDepthTexture, InVelocityTexture, AlternateMotionVectorTexture, bBiasCurrentColor, bResolveGBuffer, InputViewRect);
+
+	FDLSSInputPrepFrameStats& Stats = GetDLSSInputPrepCurrentFrameStats();
+	++Stats.NumViews;
+	Stats.NumFusedViews += bFused ? 1 : 0;
+	Stats.NumBatchedViews += Batch != EDLSSInputPrepBatch::None ? 1 : 0;
+	Stats.Fused += Fused;
+	Stats.Separate += Separate;
+
+	const FDLSSInputPrepCost& Chosen = bFused ? Fused : Separate;
+	const FDLSSInputPrepCost& Other = bFused ? Separate : Fused;
+	INC_DWORD_STAT_BY(STAT_DLSSInputPrepFusedViews, bFused ? 1 : 0);
+	INC_DWORD_STAT_BY(STAT_DLSSInputPrepBatchedViews, Batch != EDLSSInputPrepBatch::None ? 1 : 0);
+	INC_DWORD_STAT_BY(STAT_DLSSInputPrepDispatches, Chosen.NumDispatches);
+	INC_DWORD_STAT_BY(STAT_DLSSInputPrepOtherDispatches, Other.NumDispatches);
+	INC_DWORD_STAT_BY(STAT_DLSSInputPrepKBRead, uint32(Chosen.BytesRead / 1024));
+	INC_DWORD_STAT_BY(STAT_DLSSInputPrepOtherKBRead, uint32(Other.BytesRead / 1024));
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommand CCmdNGXDLSSInputPrepLogStats(
+	TEXT("r.NGX.DLSS.InputPrep.LogStats"),
+	TEXT("Logs the dispatches, shared input reads and fused pass setup time of the DLSS input preparation during the last frame, fused and as separate passes. ")
+	TEXT("Toggle r.NGX.DLSS.InputPrep.BatchViews to compare batched and per view dispatches of multi view families, and stat GPU for the DLSSInputPrep GPU time"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		ENQUEUE_RENDER_COMMAND(LogDLSSInputPrepStats)([](FRHICommandListImmediate& RHICmdList)
+		{
+			const FDLSSInputPrepFrameStats& Stats = GDLSSInputPrepLastFrameStats;
+			if (Stats.NumViews == 0)
+			{
+				UE_LOG(LogDLSSInputPrep, Log, TEXT("No DLSS input preparation recorded yet"));
+				return;
+			}
+
+			const double FusedKB = double(Stats.Fused.BytesRead) / 1024.0;
+			const double SeparateKB = double(Stats.Separate.BytesRead) / 1024.0;
+			UE_LOG(LogDLSSInputPrep, Log, TEXT("Frame %llu, %u views (%u fused, %u batched): separate passes %u dispatches, %.0f KB of shared inputs read; fused %u dispatches, %.0f KB read (%.1f%% less); fused pass setup %.1f us"),
+				Stats.FrameCounter, Stats.NumViews, Stats.NumFusedViews, Stats.NumBatchedViews,
+				Stats.Separate.NumDispatches, SeparateKB,
+				Stats.Fused.NumDispatches, FusedKB,
+				SeparateKB > 0.0 ? 100.0 * (SeparateKB - FusedKB) / SeparateKB : 0.0,
+				FPlatformTime::ToMilliseconds64(Stats.SetupCycles) * 1000.0);
+		});
+	}));
+#endif
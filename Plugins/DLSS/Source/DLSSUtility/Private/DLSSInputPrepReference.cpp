@@ -0,0 +1,815 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "DLSSInputPrepReference.h"
+#include "DLSSInputPrepReferenceScene.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/Crc.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDLSSInputPrepReference, Log, All);
+
+namespace
+{
+
+// Every operation of the kernels goes through one of these, so the scalar and the SIMD variant can't round differently.
+// Keeping each scalar operation in its own expression also prevents the compiler from contracting them into fused multiply-adds.
+// Negation is a multiply by -1 in both, since VectorNegate subtracts from zero and turns -0 into +0
+struct FScalarLanes
+{
+	static constexpr int32 Num = 1;
+	using FFloat = float;
+	using FMask = bool;
+
+	static FFloat Load(const float* Values) { return Values[0]; }
+	static void Store(FFloat Value, float* Values) { Values[0] = Value; }
+	static FFloat Splat(float Value) { return Value; }
+	static FFloat Add(FFloat A, FFloat B) { return A + B; }
+	static FFloat Subtract(FFloat A, FFloat B) { return A - B; }
+	static FFloat Multiply(FFloat A, FFloat B) { return A * B; }
+	static FFloat Divide(FFloat A, FFloat B) { return A / B; }
+	static FMask GreaterThan(FFloat A, FFloat B) { return A > B; }
+	static FMask Equal(FFloat A, FFloat B) { return A == B; }
+	static FFloat Select(FMask Mask, FFloat A, FFloat B) { return Mask ? A : B; }
+};
+
+struct FVectorLanes
+{
+	static constexpr int32 Num = 4;
+	using FFloat = VectorRegister4Float;
+	using FMask = VectorRegister4Float;
+
+	static FFloat Load(const float* Values) { return VectorLoad(Values); }
+	static void Store(const FFloat& Value, float* Values) { VectorStore(Value, Values); }
+	static FFloat Splat(float Value) { return VectorSetFloat1(Value); }
+	static FFloat Add(const FFloat& A, const FFloat& B) { return VectorAdd(A, B); }
+	static FFloat Subtract(const FFloat& A, const FFloat& B) { return VectorSubtract(A, B); }
+	static FFloat Multiply(const FFloat& A, const FFloat& B) { return VectorMultiply(A, B); }
+	static FFloat Divide(const FFloat& A, const FFloat& B) { return VectorDivide(A, B); }
+	static FMask GreaterThan(const FFloat& A, const FFloat& B) { return VectorCompareGT(A, B); }
+	static FMask Equal(const FFloat& A, const FFloat& B) { return VectorCompareEQ(A, B); }
+	static FFloat Select(const FMask& Mask, const FFloat& A, const FFloat& B) { return VectorSelect(Mask, A, B); }
+};
+
+// the float shader parameters VelocityCombine.usf reads, derived the same way as on the CPU side of the GPU pass
+struct FVelocityCombineConstants
+{
+	explicit FVelocityCombineConstants(const FDLSSVelocityCombineReferenceInputs& Inputs)
+		: InputSize(float(Inputs.InputSize.X), float(Inputs.InputSize.Y))
+		, InputSizeInverse(1.0f / InputSize.X, 1.0f / InputSize.Y)
+		, CombinedSize(float(Inputs.GetCombinedVelocitySize().X), float(Inputs.GetCombinedVelocitySize().Y))
+		, CombinedSizeInverse(1.0f / CombinedSize.X, 1.0f / CombinedSize.Y)
+	{
+	}
+
+	FVector2f InputSize;
+	FVector2f InputSizeInverse;
+	FVector2f CombinedSize;
+	FVector2f CombinedSizeInverse;
+
+	// DecodeVelocityFromTexture
+	const float DecodeScale = 1.0f / (0.499f * 0.5f);
+	const float DecodeBias = 32767.0f / 65535.0f * DecodeScale;
+};
+
+int32 GetClampedIndex(FIntPoint Size, int32 X, int32 Y)
+{
+	// the GPU pass samples with a clamping point sampler
+	return FMath::Clamp(Y, 0, Size.Y - 1) * Size.X + FMath::Clamp(X, 0, Size.X - 1);
+}
+
+template <typename LanesType>
+typename LanesType::FFloat DecodeVelocity(const FVelocityCombineConstants& Constants, typename LanesType::FFloat Encoded)
+{
+	using L = LanesType;
+	return L::Subtract(L::Multiply(Encoded, L::Splat(Constants.DecodeScale)), L::Splat(Constants.DecodeBias));
+}
+
+template <typename LanesType>
+typename LanesType::FFloat Max(typename LanesType::FFloat A, typename LanesType::FFloat B)
+{
+	return LanesType::Select(LanesType::GreaterThan(A, B), A, B);
+}
+
+// mul(float4(X, Y, Z, 1), ClipToPrevClip)
+template <typename LanesType>
+void TransformToPrevClip(const FMatrix44f& ClipToPrevClip, typename LanesType::FFloat X, typename LanesType::FFloat Y, typename LanesType::FFloat Z,
+	typename LanesType::FFloat& OutX, typename LanesType::FFloat& OutY, typename LanesType::FFloat& OutW)
+{
+	using L = LanesType;
+	auto TransformColumn = [&](int32 Column)
+	{
+		const typename L::FFloat XY = L::Add(L::Multiply(X, L::Splat(ClipToPrevClip.M[0][Column])), L::Multiply(Y, L::Splat(ClipToPrevClip.M[1][Column])));
+		return L::Add(L::Add(XY, L::Multiply(Z, L::Splat(ClipToPrevClip.M[2][Column]))), L::Splat(ClipToPrevClip.M[3][Column]));
+	};
+
+	OutX = TransformColumn(0);
+	OutY = TransformColumn(1);
+	OutW = TransformColumn(3);
+}
+
+// GetOutputVelocity for the pixels X .. X + LanesType::Num - 1 of row Y
+template <typename LanesType>
+void CombineVelocityLanes(const FDLSSVelocityCombineReferenceInputs& Inputs, const FVelocityCombineConstants& Constants, int32 X, int32 Y, FVector2f* OutVelocity)
+{
+	using L = LanesType;
+	using FFloat = typename L::FFloat;
+	using FMask = typename L::FMask;
+
+	const bool bHasVelocity = Inputs.EncodedVelocity.Num() > 0;
+	const bool bHasAlternateVelocity = Inputs.EncodedAlternateVelocity.Num() > 0;
+
+	float PixelXLanes[L::Num];
+	float DepthLanes[L::Num];
+	float EncodedXLanes[L::Num];
+	float EncodedYLanes[L::Num];
+	float AlternateXLanes[L::Num];
+	float AlternateYLanes[L::Num];
+	for (int32 Lane = 0; Lane < L::Num; ++Lane)
+	{
+		const int32 Index = Y * Inputs.InputSize.X + X + Lane;
+		PixelXLanes[Lane] = float(X + Lane);
+		DepthLanes[Lane] = Inputs.Depth[Index];
+		EncodedXLanes[Lane] = bHasVelocity ? Inputs.EncodedVelocity[Index].X : 0.0f;
+		EncodedYLanes[Lane] = bHasVelocity ? Inputs.EncodedVelocity[Index].Y : 0.0f;
+		AlternateXLanes[Lane] = bHasAlternateVelocity ? Inputs.EncodedAlternateVelocity[Index].X : 0.0f;
+		AlternateYLanes[Lane] = bHasAlternateVelocity ? Inputs.EncodedAlternateVelocity[Index].Y : 0.0f;
+	}
+
+	const FFloat Zero = L::Splat(0.0f);
+	const FFloat Half = L::Splat(0.5f);
+	const FFloat MinusOne = L::Splat(-1.0f);
+
+	// SvPositionToScreenPosition of the pixel center
+	const FFloat ScreenX = L::Multiply(L::Subtract(L::Multiply(L::Add(L::Load(PixelXLanes), Half), L::Splat(Constants.InputSizeInverse.X)), Half), L::Splat(2.0f));
+	const FFloat ScreenY = L::Multiply(L::Subtract(L::Multiply(L::Add(L::Splat(float(Y)), Half), L::Splat(Constants.InputSizeInverse.Y)), Half), L::Splat(-2.0f));
+
+	FFloat PrevClipX, PrevClipY, PrevClipW;
+	TransformToPrevClip<L>(Inputs.ClipToPrevClip, ScreenX, ScreenY, L::Load(DepthLanes), PrevClipX, PrevClipY, PrevClipW);
+
+	const FMask bValidPrevClip = L::GreaterThan(PrevClipW, Zero);
+	const FFloat CameraVelocityX = L::Select(bValidPrevClip, L::Subtract(ScreenX, L::Divide(PrevClipX, PrevClipW)), Zero);
+	const FFloat CameraVelocityY = L::Select(bValidPrevClip, L::Subtract(ScreenY, L::Divide(PrevClipY, PrevClipW)), Zero);
+
+	const FFloat EncodedX = L::Load(EncodedXLanes);
+	const FMask bDynamic = L::GreaterThan(EncodedX, Zero);
+	const FFloat VelocityX = L::Select(bDynamic, DecodeVelocity<L>(Constants, EncodedX), CameraVelocityX);
+	const FFloat VelocityY = L::Select(bDynamic, DecodeVelocity<L>(Constants, L::Load(EncodedYLanes)), CameraVelocityY);
+
+	FFloat OutX = L::Multiply(L::Multiply(VelocityX, Half), L::Splat(Constants.CombinedSize.X));
+	FFloat OutY = L::Multiply(L::Multiply(VelocityY, L::Splat(-0.5f)), L::Splat(Constants.CombinedSize.Y));
+
+	if (bHasAlternateVelocity)
+	{
+		const FFloat AlternateX = L::Load(AlternateXLanes);
+		const FMask bAlternate = L::GreaterThan(AlternateX, Zero);
+		OutX = L::Select(bAlternate, L::Multiply(L::Multiply(MinusOne, DecodeVelocity<L>(Constants, AlternateX)), L::Splat(Constants.CombinedSize.X)), OutX);
+		OutY = L::Select(bAlternate, L::Multiply(L::Multiply(MinusOne, DecodeVelocity<L>(Constants, L::Load(AlternateYLanes))), L::Splat(Constants.CombinedSize.Y)), OutY);
+	}
+
+	float OutXLanes[L::Num];
+	float OutYLanes[L::Num];
+	L::Store(L::Multiply(OutX, MinusOne), OutXLanes);
+	L::Store(L::Multiply(OutY, MinusOne), OutYLanes);
+	for (int32 Lane = 0; Lane < L::Num; ++Lane)
+	{
+		OutVelocity[Lane] = FVector2f(OutXLanes[Lane], OutYLanes[Lane]);
+	}
+}
+
+// Reads the input pixels like the point sampler of the per pixel kernel, which clamps to the edges of the buffers
+struct FClampedVelocityCombineFetch
+{
+	const FDLSSVelocityCombineReferenceInputs& Inputs;
+
+	float GetDepth(FIntPoint Pixel) const
+	{
+		return Inputs.Depth[GetClampedIndex(Inputs.InputSize, Pixel.X, Pixel.Y)];
+	}
+
+	FVector4f GetEncodedVelocity(FIntPoint Pixel) const
+	{
+		return Inputs.EncodedVelocity.Num() > 0 ? Inputs.EncodedVelocity[GetClampedIndex(Inputs.InputSize, Pixel.X, Pixel.Y)] : FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
+	}
+};
+
+// the DILATE_MOTION_VECTORS math of VelocityCombineMain for the output pixels X .. X + LanesType::Num - 1 of row Y,
+// with the input pixels coming from Fetch so the per pixel and the tiled kernel share it like in the shader
+template <typename LanesType, typename FetchType>
+void CombineDilatedVelocityLanes(const FDLSSVelocityCombineReferenceInputs& Inputs, const FVelocityCombineConstants& Constants, const FetchType& Fetch, int32 X, int32 Y, FVector2f* OutVelocity)
+{
+	using L = LanesType;
+	using FFloat = typename L::FFloat;
+	using FMask = typename L::FMask;
+
+	const FFloat Zero = L::Splat(0.0f);
+	const FFloat Half = L::Splat(0.5f);
+	const FFloat One = L::Splat(1.0f);
+	const FFloat MinusOne = L::Splat(-1.0f);
+
+	float PixelXLanes[L::Num];
+	for (int32 Lane = 0; Lane < L::Num; ++Lane)
+	{
+		PixelXLanes[Lane] = float(X + Lane);
+	}
+
+	const FFloat ViewportUVX = L::Multiply(L::Add(L::Load(PixelXLanes), Half), L::Splat(Constants.CombinedSizeInverse.X));
+	const FFloat ViewportUVY = L::Multiply(L::Add(L::Splat(float(Y)), Half), L::Splat(Constants.CombinedSizeInverse.Y));
+
+	// pixel coordinate of the center of the output pixel in the input viewport
+	float InputPixelXLanes[L::Num];
+	float InputPixelYLanes[L::Num];
+	L::Store(L::Add(L::Multiply(ViewportUVX, L::Splat(Constants.InputSize.X)), L::Splat(Inputs.TemporalJitterPixels.X)), InputPixelXLanes);
+	L::Store(L::Add(L::Multiply(ViewportUVY, L::Splat(Constants.InputSize.Y)), L::Splat(Inputs.TemporalJitterPixels.Y)), InputPixelYLanes);
+
+	// the nearest input pixel and its diagonal neighbors, AA_CROSS = 1
+	FIntPoint NearestPixels[L::Num];
+	float NearestDepthLanes[L::Num];
+	float DepthLanes[4][L::Num];
+	for (int32 Lane = 0; Lane < L::Num; ++Lane)
+	{
+		const FIntPoint Pixel(FMath::FloorToInt(InputPixelXLanes[Lane]), FMath::FloorToInt(InputPixelYLanes[Lane]));
+		NearestPixels[Lane] = Pixel;
+		NearestDepthLanes[Lane] = Fetch.GetDepth(Pixel);
+		DepthLanes[0][Lane] = Fetch.GetDepth(FIntPoint(Pixel.X - 1, Pixel.Y - 1));
+		DepthLanes[1][Lane] = Fetch.GetDepth(FIntPoint(Pixel.X + 1, Pixel.Y - 1));
+		DepthLanes[2][Lane] = Fetch.GetDepth(FIntPoint(Pixel.X - 1, Pixel.Y + 1));
+		DepthLanes[3][Lane] = Fetch.GetDepth(FIntPoint(Pixel.X + 1, Pixel.Y + 1));
+	}
+
+	// GetNearestDepthOffset, with an inverted Z buffer
+	const FFloat DepthsX = L::Load(DepthLanes[0]);
+	const FFloat DepthsY = L::Load(DepthLanes[1]);
+	const FFloat DepthsZ = L::Load(DepthLanes[2]);
+	const FFloat DepthsW = L::Load(DepthLanes[3]);
+
+	const FFloat DepthOffsetXx = L::Select(L::GreaterThan(DepthsX, DepthsY), MinusOne, One);
+	FFloat DepthOffsetX = L::Select(L::GreaterThan(DepthsZ, DepthsW), MinusOne, One);
+	FFloat DepthOffsetY = One;
+
+	const FFloat DepthsXY = Max<L>(DepthsX, DepthsY);
+	const FFloat DepthsZW = Max<L>(DepthsZ, DepthsW);
+	const FMask bXYNearer = L::GreaterThan(DepthsXY, DepthsZW);
+	DepthOffsetY = L::Select(bXYNearer, MinusOne, DepthOffsetY);
+	DepthOffsetX = L::Select(bXYNearer, DepthOffsetXx, DepthOffsetX);
+
+	const FFloat DepthsXYZW = Max<L>(DepthsXY, DepthsZW);
+	FFloat NearestDepth = L::Load(NearestDepthLanes);
+	const FMask bNeighborNearer = L::GreaterThan(DepthsXYZW, NearestDepth);
+	NearestDepth = L::Select(bNeighborNearer, DepthsXYZW, NearestDepth);
+
+	float DepthOffsetXLanes[L::Num];
+	float DepthOffsetYLanes[L::Num];
+	L::Store(L::Select(bNeighborNearer, DepthOffsetX, Zero), DepthOffsetXLanes);
+	L::Store(L::Select(bNeighborNearer, DepthOffsetY, Zero), DepthOffsetYLanes);
+
+	float EncodedXLanes[L::Num];
+	float EncodedYLanes[L::Num];
+	for (int32 Lane = 0; Lane < L::Num; ++Lane)
+	{
+		const FVector4f Encoded = Fetch.GetEncodedVelocity(
+			FIntPoint(NearestPixels[Lane].X + int32(DepthOffsetXLanes[Lane]), NearestPixels[Lane].Y + int32(DepthOffsetYLanes[Lane])));
+		EncodedXLanes[Lane] = Encoded.X;
+		EncodedYLanes[Lane] = Encoded.Y;
+	}
+
+	// GetDilatedOutputVelocity
+	const FFloat ScreenX = L::Subtract(L::Multiply(L::Splat(2.0f), ViewportUVX), One);
+	const FFloat ScreenY = L::Subtract(One, L::Multiply(L::Splat(2.0f), ViewportUVY));
+
+	FFloat PrevClipX, PrevClipY, PrevClipW;
+	TransformToPrevClip<L>(Inputs.ClipToPrevClip, ScreenX, ScreenY, NearestDepth, PrevClipX, PrevClipY, PrevClipW);
+
+	const FFloat EncodedX = L::Load(EncodedXLanes);
+	const FMask bDynamic = L::GreaterThan(EncodedX, Zero);
+	const FFloat BackX = L::Select(bDynamic, DecodeVelocity<L>(Constants, EncodedX), L::Subtract(ScreenX, L::Divide(PrevClipX, PrevClipW)));
+	const FFloat BackY = L::Select(bDynamic, DecodeVelocity<L>(Constants, L::Load(EncodedYLanes)), L::Subtract(ScreenY, L::Divide(PrevClipY, PrevClipW)));
+
+	float OutXLanes[L::Num];
+	float OutYLanes[L::Num];
+	L::Store(L::Multiply(L::Multiply(MinusOne, L::Multiply(BackX, L::Splat(Constants.CombinedSize.X))), Half), OutXLanes);
+	L::Store(L::Multiply(L::Multiply(MinusOne, L::Multiply(BackY, L::Splat(Constants.CombinedSize.Y))), L::Splat(-0.5f)), OutYLanes);
+	for (int32 Lane = 0; Lane < L::Num; ++Lane)
+	{
+		OutVelocity[Lane] = FVector2f(OutXLanes[Lane], OutYLanes[Lane]);
+	}
+}
+
+template <typename LanesType>
+void CombineVelocityRow(const FDLSSVelocityCombineReferenceInputs& Inputs, const FVelocityCombineConstants& Constants, int32 Y, FVector2f* OutRow)
+{
+	const int32 Width = Inputs.GetCombinedVelocitySize().X;
+
+	int32 X = 0;
+	for (; X + LanesType::Num <= Width; X += LanesType::Num)
+	{
+		if (Inputs.bDilateMotionVectors)
+		{
+			CombineDilatedVelocityLanes<LanesType>(Inputs, Constants, FClampedVelocityCombineFetch{ Inputs }, X, Y, OutRow + X);
+		}
+		else
+		{
+			CombineVelocityLanes<LanesType>(Inputs, Constants, X, Y, OutRow + X);
+		}
+	}
+
+	// the rest of the row goes through the scalar kernel, which rounds identically
+	for (; X < Width; ++X)
+	{
+		if (Inputs.bDilateMotionVectors)
+		{
+			CombineDilatedVelocityLanes<FScalarLanes>(Inputs, Constants, FClampedVelocityCombineFetch{ Inputs }, X, Y, OutRow + X);
+		}
+		else
+		{
+			CombineVelocityLanes<FScalarLanes>(Inputs, Constants, X, Y, OutRow + X);
+		}
+	}
+}
+
+// TILED_VELOCITY_COMBINE with the THREADGROUP_SIZEX/Y of FVelocityCombineCS: every thread resolves a 2x2 quad of a tile
+constexpr int32 TiledVelocityCombineGroupSize = 8;
+constexpr int32 TiledVelocityCombineTileSize = TiledVelocityCombineGroupSize * 2;
+// SHARED_SIZEX/SHARED_SIZEY
+constexpr int32 TiledVelocityCombineSharedSize = TiledVelocityCombineTileSize + 4;
+
+// Input pixel that contains the center of the output pixel, GetNearestInputPixel in the shader
+FIntPoint GetNearestInputPixel(const FDLSSVelocityCombineReferenceInputs& Inputs, const FVelocityCombineConstants& Constants, FIntPoint OutputPixel)
+{
+	const float ViewportUVX = (float(OutputPixel.X) + 0.5f) * Constants.CombinedSizeInverse.X;
+	const float ViewportUVY = (float(OutputPixel.Y) + 0.5f) * Constants.CombinedSizeInverse.Y;
+	const float InputPixelX = ViewportUVX * Constants.InputSize.X;
+	const float InputPixelY = ViewportUVY * Constants.InputSize.Y;
+	return FIntPoint(FMath::FloorToInt(InputPixelX + Inputs.TemporalJitterPixels.X), FMath::FloorToInt(InputPixelY + Inputs.TemporalJitterPixels.Y));
+}
+
+// The groupshared depth and velocity of one tile. Everything the group didn't load reads as NaN, which is what makes a read outside
+// of the loaded neighborhood show up in the output instead of silently picking up a neighboring pixel like on the GPU
+struct FTiledVelocityCombineSharedFetch
+{
+	FIntPoint SharedMin = FIntPoint::ZeroValue;
+	float Depth[TiledVelocityCombineSharedSize * TiledVelocityCombineSharedSize];
+	FVector4f EncodedVelocity[TiledVelocityCombineSharedSize * TiledVelocityCombineSharedSize];
+
+	static int32 GetSharedIndex(FIntPoint SharedPixel)
+	{
+		const bool bInside = SharedPixel.X >= 0 && SharedPixel.Y >= 0 && SharedPixel.X < TiledVelocityCombineSharedSize && SharedPixel.Y < TiledVelocityCombineSharedSize;
+		return bInside ? SharedPixel.Y * TiledVelocityCombineSharedSize + SharedPixel.X : INDEX_NONE;
+	}
+
+	float GetDepth(FIntPoint Pixel) const
+	{
+		const int32 Index = GetSharedIndex(Pixel - SharedMin);
+		return Index != INDEX_NONE ? Depth[Index] : NAN;
+	}
+
+	FVector4f GetEncodedVelocity(FIntPoint Pixel) const
+	{
+		const int32 Index = GetSharedIndex(Pixel - SharedMin);
+		return Index != INDEX_NONE ? EncodedVelocity[Index] : FVector4f(NAN, NAN, NAN, NAN);
+	}
+};
+
+// VelocityCombineMain with TILED_VELOCITY_COMBINE for the tile of group (GroupX, GroupY), including the groupshared loads when dilating
+void CombineVelocityTile(const FDLSSVelocityCombineReferenceInputs& Inputs, const FVelocityCombineConstants& Constants, int32 GroupX, int32 GroupY, TArrayView<FVector2f> OutVelocity)
+{
+	const FIntPoint ViewportSize = Inputs.GetCombinedVelocitySize();
+	const FIntPoint TileMin(GroupX * TiledVelocityCombineTileSize, GroupY * TiledVelocityCombineTileSize);
+
+	FTiledVelocityCombineSharedFetch Shared;
+	if (Inputs.bDilateMotionVectors)
+	{
+		for (int32 Index = 0; Index < TiledVelocityCombineSharedSize * TiledVelocityCombineSharedSize; ++Index)
+		{
+			Shared.Depth[Index] = NAN;
+			Shared.EncodedVelocity[Index] = FVector4f(NAN, NAN, NAN, NAN);
+		}
+
+		const FIntPoint TileMax(
+			FMath::Min(TileMin.X + TiledVelocityCombineTileSize - 1, ViewportSize.X - 1),
+			FMath::Min(TileMin.Y + TiledVelocityCombineTileSize - 1, ViewportSize.Y - 1));
+		Shared.SharedMin = GetNearestInputPixel(Inputs, Constants, TileMin) - FIntPoint(1, 1);
+		const FIntPoint SharedMax = GetNearestInputPixel(Inputs, Constants, TileMax) + FIntPoint(1, 1);
+		const FIntPoint SharedSize(
+			FMath::Min(SharedMax.X - Shared.SharedMin.X + 1, TiledVelocityCombineSharedSize),
+			FMath::Min(SharedMax.Y - Shared.SharedMin.Y + 1, TiledVelocityCombineSharedSize));
+
+		// what the threads of the group load before the barrier, in any order
+		const FClampedVelocityCombineFetch Fetch{ Inputs };
+		for (int32 SharedIndex = 0; SharedIndex < SharedSize.X * SharedSize.Y; ++SharedIndex)
+		{
+			const FIntPoint SharedPixel(SharedIndex % SharedSize.X, SharedIndex / SharedSize.X);
+			const int32 Index = FTiledVelocityCombineSharedFetch::GetSharedIndex(SharedPixel);
+			Shared.Depth[Index] = Fetch.GetDepth(Shared.SharedMin + SharedPixel);
+			Shared.EncodedVelocity[Index] = Fetch.GetEncodedVelocity(Shared.SharedMin + SharedPixel);
+		}
+	}
+
+	for (int32 ThreadY = 0; ThreadY < TiledVelocityCombineGroupSize; ++ThreadY)
+	{
+		for (int32 ThreadX = 0; ThreadX < TiledVelocityCombineGroupSize; ++ThreadX)
+		{
+			for (int32 QuadIndex = 0; QuadIndex < 4; ++QuadIndex)
+			{
+				const FIntPoint Pixel = TileMin + FIntPoint(ThreadX * 2 + (QuadIndex & 1), ThreadY * 2 + (QuadIndex >> 1));
+				if (Pixel.X >= ViewportSize.X || Pixel.Y >= ViewportSize.Y)
+				{
+					continue;
+				}
+
+				FVector2f* OutPixel = OutVelocity.GetData() + Pixel.Y * ViewportSize.X + Pixel.X;
+				if (Inputs.bDilateMotionVectors)
+				{
+					CombineDilatedVelocityLanes<FScalarLanes>(Inputs, Constants, Shared, Pixel.X, Pixel.Y, OutPixel);
+				}
+				else
+				{
+					CombineVelocityLanes<FScalarLanes>(Inputs, Constants, Pixel.X, Pixel.Y, OutPixel);
+				}
+			}
+		}
+	}
+}
+
+template <typename LanesType>
+void BiasCurrentColorLanes(const uint8* Stencil, uint8 StencilValue, float* OutBiasCurrentColor)
+{
+	using L = LanesType;
+
+	float StencilLanes[L::Num];
+	for (int32 Lane = 0; Lane < L::Num; ++Lane)
+	{
+		StencilLanes[Lane] = float(Stencil[Lane]);
+	}
+
+	L::Store(L::Select(L::Equal(L::Load(StencilLanes), L::Splat(float(StencilValue))), L::Splat(1.0f), L::Splat(0.0f)), OutBiasCurrentColor);
+}
+
+template <typename LanesType>
+void BiasCurrentColorRow(int32 Width, const uint8* Stencil, uint8 StencilValue, float* OutRow)
+{
+	int32 X = 0;
+	for (; X + LanesType::Num <= Width; X += LanesType::Num)
+	{
+		BiasCurrentColorLanes<LanesType>(Stencil + X, StencilValue, OutRow + X);
+	}
+	for (; X < Width; ++X)
+	{
+		BiasCurrentColorLanes<FScalarLanes>(Stencil + X, StencilValue, OutRow + X);
+	}
+}
+
+} // namespace
+
+void ComputeDLSSVelocityCombineReference(const FDLSSVelocityCombineReferenceInputs& Inputs, TArrayView<FVector2f> OutVelocity, EDLSSReferenceKernel Kernel)
+{
+	const int32 NumInputPixels = Inputs.InputSize.X * Inputs.InputSize.Y;
+	const FIntPoint CombinedSize = Inputs.GetCombinedVelocitySize();
+
+	check(Inputs.InputSize.X > 0 && Inputs.InputSize.Y > 0);
+	check(CombinedSize.X > 0 && CombinedSize.Y > 0);
+	check(Inputs.Depth.Num() == NumInputPixels);
+	check(Inputs.EncodedVelocity.Num() == 0 || Inputs.EncodedVelocity.Num() == NumInputPixels);
+	check(Inputs.EncodedAlternateVelocity.Num() == 0 || Inputs.EncodedAlternateVelocity.Num() == NumInputPixels);
+	check(OutVelocity.Num() == CombinedSize.X * CombinedSize.Y);
+
+	// like SUPPORT_ALTERNATE_MOTION_VECTOR, which only exists in the non dilating permutations
+	FDLSSVelocityCombineReferenceInputs KernelInputs = Inputs;
+	if (KernelInputs.bDilateMotionVectors)
+	{
+		KernelInputs.EncodedAlternateVelocity = TConstArrayView<FVector2f>();
+	}
+
+	const FVelocityCombineConstants Constants(KernelInputs);
+	ParallelFor(CombinedSize.Y, [&KernelInputs, &Constants, &OutVelocity, CombinedSize, Kernel](int32 Y)
+	{
+		FVector2f* OutRow = OutVelocity.GetData() + Y * CombinedSize.X;
+		if (Kernel == EDLSSReferenceKernel::SIMD)
+		{
+			CombineVelocityRow<FVectorLanes>(KernelInputs, Constants, Y, OutRow);
+		}
+		else
+		{
+			CombineVelocityRow<FScalarLanes>(KernelInputs, Constants, Y, OutRow);
+		}
+	});
+}
+
+void ComputeDLSSTiledVelocityCombineReference(const FDLSSVelocityCombineReferenceInputs& Inputs, TArrayView<FVector2f> OutVelocity)
+{
+	const FIntPoint CombinedSize = Inputs.GetCombinedVelocitySize();
+
+	check(Inputs.InputSize.X > 0 && Inputs.InputSize.Y > 0);
+	check(CombinedSize.X > 0 && CombinedSize.Y > 0);
+	check(Inputs.Depth.Num() == Inputs.InputSize.X * Inputs.InputSize.Y);
+	check(OutVelocity.Num() == CombinedSize.X * CombinedSize.Y);
+	// like CanUseTiledVelocityCombine, the groupshared neighborhood only covers upscaling
+	check(!Inputs.bDilateMotionVectors || (Inputs.InputSize.X <= Inputs.OutputSize.X && Inputs.InputSize.Y <= Inputs.OutputSize.Y));
+
+	FDLSSVelocityCombineReferenceInputs KernelInputs = Inputs;
+	if (KernelInputs.bDilateMotionVectors)
+	{
+		KernelInputs.EncodedAlternateVelocity = TConstArrayView<FVector2f>();
+	}
+
+	// pixels no group writes keep NaN, so they can't pass a comparison
+	for (FVector2f& Velocity : OutVelocity)
+	{
+		Velocity = FVector2f(NAN, NAN);
+	}
+
+	const FVelocityCombineConstants Constants(KernelInputs);
+	const FIntPoint GroupCount = FIntPoint::DivideAndRoundUp(CombinedSize, TiledVelocityCombineTileSize);
+	ParallelFor(GroupCount.X * GroupCount.Y, [&KernelInputs, &Constants, &OutVelocity, GroupCount](int32 GroupIndex)
+	{
+		CombineVelocityTile(KernelInputs, Constants, GroupIndex % GroupCount.X, GroupIndex / GroupCount.X, OutVelocity);
+	});
+}
+
+void ComputeDLSSBiasCurrentColorReference(FIntPoint Size, TConstArrayView<uint8> Stencil, uint8 StencilValue, TArrayView<float> OutBiasCurrentColor, EDLSSReferenceKernel Kernel)
+{
+	check(Size.X > 0 && Size.Y > 0);
+	check(Stencil.Num() == Size.X * Size.Y);
+	check(OutBiasCurrentColor.Num() == Size.X * Size.Y);
+
+	ParallelFor(Size.Y, [&Stencil, &OutBiasCurrentColor, Size, StencilValue, Kernel](int32 Y)
+	{
+		const uint8* StencilRow = Stencil.GetData() + Y * Size.X;
+		float* OutRow = OutBiasCurrentColor.GetData() + Y * Size.X;
+		if (Kernel == EDLSSReferenceKernel::SIMD)
+		{
+			BiasCurrentColorRow<FVectorLanes>(Size.X, StencilRow, StencilValue, OutRow);
+		}
+		else
+		{
+			BiasCurrentColorRow<FScalarLanes>(Size.X, StencilRow, StencilValue, OutRow);
+		}
+	});
+}
+
+#if WITH_DLSS_INPUT_PREP_REFERENCE_SCENE
+const FIntPoint FDLSSInputPrepReferenceScene::DefaultInputSize(1281, 721);
+
+FDLSSInputPrepReferenceScene::FDLSSInputPrepReferenceScene(FIntPoint InInputSize)
+	: InputSize(InInputSize)
+	, OutputSize(GetOutputSize(InInputSize))
+{
+	const int32 NumPixels = InputSize.X * InputSize.Y;
+	Depth.SetNumUninitialized(NumPixels);
+	EncodedVelocity.SetNumUninitialized(NumPixels);
+	EncodedAlternateVelocity.SetNumUninitialized(NumPixels);
+	Stencil.SetNumUninitialized(NumPixels);
+
+	// inverse of DecodeVelocityFromTexture, in two expressions so it can't be contracted into a fused multiply-add either
+	auto EncodeVelocity = [](float Velocity)
+	{
+		const float Scaled = Velocity * (0.499f * 0.5f);
+		return Scaled + 32767.0f / 65535.0f;
+	};
+
+	const int32 HorizonY = InputSize.Y / 3;
+	for (int32 Y = 0; Y < InputSize.Y; ++Y)
+	{
+		for (int32 X = 0; X < InputSize.X; ++X)
+		{
+			const int32 Index = Y * InputSize.X + X;
+			Depth[Index] = Y < HorizonY ? 0.0f : 0.001f + 0.05f * float(Y - HorizonY) / float(InputSize.Y - HorizonY);
+			EncodedVelocity[Index] = FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
+			EncodedAlternateVelocity[Index] = FVector2f(0.0f, 0.0f);
+			Stencil[Index] = 0;
+		}
+	}
+
+	// one draw per statement, the evaluation order of constructor arguments differs between compilers
+	FRandomStream RandomStream(0x444C5353);
+	const int32 NumBoxes = 16;
+	for (int32 BoxIndex = 0; BoxIndex < NumBoxes; ++BoxIndex)
+	{
+		FIntPoint BoxSize, BoxMin;
+		FVector2f BoxVelocity;
+		BoxSize.X = RandomStream.RandRange(4, FMath::Max(4, InputSize.X / 4));
+		BoxSize.Y = RandomStream.RandRange(4, FMath::Max(4, InputSize.Y / 4));
+		BoxMin.X = RandomStream.RandRange(0, InputSize.X - 1);
+		BoxMin.Y = RandomStream.RandRange(0, InputSize.Y - 1);
+		const float BoxDepth = RandomStream.FRandRange(0.06f, 0.5f);
+		BoxVelocity.X = RandomStream.FRandRange(-0.05f, 0.05f);
+		BoxVelocity.Y = RandomStream.FRandRange(-0.05f, 0.05f);
+		const bool bDynamic = RandomStream.FRand() < 0.75f;
+		const bool bAlternate = BoxIndex % 4 == 0;
+		const bool bBiased = BoxIndex % 3 == 0;
+
+		for (int32 Y = BoxMin.Y; Y < FMath::Min(BoxMin.Y + BoxSize.Y, InputSize.Y); ++Y)
+		{
+			for (int32 X = BoxMin.X; X < FMath::Min(BoxMin.X + BoxSize.X, InputSize.X); ++X)
+			{
+				const int32 Index = Y * InputSize.X + X;
+				if (BoxDepth < Depth[Index])
+				{
+					continue;
+				}
+
+				Depth[Index] = BoxDepth;
+				EncodedVelocity[Index] = bDynamic ? FVector4f(EncodeVelocity(BoxVelocity.X), EncodeVelocity(BoxVelocity.Y), 0.0f, 0.0f) : FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
+				EncodedAlternateVelocity[Index] = bAlternate ? FVector2f(EncodeVelocity(-BoxVelocity.Y), EncodeVelocity(BoxVelocity.X)) : FVector2f(0.0f, 0.0f);
+				Stencil[Index] = bBiased ? BiasStencilValue : 0;
+			}
+		}
+	}
+
+	// a small camera translation and rotation, with depth dependent parallax
+	ClipToPrevClip = FMatrix44f::Identity;
+	ClipToPrevClip.M[0][1] = 0.002f;
+	ClipToPrevClip.M[1][0] = -0.002f;
+	ClipToPrevClip.M[2][0] = 0.01f;
+	ClipToPrevClip.M[2][1] = -0.005f;
+	ClipToPrevClip.M[3][0] = 0.003f;
+	ClipToPrevClip.M[3][1] = 0.001f;
+}
+
+FDLSSVelocityCombineReferenceInputs FDLSSInputPrepReferenceScene::GetVelocityCombineInputs(bool bDilateMotionVectors, bool bAlternateMotionVectors) const
+{
+	FDLSSVelocityCombineReferenceInputs Inputs;
+	Inputs.InputSize = InputSize;
+	Inputs.OutputSize = OutputSize;
+	Inputs.Depth = Depth;
+	Inputs.EncodedVelocity = EncodedVelocity;
+	Inputs.EncodedAlternateVelocity = bAlternateMotionVectors ? TConstArrayView<FVector2f>(EncodedAlternateVelocity) : TConstArrayView<FVector2f>();
+	Inputs.ClipToPrevClip = ClipToPrevClip;
+	Inputs.TemporalJitterPixels = FVector2f(0.3125f, -0.4375f);
+	Inputs.bDilateMotionVectors = bDilateMotionVectors;
+	return Inputs;
+}
+
+struct FDLSSInputPrepReferenceCase
+{
+	const TCHAR* Name;
+	bool bDilateMotionVectors;
+	bool bAlternateMotionVectors;
+	uint32 ExpectedCrc;
+};
+
+// The expected CRCs are of the scalar output at FDLSSInputPrepReferenceScene::DefaultInputSize. They only change with the kernels or the scene,
+// when changing either on purpose take the new ones from the log of r.NGX.DLSS.InputPrepReference.Test without arguments
+static const FDLSSInputPrepReferenceCase GDLSSInputPrepReferenceCases[] =
+{
+	{ TEXT("VelocityCombine"), false, false, 0x1ad7ed77 },
+	{ TEXT("VelocityCombine AlternateMotionVectors"), false, true, 0x6bc50f5b },
+	{ TEXT("VelocityCombine Dilate"), true, false, 0x6d0aa692 },
+};
+
+static const uint32 GDLSSInputPrepReferenceBiasCurrentColorExpectedCrc = 0xc4df0fbb;
+
+TArray<FDLSSInputPrepReferenceCaseResult> RunDLSSInputPrepReferenceCases(const FDLSSInputPrepReferenceScene& Scene)
+{
+	const bool bDefaultSize = Scene.InputSize == FDLSSInputPrepReferenceScene::DefaultInputSize;
+
+	TArray<FDLSSInputPrepReferenceCaseResult> Results;
+	auto AddResult = [&Results, bDefaultSize](const TCHAR* Name, const void* ScalarData, const void* SIMDData, int32 NumPixels, int32 BytesPerPixel, uint32 ExpectedCrc)
+	{
+		FDLSSInputPrepReferenceCaseResult& Result = Results.AddDefaulted_GetRef();
+		Result.Name = Name;
+		Result.NumPixels = NumPixels;
+		for (int32 PixelIndex = 0; PixelIndex < NumPixels; ++PixelIndex)
+		{
+			const int32 Offset = PixelIndex * BytesPerPixel;
+			Result.NumMismatchingPixels += FMemory::Memcmp(static_cast<const uint8*>(ScalarData) + Offset, static_cast<const uint8*>(SIMDData) + Offset, BytesPerPixel) != 0 ? 1 : 0;
+		}
+		Result.Crc = FCrc::MemCrc32(ScalarData, NumPixels * BytesPerPixel);
+		if (bDefaultSize)
+		{
+			Result.ExpectedCrc = ExpectedCrc;
+		}
+	};
+
+	for (const FDLSSInputPrepReferenceCase& Case : GDLSSInputPrepReferenceCases)
+	{
+		const FDLSSVelocityCombineReferenceInputs Inputs = Scene.GetVelocityCombineInputs(Case.bDilateMotionVectors, Case.bAlternateMotionVectors);
+		const int32 NumPixels = Inputs.GetCombinedVelocitySize().X * Inputs.GetCombinedVelocitySize().Y;
+
+		TArray<FVector2f> ScalarVelocity, SIMDVelocity;
+		ScalarVelocity.SetNumUninitialized(NumPixels);
+		SIMDVelocity.SetNumUninitialized(NumPixels);
+		ComputeDLSSVelocityCombineReference(Inputs, ScalarVelocity, EDLSSReferenceKernel::Scalar);
+		ComputeDLSSVelocityCombineReference(Inputs, SIMDVelocity, EDLSSReferenceKernel::SIMD);
+
+		AddResult(Case.Name, ScalarVelocity.GetData(), SIMDVelocity.GetData(), NumPixels, sizeof(FVector2f), Case.ExpectedCrc);
+	}
+
+	{
+		const int32 NumPixels = Scene.InputSize.X * Scene.InputSize.Y;
+		TArray<float> ScalarMask, SIMDMask;
+		ScalarMask.SetNumUninitialized(NumPixels);
+		SIMDMask.SetNumUninitialized(NumPixels);
+		ComputeDLSSBiasCurrentColorReference(Scene.InputSize, Scene.Stencil, FDLSSInputPrepReferenceScene::BiasStencilValue, ScalarMask, EDLSSReferenceKernel::Scalar);
+		ComputeDLSSBiasCurrentColorReference(Scene.InputSize, Scene.Stencil, FDLSSInputPrepReferenceScene::BiasStencilValue, SIMDMask, EDLSSReferenceKernel::SIMD);
+
+		AddResult(TEXT("BiasCurrentColor"), ScalarMask.GetData(), SIMDMask.GetData(), NumPixels, sizeof(float), GDLSSInputPrepReferenceBiasCurrentColorExpectedCrc);
+	}
+
+	return Results;
+}
+#endif
+
+#if !UE_BUILD_SHIPPING
+static FIntPoint ParseDLSSInputPrepReferenceSize(const TArray<FString>& Args)
+{
+	return FIntPoint(
+		FMath::Max(3, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : FDLSSInputPrepReferenceScene::DefaultInputSize.X),
+		FMath::Max(3, Args.Num() > 1 ? FCString::Atoi(*Args[1]) : FDLSSInputPrepReferenceScene::DefaultInputSize.Y));
+}
+
+static FAutoConsoleCommand CCmdNGXDLSSInputPrepReferenceTest(
+	TEXT("r.NGX.DLSS.InputPrepReference.Test"),
+	TEXT("Runs the scalar and SIMD CPU reference of the DLSS velocity combine and bias current color kernels over a synthetic scene, ")
+	TEXT("checks that they are bit identical and logs a CRC of each output. At the default size the CRCs are also checked against the expected ones. ")
+	TEXT("Optional arguments: input width and height, default to 1281 721"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FDLSSInputPrepReferenceScene Scene(ParseDLSSInputPrepReferenceSize(Args));
+		const TArray<FDLSSInputPrepReferenceCaseResult> Results = RunDLSSInputPrepReferenceCases(Scene);
+
+		int32 NumFailedCases = 0;
+		for (const FDLSSInputPrepReferenceCaseResult& Result : Results)
+		{
+			if (Result.NumMismatchingPixels > 0)
+			{
+				++NumFailedCases;
+				UE_LOG(LogDLSSInputPrepReference, Error, TEXT("%s: scalar and SIMD differ in %d of %d pixels, scalar CRC 0x%08x"), Result.Name, Result.NumMismatchingPixels, Result.NumPixels, Result.Crc);
+			}
+			else if (Result.ExpectedCrc.IsSet() && Result.Crc != Result.ExpectedCrc.GetValue())
+			{
+				++NumFailedCases;
+				UE_LOG(LogDLSSInputPrepReference, Error, TEXT("%s: scalar and SIMD are bit identical, but the CRC 0x%08x differs from the expected 0x%08x"), Result.Name, Result.Crc, Result.ExpectedCrc.GetValue());
+			}
+			else
+			{
+				UE_LOG(LogDLSSInputPrepReference, Log, TEXT("%s: scalar and SIMD are bit identical, CRC 0x%08x%s"), Result.Name, Result.Crc, Result.ExpectedCrc.IsSet() ? TEXT(" as expected") : TEXT(""));
+			}
+		}
+
+		UE_LOG(LogDLSSInputPrepReference, Log, TEXT("DLSS input prep reference %dx%d -> %dx%d: %d of %d cases failed"),
+			Scene.InputSize.X, Scene.InputSize.Y, Scene.OutputSize.X, Scene.OutputSize.Y, NumFailedCases, Results.Num());
+	}));
+
+static FAutoConsoleCommand CCmdNGXDLSSInputPrepReferenceBenchmark(
+	TEXT("r.NGX.DLSS.InputPrepReference.Benchmark"),
+	TEXT("Measures the throughput of the scalar and SIMD CPU reference of the DLSS input preparation kernels over a synthetic scene. ")
+	TEXT("Optional arguments: input width and height, default to 1281 721, and number of iterations, defaults to 20"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 NumIterations = FMath::Max(1, Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 20);
+		const FDLSSInputPrepReferenceScene Scene(ParseDLSSInputPrepReferenceSize(Args));
+		const FIntPoint InputSize = Scene.InputSize;
+
+		auto MeasureMegapixelsPerSecond = [NumIterations](int32 NumPixels, TFunctionRef<void()> Kernel)
+		{
+			const double StartSeconds = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+			{
+				Kernel();
+			}
+			const double Seconds = FMath::Max(FPlatformTime::Seconds() - StartSeconds, 1e-9);
+			return double(NumPixels) * NumIterations / Seconds / 1000000.0;
+		};
+
+		for (const FDLSSInputPrepReferenceCase& Case : GDLSSInputPrepReferenceCases)
+		{
+			const FDLSSVelocityCombineReferenceInputs Inputs = Scene.GetVelocityCombineInputs(Case.bDilateMotionVectors, Case.bAlternateMotionVectors);
+			const int32 NumPixels = Inputs.GetCombinedVelocitySize().X * Inputs.GetCombinedVelocitySize().Y;
+
+			TArray<FVector2f> Velocity;
+			Velocity.SetNumUninitialized(NumPixels);
+			const double ScalarThroughput = MeasureMegapixelsPerSecond(NumPixels, [&Inputs, &Velocity]() { ComputeDLSSVelocityCombineReference(Inputs, Velocity, EDLSSReferenceKernel::Scalar); });
+			const double SIMDThroughput = MeasureMegapixelsPerSecond(NumPixels, [&Inputs, &Velocity]() { ComputeDLSSVelocityCombineReference(Inputs, Velocity, EDLSSReferenceKernel::SIMD); });
+
+			UE_LOG(LogDLSSInputPrepReference, Log, TEXT("%s: scalar %.1f MPixel/s, SIMD %.1f MPixel/s"), Case.Name, ScalarThroughput, SIMDThroughput);
+		}
+
+		{
+			const int32 NumPixels = InputSize.X * InputSize.Y;
+			TArray<float> Mask;
+			Mask.SetNumUninitialized(NumPixels);
+			const double ScalarThroughput = MeasureMegapixelsPerSecond(NumPixels, [&InputSize, &Scene, &Mask]()
+			{
+				ComputeDLSSBiasCurrentColorReference(InputSize, Scene.Stencil, FDLSSInputPrepReferenceScene::BiasStencilValue, Mask, EDLSSReferenceKernel::Scalar);
+			});
+			const double SIMDThroughput = MeasureMegapixelsPerSecond(NumPixels, [&InputSize, &Scene, &Mask]()
+			{
+				ComputeDLSSBiasCurrentColorReference(InputSize, Scene.Stencil, FDLSSInputPrepReferenceScene::BiasStencilValue, Mask, EDLSSReferenceKernel::SIMD);
+			});
+
+			UE_LOG(LogDLSSInputPrepReference, Log, TEXT("BiasCurrentColor: scalar %.1f MPixel/s, SIMD %.1f MPixel/s"), ScalarThroughput, SIMDThroughput);
+		}
+	}));
+#endif
@@ -0,0 +1,58 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DLSSInputPrepReference.h"
+#include "Misc/Optional.h"
+
+// the synthetic scene is used by the r.NGX.DLSS.InputPrepReference.* console commands and the automation tests
+#define WITH_DLSS_INPUT_PREP_REFERENCE_SCENE (!UE_BUILD_SHIPPING || WITH_DEV_AUTOMATION_TESTS)
+
+#if WITH_DLSS_INPUT_PREP_REFERENCE_SCENE
+// Deterministic depth, velocity and stencil content covering what the kernels branch on: sky, a sloped floor with camera motion only,
+// nearer boxes with dynamic velocity whose edges the dilation has to pick up, alternate motion vectors and a stencil region
+struct FDLSSInputPrepReferenceScene
+{
+	static constexpr uint8 BiasStencilValue = 1 << 3;
+
+	// odd sizes exercise the scalar row tails, the output is at 1.5x like DLSS quality mode
+	static const FIntPoint DefaultInputSize;
+	static FIntPoint GetOutputSize(FIntPoint InputSize) { return FIntPoint(InputSize.X * 3 / 2, InputSize.Y * 3 / 2); }
+
+	explicit FDLSSInputPrepReferenceScene(FIntPoint InInputSize);
+
+	FDLSSVelocityCombineReferenceInputs GetVelocityCombineInputs(bool bDilateMotionVectors, bool bAlternateMotionVectors) const;
+
+	FIntPoint InputSize;
+	FIntPoint OutputSize;
+	TArray<float> Depth;
+	TArray<FVector4f> EncodedVelocity;
+	TArray<FVector2f> EncodedAlternateVelocity;
+	TArray<uint8> Stencil;
+	FMatrix44f ClipToPrevClip;
+};
+
+struct FDLSSInputPrepReferenceCaseResult
+{
+	const TCHAR* Name = nullptr;
+	int32 NumPixels = 0;
+	int32 NumMismatchingPixels = 0;
+	// of the scalar output
+	uint32 Crc = 0;
+	// checked in for FDLSSInputPrepReferenceScene::DefaultInputSize, only set when the scene has that size
+	TOptional<uint32> ExpectedCrc;
+};
+
+// Runs the scalar and the SIMD kernel of every case over the scene and compares their outputs
+TArray<FDLSSInputPrepReferenceCaseResult> RunDLSSInputPrepReferenceCases(const FDLSSInputPrepReferenceScene& Scene);
+#endif
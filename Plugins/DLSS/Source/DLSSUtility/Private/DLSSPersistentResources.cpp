@@ -0,0 +1,137 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "DLSSPersistentResources.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "RenderingThread.h"
+#include "RenderUtils.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDLSSPersistentResources, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("DLSS Persistent Resources"), STATGROUP_DLSSPersistentResources, STATCAT_Advanced);
+DECLARE_MEMORY_STAT(TEXT("Persistent Textures"), STAT_DLSSPersistentTextureMemory, STATGROUP_DLSSPersistentResources);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Textures Registered"), STAT_DLSSPersistentTexturesRegistered, STATGROUP_DLSSPersistentResources);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Textures Created"), STAT_DLSSPersistentTexturesCreated, STATGROUP_DLSSPersistentResources);
+
+static TGlobalResource<FDLSSPersistentResources> GDLSSPersistentResources;
+
+FDLSSPersistentResources& FDLSSPersistentResources::Get()
+{
+	return GDLSSPersistentResources;
+}
+
+FRDGTextureRef FDLSSPersistentResources::RegisterTexture(FRDGBuilder& GraphBuilder, const TCHAR* Name, const FRDGTextureDesc& Desc, TFunctionRef<void(FRDGBuilder&, FRDGTextureRef)> Initialize)
+{
+	check(IsInRenderingThread());
+	INC_DWORD_STAT(STAT_DLSSPersistentTexturesRegistered);
+
+	FPersistentTexture& Texture = Textures.FindOrAdd(FName(Name));
+	if (Texture.PooledTexture.IsValid() && Texture.Desc == Desc)
+	{
+		return GraphBuilder.RegisterExternalTexture(Texture.PooledTexture);
+	}
+
+	INC_DWORD_STAT(STAT_DLSSPersistentTexturesCreated);
+
+	FRDGTextureRef RDGTexture = GraphBuilder.CreateTexture(Desc, Name);
+	Initialize(GraphBuilder, RDGTexture);
+
+	MemorySize -= Texture.Size;
+	Texture.PooledTexture = GraphBuilder.ConvertToExternalTexture(RDGTexture);
+	Texture.Desc = Desc;
+	Texture.Size = CalcTextureSize(Desc.Extent.X, Desc.Extent.Y, Desc.Format, Desc.NumMips) * Desc.ArraySize * Desc.Depth;
+	MemorySize += Texture.Size;
+	SET_MEMORY_STAT(STAT_DLSSPersistentTextureMemory, MemorySize);
+
+	return RDGTexture;
+}
+
+FRDGTextureRef FDLSSPersistentResources::RegisterClearedTexture(FRDGBuilder& GraphBuilder, const TCHAR* Name, const FRDGTextureDesc& Desc)
+{
+	return RegisterTexture(GraphBuilder, Name, Desc, [](FRDGBuilder& InGraphBuilder, FRDGTextureRef Texture)
+	{
+		AddClearRenderTargetPass(InGraphBuilder, Texture);
+	});
+}
+
+void FDLSSPersistentResources::ReleaseRHI()
+{
+	Textures.Empty();
+	MemorySize = 0;
+	SET_MEMORY_STAT(STAT_DLSSPersistentTextureMemory, 0);
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommand CCmdNGXDLSSPersistentResourcesLog(
+	TEXT("r.NGX.DLSS.PersistentResources.Log"),
+	TEXT("Logs the persistent textures of the DLSS plugin and their memory footprint"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		ENQUEUE_RENDER_COMMAND(LogDLSSPersistentResources)([](FRHICommandListImmediate& RHICmdList)
+		{
+			const FDLSSPersistentResources& Resources = FDLSSPersistentResources::Get();
+			UE_LOG(LogDLSSPersistentResources, Log, TEXT("%d DLSS persistent textures, %llu bytes"), Resources.GetNumTextures(), Resources.GetMemorySize());
+		});
+	}));
+
+// Times the graph setup of a pass that needs two 1x1 helper textures, like the UE 5.5 and older debug layer compatibility helpers,
+// once with transient textures that get created and cleared in every graph and once with the persistent ones.
+// Meant to run with -nullrhi, so the numbers are the CPU cost of building the graph and not of the GPU work
+static FAutoConsoleCommand CCmdNGXDLSSPersistentResourcesBenchmark(
+	TEXT("r.NGX.DLSS.PersistentResources.Benchmark"),
+	TEXT("Measures the RDG setup time of transient vs persistent helper textures. Optional argument: number of graphs, defaults to 1000"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 NumGraphs = FMath::Max(1, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000);
+
+		ENQUEUE_RENDER_COMMAND(BenchmarkDLSSPersistentResources)([NumGraphs](FRHICommandListImmediate& RHICmdList)
+		{
+			const FRDGTextureDesc Desc = FRDGTextureDesc::Create2D(FIntPoint(1, 1), PF_FloatRGBA, FClearValueBinding::Black, TexCreate_RenderTargetable);
+
+			auto RunGraphs = [&RHICmdList, NumGraphs](TFunctionRef<void(FRDGBuilder&)> SetupGraph)
+			{
+				double SetupSeconds = 0.0;
+				for (int32 GraphIndex = 0; GraphIndex < NumGraphs; ++GraphIndex)
+				{
+					FRDGBuilder GraphBuilder(RHICmdList);
+
+					const double StartSeconds = FPlatformTime::Seconds();
+					SetupGraph(GraphBuilder);
+					SetupSeconds += FPlatformTime::Seconds() - StartSeconds;
+
+					GraphBuilder.Execute();
+				}
+				return 1000000.0 * SetupSeconds / NumGraphs;
+			};
+
+			const double TransientMicroseconds = RunGraphs([&Desc](FRDGBuilder& GraphBuilder)
+			{
+				FRDGTextureRef Source = GraphBuilder.CreateTexture(Desc, TEXT("DLSSPersistentResourcesBenchmarkSource"));
+				FRDGTextureRef Dest = GraphBuilder.CreateTexture(Desc, TEXT("DLSSPersistentResourcesBenchmarkDest"));
+				AddClearRenderTargetPass(GraphBuilder, Source);
+				AddClearRenderTargetPass(GraphBuilder, Dest);
+			});
+
+			const double PersistentMicroseconds = RunGraphs([&Desc](FRDGBuilder& GraphBuilder)
+			{
+				FDLSSPersistentResources::Get().RegisterClearedTexture(GraphBuilder, TEXT("DLSSPersistentResourcesBenchmarkSource"), Desc);
+				FDLSSPersistentResources::Get().RegisterClearedTexture(GraphBuilder, TEXT("DLSSPersistentResourcesBenchmarkDest"), Desc);
+			});
+
+			UE_LOG(LogDLSSPersistentResources, Log, TEXT("RDG setup over %d graphs: transient helper textures %.2f us, persistent %.2f us per graph"),
+				NumGraphs, TransientMicroseconds, PersistentMicroseconds);
+		});
+	}));
+#endif
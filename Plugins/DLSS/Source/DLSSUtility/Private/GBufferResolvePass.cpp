@@ -10,9 +10,11 @@
 */
 
 #include "GBufferResolvePass.h"
+#include "DLSSAsyncCompute.h"
 #if __has_include("DataDrivenShaderPlatformInfo.h")
 #include "DataDrivenShaderPlatformInfo.h"
 #endif
+#include "RenderGraphUtils.h"
 #include "RHIResources.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "SceneTextureParameters.h"
@@ -32,12 +34,54 @@ static TAutoConsoleVariable<bool> CVarNGXDLSSDisableSubsurfaceCheckerboard(
 	ECVF_RenderThreadSafe
 );
 
+static TAutoConsoleVariable<int32> CVarNGXDLSSGBufferResolveCompute(
+	TEXT("r.NGX.DLSS.GBufferResolve.Compute"),
+	2,
+	TEXT("How the DLSS-RR guide buffers get resolved from the GBuffer (default = 2)\n")
+	TEXT("0: full screen pixel shader\n")
+	TEXT("1: compute shader, skipping the GBuffer decode for 8x8 tiles without geometry\n")
+	TEXT("2: compute shader with packed guide buffers. The roughness only goes into the normal alpha, which DLSS-RR reads in its packed roughness mode, and the reflection hit distance gets stored as half\n"),
+	ECVF_RenderThreadSafe);
+
+DECLARE_STATS_GROUP(TEXT("DLSS GBuffer Resolve"), STATGROUP_DLSSGBufferResolve, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Guide Buffers Written (KB)"), STAT_DLSSGBufferResolveKBWritten, STATGROUP_DLSSGBufferResolve);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Guide Buffer Traffic Saved by Packing (KB)"), STAT_DLSSGBufferResolveKBTrafficSaved, STATGROUP_DLSSGBufferResolve);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Transient Memory Saved by Packing (KB)"), STAT_DLSSGBufferResolveKBTransientSaved, STATGROUP_DLSSGBufferResolve);
+
+const int32 kGBufferResolveComputeTileSizeX = FComputeShaderUtils::kGolden2DGroupSize;
+const int32 kGBufferResolveComputeTileSizeY = FComputeShaderUtils::kGolden2DGroupSize;
+
 class FDiffuseSpecularAlbedoDim : SHADER_PERMUTATION_BOOL("DIFFUSE_SPECULAR_ALBEDO");
 class FForceDisableSubsurfaceCheckerboardDim : SHADER_PERMUTATION_BOOL("FORCE_DISABLE_SUBSURFACE_CHECKERBOARD");
 class FOutputSpecularHitTDim : SHADER_PERMUTATION_BOOL("SPECULAR_HITT");
 class FOutputSSSTDim : SHADER_PERMUTATION_BOOL("SSS");
 class FOutputDOFTDim : SHADER_PERMUTATION_BOOL("DOF");
 class FPassthroughDim : SHADER_PERMUTATION_BOOL("PASSTHROUGH_FEATURE_BUFFERS");
+class FPackedGuideBuffersDim : SHADER_PERMUTATION_BOOL("PACKED_GUIDE_BUFFERS");
+
+static bool ShouldCompileGBufferResolvePermutation(const FGlobalShaderPermutationParameters& Parameters, bool bOutputSpecularHitT, bool bOutputSSS, bool bOutputDOF)
+{
+#if !SUPPORT_GUIDE_GBUFFER
+	if (bOutputSpecularHitT)
+	{
+		return false;
+	}
+#endif
+
+#if !SUPPORT_GUIDE_SSS_DOF
+	if (bOutputSSS || bOutputDOF)
+	{
+		return false;
+	}
+#endif
+
+	// Only cook for the platforms/RHIs where DLSS is supported, which is DX11,DX12 and Vulkan [on Win64]
+	return 	IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5) &&
+			IsPCPlatform(Parameters.Platform) && (
+				IsVulkanPlatform(Parameters.Platform) ||
+				IsD3DPlatform(Parameters.Platform));
+}
+
 class FGBufferResolvePS : public FGlobalShader
 {
 public:
@@ -52,37 +96,68 @@ public:
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
 	{
 		FPermutationDomain PermutationVector(Parameters.PermutationId);
+		return ShouldCompileGBufferResolvePermutation(Parameters,
+			PermutationVector.Get<FOutputSpecularHitTDim>(), PermutationVector.Get<FOutputSSSTDim>(), PermutationVector.Get<FOutputDOFTDim>());
+	}
 
-		if (PermutationVector.Get<FOutputSpecularHitTDim>() == true)
-		{
-#if !SUPPORT_GUIDE_GBUFFER
-			return false;
-#endif
-		}
+	using FPermutationDomain = TShaderPermutationDomain<FDiffuseSpecularAlbedoDim, FForceDisableSubsurfaceCheckerboardDim
+		, FPassthroughDim, FOutputSpecularHitTDim, FOutputSSSTDim, FOutputDOFTDim>;
 
-		if (PermutationVector.Get<FOutputSSSTDim>() == true)
-		{
-#if !SUPPORT_GUIDE_SSS_DOF
-			return false;
-#endif
-		}
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_STRUCT_INCLUDE(FSceneTextureShaderParameters, SceneTextures)
+		SHADER_PARAMETER_STRUCT_REF(FViewUniformShaderParameters, View)
+		SHADER_PARAMETER_TEXTURE(Texture2D, PreIntegratedGF)
+		SHADER_PARAMETER_SAMPLER(SamplerState, PreIntegratedGFSampler)
+		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, InputViewPort)
+		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, OutputViewPort)
 
-		if (PermutationVector.Get<FOutputDOFTDim>() == true)
+		// Should we explicitly ifdef these out for configs that can't use them
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float4>, PassthroughDiffuse)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float4>, PassthroughSpecular)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float4>, PassthroughNormalRoughness)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, PassthroughDepth)
+
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, ReflectionHitDistance)
+
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, SubsurfaceScatteringGuide)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, DepthOfFieldGuide)
+
+		RENDER_TARGET_BINDING_SLOTS()
+	END_SHADER_PARAMETER_STRUCT()
+};
+
+IMPLEMENT_GLOBAL_SHADER(FGBufferResolvePS, "/Plugin/DLSS/Private/GBufferResolve.usf", "GBufferResolvePixelShader", SF_Pixel);
+
+class FGBufferResolveCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGBufferResolveCS);
+	SHADER_USE_PARAMETER_STRUCT(FGBufferResolveCS, FGlobalShader);
+
+	using FPermutationDomain = TShaderPermutationDomain<FDiffuseSpecularAlbedoDim, FForceDisableSubsurfaceCheckerboardDim
+		, FPassthroughDim, FOutputSpecularHitTDim, FOutputSSSTDim, FOutputDOFTDim, FPackedGuideBuffersDim>;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		FPermutationDomain PermutationVector(Parameters.PermutationId);
+
+		// packing only changes the albedo, normal and roughness outputs
+		if (!PermutationVector.Get<FDiffuseSpecularAlbedoDim>() && PermutationVector.Get<FPackedGuideBuffersDim>())
 		{
-#if !SUPPORT_GUIDE_SSS_DOF
 			return false;
-#endif
 		}
 
-		// Only cook for the platforms/RHIs where DLSS is supported, which is DX11,DX12 and Vulkan [on Win64]
-		return 	IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5) &&
-				IsPCPlatform(Parameters.Platform) && (
-					IsVulkanPlatform(Parameters.Platform) ||
-					IsD3DPlatform(Parameters.Platform));
+		return ShouldCompileGBufferResolvePermutation(Parameters,
+			PermutationVector.Get<FOutputSpecularHitTDim>(), PermutationVector.Get<FOutputSSSTDim>(), PermutationVector.Get<FOutputDOFTDim>());
 	}
 
-	using FPermutationDomain = TShaderPermutationDomain<FDiffuseSpecularAlbedoDim, FForceDisableSubsurfaceCheckerboardDim
-		, FPassthroughDim, FOutputSpecularHitTDim, FOutputSSSTDim, FOutputDOFTDim>;
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEX"), kGBufferResolveComputeTileSizeX);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEY"), kGBufferResolveComputeTileSizeY);
+		OutEnvironment.SetDefine(TEXT("GBUFFER_RESOLVE_COMPUTE"), 1);
+	}
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
 		SHADER_PARAMETER_STRUCT_INCLUDE(FSceneTextureShaderParameters, SceneTextures)
@@ -92,7 +167,6 @@ public:
 		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, InputViewPort)
 		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, OutputViewPort)
 
-		// Should we explicitly ifdef these out for configs that can't use them
 		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float4>, PassthroughDiffuse)
 		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float4>, PassthroughSpecular)
 		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float4>, PassthroughNormalRoughness)
@@ -103,11 +177,195 @@ public:
 		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, SubsurfaceScatteringGuide)
 		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, DepthOfFieldGuide)
 
-		RENDER_TARGET_BINDING_SLOTS()
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float3>, RWDiffuseAlbedo)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float3>, RWSpecularAlbedo)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, RWNormal)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, RWRoughness)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, RWLinearDepth)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, RWReflectionHitDistance)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, RWSubsurfaceScatteringGuide)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, RWDepthOfFieldGuide)
 	END_SHADER_PARAMETER_STRUCT()
 };
 
-IMPLEMENT_GLOBAL_SHADER(FGBufferResolvePS, "/Plugin/DLSS/Private/GBufferResolve.usf", "GBufferResolvePixelShader", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FGBufferResolveCS, "/Plugin/DLSS/Private/GBufferResolve.usf", "GBufferResolveCS", SF_Compute);
+
+static uint64 GetGuideBufferBytes(FRDGTextureRef Texture)
+{
+	return Texture ? uint64(GPixelFormats[Texture->Desc.Format].BlockBytes) * Texture->Desc.Extent.X * Texture->Desc.Extent.Y : 0;
+}
+
+static FGBufferResolveOutputs AddGBufferResolveComputePass(FRDGBuilder& GraphBuilder,
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	const FSceneView& View,
+	const ITemporalUpscaler::FInputs& PassInputs,
+#else
+	const FViewInfo& View,
+#endif
+	FIntRect InputViewRect,
+	const bool bComputeDiffuseSpecularAlbedo,
+	const bool bPackGuideBuffers
+)
+{
+	FGBufferResolveOutputs Outputs;
+	FGBufferResolveCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGBufferResolveCS::FParameters>();
+
+	// whether the engine has produced a set of precomposited reflection data
+	bool bPrecomposite = false;
+	bool bApplyHitT = false;
+	bool bApplySSS = false;
+	bool bApplyDOF = false;
+	// what the unpacked outputs would have needed on top, per pixel
+	uint32 UnpackedExtraBytesPerPixel = 0;
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	PassParameters->SceneTextures = CreateSceneTextureShaderParameters(GraphBuilder, View, ESceneTextureSetupMode::All);
+#else
+	PassParameters->SceneTextures = CreateSceneTextureShaderParameters(GraphBuilder, View.GetSceneTexturesChecked(), View.GetFeatureLevel(), ESceneTextureSetupMode::All);
+#endif
+
+	PassParameters->View = View.ViewUniformBuffer;
+	PassParameters->PreIntegratedGF = GSystemTextures.PreintegratedGF->GetRHI();
+	PassParameters->PreIntegratedGFSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+
+	const FIntPoint OutputExtent = InputViewRect.Size();
+	auto CreateOutput = [&GraphBuilder, OutputExtent](EPixelFormat Format, const TCHAR* Name)
+	{
+		return GraphBuilder.CreateTexture(FRDGTextureDesc::Create2D(
+			OutputExtent,
+			Format,
+			FClearValueBinding::None,
+			TexCreate_ShaderResource | TexCreate_UAV
+		), Name);
+	};
+
+	if (bComputeDiffuseSpecularAlbedo)
+	{
+		// R10G10B10A2 has the same size and less precision in the darks, so the albedos stay R11G11B10
+		Outputs.DiffuseAlbedo = CreateOutput(PF_FloatR11G11B10, TEXT("DLSS.DiffuseAlbedo"));
+		Outputs.SpecularAlbedo = CreateOutput(PF_FloatR11G11B10, TEXT("DLSS.SpecularAlbedo"));
+		// DLSS-RR needs signed, not octahedral, normals, so half precision RGBA with the roughness in alpha is as compact as it gets
+		Outputs.Normals = CreateOutput(PF_FloatRGBA, TEXT("DLSS.Normal"));
+		Outputs.LinearDepth = CreateOutput(PF_R32_FLOAT, TEXT("DLSS.Depth"));
+
+		PassParameters->RWDiffuseAlbedo = GraphBuilder.CreateUAV(Outputs.DiffuseAlbedo);
+		PassParameters->RWSpecularAlbedo = GraphBuilder.CreateUAV(Outputs.SpecularAlbedo);
+		PassParameters->RWNormal = GraphBuilder.CreateUAV(Outputs.Normals);
+		PassParameters->RWLinearDepth = GraphBuilder.CreateUAV(Outputs.LinearDepth);
+
+		if (bPackGuideBuffers)
+		{
+			UnpackedExtraBytesPerPixel += GPixelFormats[PF_R32_FLOAT].BlockBytes;
+		}
+		else
+		{
+			Outputs.Roughness = CreateOutput(PF_R32_FLOAT, TEXT("DLSS.Roughness"));
+			PassParameters->RWRoughness = GraphBuilder.CreateUAV(Outputs.Roughness);
+		}
+
+#if SUPPORT_GUIDE_GBUFFER
+		if (PassInputs.GuideBuffers.ReflectionHitDistance.IsValid())
+		{
+			Outputs.ReflectionHitDistance = CreateOutput(bPackGuideBuffers ? PF_R16F : PF_R32_FLOAT, TEXT("DLSS.SpecularHitT"));
+			PassParameters->RWReflectionHitDistance = GraphBuilder.CreateUAV(Outputs.ReflectionHitDistance);
+			PassParameters->ReflectionHitDistance = PassInputs.GuideBuffers.ReflectionHitDistance.Texture;
+
+			if (bPackGuideBuffers)
+			{
+				UnpackedExtraBytesPerPixel += GPixelFormats[PF_R32_FLOAT].BlockBytes - GPixelFormats[PF_R16F].BlockBytes;
+			}
+
+			bApplyHitT = true;
+		}
+
+		// procomposited guide buffers from the engine
+		bPrecomposite =
+			PassInputs.GuideBuffers.DiffuseGuideBuffer.IsValid() &&
+			PassInputs.GuideBuffers.SpecularGuideBuffer.IsValid() &&
+			PassInputs.GuideBuffers.NormalRoughnessGuideBuffer.IsValid() &&
+			PassInputs.GuideBuffers.DepthGuideBuffer.IsValid();
+
+		PassParameters->PassthroughDiffuse = PassInputs.GuideBuffers.DiffuseGuideBuffer.Texture;
+		PassParameters->PassthroughSpecular = PassInputs.GuideBuffers.SpecularGuideBuffer.Texture;
+		PassParameters->PassthroughNormalRoughness = PassInputs.GuideBuffers.NormalRoughnessGuideBuffer.Texture;
+		PassParameters->PassthroughDepth = PassInputs.GuideBuffers.DepthGuideBuffer.Texture;
+#endif
+
+#if SUPPORT_GUIDE_SSS_DOF
+		if (PassInputs.GuideBuffers.SSSGuideBuffer.IsValid())
+		{
+			Outputs.SubsurfaceScatteringGuide = CreateOutput(PF_R16F, TEXT("DLSS.SubsurfaceScatteringGuide"));
+			PassParameters->RWSubsurfaceScatteringGuide = GraphBuilder.CreateUAV(Outputs.SubsurfaceScatteringGuide);
+			PassParameters->SubsurfaceScatteringGuide = PassInputs.GuideBuffers.SSSGuideBuffer.Texture;
+
+			bApplySSS = true;
+		}
+
+		if (PassInputs.GuideBuffers.DOFGuideBuffer.IsValid())
+		{
+			Outputs.DepthOfFieldGuide = CreateOutput(PF_R16F, TEXT("DLSS.DepthOfFieldGuide"));
+			PassParameters->RWDepthOfFieldGuide = GraphBuilder.CreateUAV(Outputs.DepthOfFieldGuide);
+			PassParameters->DepthOfFieldGuide = PassInputs.GuideBuffers.DOFGuideBuffer.Texture;
+
+			bApplyDOF = true;
+		}
+#endif
+	}
+
+	FGBufferResolveCS::FPermutationDomain PermutationVector;
+	PermutationVector.Set<FDiffuseSpecularAlbedoDim>(bComputeDiffuseSpecularAlbedo);
+	PermutationVector.Set<FOutputSpecularHitTDim>(bApplyHitT);
+	PermutationVector.Set<FOutputSSSTDim>(bApplySSS);
+	PermutationVector.Set<FOutputDOFTDim>(bApplyDOF);
+	PermutationVector.Set<FForceDisableSubsurfaceCheckerboardDim>(CVarNGXDLSSDisableSubsurfaceCheckerboard.GetValueOnRenderThread());
+	PermutationVector.Set<FPassthroughDim>(bPrecomposite);
+	PermutationVector.Set<FPackedGuideBuffersDim>(bComputeDiffuseSpecularAlbedo && bPackGuideBuffers);
+
+	// shift output buffers to top left corner
+	PassParameters->InputViewPort = GetScreenPassTextureViewportParameters(FScreenPassTextureViewport(InputViewRect));
+	PassParameters->OutputViewPort = GetScreenPassTextureViewportParameters(FScreenPassTextureViewport(OutputExtent));
+
+	const FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(View.GetFeatureLevel());
+	TShaderMapRef<FGBufferResolveCS> ComputeShader(ShaderMap, PermutationVector);
+
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("GBufferResolve Compute%s%s%s%s%s (%dx%d)"
+			, bComputeDiffuseSpecularAlbedo ? TEXT(" DiffuseSpecularAlbedo") : TEXT("")
+			, bApplyHitT ? TEXT(" ReflectionDistance") : TEXT("")
+			, bApplySSS ? TEXT(" SSS") : TEXT("")
+			, bApplyDOF ? TEXT(" DOF") : TEXT("")
+			, bPackGuideBuffers ? TEXT(" Packed") : TEXT("")
+			, OutputExtent.X, OutputExtent.Y
+		),
+		GetDLSSComputePassFlags(EDLSSComputePass::GBufferResolve),
+		ComputeShader,
+		PassParameters,
+		FComputeShaderUtils::GetGroupCount(OutputExtent, FIntPoint(kGBufferResolveComputeTileSizeX, kGBufferResolveComputeTileSizeY)));
+
+	// every guide gets written here once and read by DLSS-RR once, so the packing saves its bytes twice
+	const uint64 BytesWritten = GetGuideBufferBytes(Outputs.DiffuseAlbedo) + GetGuideBufferBytes(Outputs.SpecularAlbedo)
+		+ GetGuideBufferBytes(Outputs.Normals) + GetGuideBufferBytes(Outputs.Roughness) + GetGuideBufferBytes(Outputs.LinearDepth)
+#if SUPPORT_GUIDE_GBUFFER
+		+ GetGuideBufferBytes(Outputs.ReflectionHitDistance)
+#endif
+#if SUPPORT_GUIDE_SSS_DOF
+		+ GetGuideBufferBytes(Outputs.SubsurfaceScatteringGuide) + GetGuideBufferBytes(Outputs.DepthOfFieldGuide)
+#endif
+		;
+	const uint64 BytesSaved = uint64(UnpackedExtraBytesPerPixel) * OutputExtent.X * OutputExtent.Y;
+	INC_DWORD_STAT_BY(STAT_DLSSGBufferResolveKBWritten, uint32(BytesWritten / 1024));
+	INC_DWORD_STAT_BY(STAT_DLSSGBufferResolveKBTrafficSaved, uint32(2 * BytesSaved / 1024));
+	INC_DWORD_STAT_BY(STAT_DLSSGBufferResolveKBTransientSaved, uint32(BytesSaved / 1024));
+
+	return Outputs;
+}
+
+bool ShouldUseGBufferResolveCompute()
+{
+	return CVarNGXDLSSGBufferResolveCompute.GetValueOnRenderThread() > 0;
+}
+
 FGBufferResolveOutputs AddGBufferResolvePass(FRDGBuilder& GraphBuilder,
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
 	const FSceneView& View,
@@ -119,6 +377,16 @@ FGBufferResolveOutputs AddGBufferResolvePass(FRDGBuilder& GraphBuilder,
 	const bool bComputeDiffuseSpecularAlbedo
 )
 {
+	const int32 ComputeMode = CVarNGXDLSSGBufferResolveCompute.GetValueOnRenderThread();
+	if (ComputeMode > 0)
+	{
+		return AddGBufferResolveComputePass(GraphBuilder, View,
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+			PassInputs,
+#endif
+			InputViewRect, bComputeDiffuseSpecularAlbedo, ComputeMode > 1);
+	}
+
 	FGBufferResolveOutputs Outputs;
 	FGBufferResolvePS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGBufferResolvePS::FParameters>();
 
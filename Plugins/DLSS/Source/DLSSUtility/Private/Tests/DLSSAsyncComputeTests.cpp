@@ -0,0 +1,43 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "DLSSAsyncCompute.h"
+#include "NVInputPassUtils.h"
+
+#include "Misc/AutomationTest.h"
+#include "RHIAccess.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Every pass r.NGX.DLSS.AsyncCompute.Passes can name, on the graphics and on the async compute pipe, feeding a pass declared like the
+// DLSS evaluate pass. Runs with -nullrhi, so it can be part of headless automation runs
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDLSSAsyncComputeGraphTest, "Plugins.DLSS.AsyncCompute.Graph",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FDLSSAsyncComputeGraphTest::RunTest(const FString& Parameters)
+{
+	TArray<const TCHAR*> PassNames;
+	for (int32 PassIndex = 0; PassIndex < int32(EDLSSComputePass::Num); ++PassIndex)
+	{
+		PassNames.Add(GetDLSSComputePassName(EDLSSComputePass(PassIndex)));
+	}
+
+	const ERDGPassFlags EvaluateFlags = ERDGPassFlags::Compute | ERDGPassFlags::Raster | ERDGPassFlags::Copy | ERDGPassFlags::SkipRenderPass | ERDGPassFlags::NeverCull;
+	for (const bool bAsync : { false, true })
+	{
+		TestEqual(*FString::Printf(TEXT("RDG errors with the passes on the %s pipe"), bAsync ? TEXT("async compute") : TEXT("graphics")),
+			ValidateNVAsyncComputeGraph(PassNames, bAsync, ERHIAccess::SRVMask, EvaluateFlags), 0);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,40 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "DLSSInputPrepReferenceScene.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDLSSInputPrepReferenceTest, "Plugins.DLSS.InputPrepReference",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FDLSSInputPrepReferenceTest::RunTest(const FString& Parameters)
+{
+	// CPU only, so this runs headless as well
+	const FDLSSInputPrepReferenceScene Scene(FDLSSInputPrepReferenceScene::DefaultInputSize);
+	const TArray<FDLSSInputPrepReferenceCaseResult> Results = RunDLSSInputPrepReferenceCases(Scene);
+
+	TestEqual(TEXT("Number of cases"), Results.Num(), 4);
+	for (const FDLSSInputPrepReferenceCaseResult& Result : Results)
+	{
+		TestEqual(*FString::Printf(TEXT("%s: pixels where scalar and SIMD differ"), Result.Name), Result.NumMismatchingPixels, 0);
+		if (TestTrue(*FString::Printf(TEXT("%s: has an expected CRC"), Result.Name), Result.ExpectedCrc.IsSet()))
+		{
+			TestEqual(*FString::Printf(TEXT("%s: CRC of the scalar output"), Result.Name), Result.Crc, Result.ExpectedCrc.GetValue());
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,164 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "DLSSInputPrepReferenceScene.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const FIntPoint VelocityCombineTestInputSize(67, 37);
+
+	TArray<FVector2f> CombineVelocity(const FDLSSVelocityCombineReferenceInputs& Inputs, EDLSSReferenceKernel Kernel)
+	{
+		TArray<FVector2f> Velocity;
+		Velocity.SetNumUninitialized(Inputs.GetCombinedVelocitySize().X * Inputs.GetCombinedVelocitySize().Y);
+		ComputeDLSSVelocityCombineReference(Inputs, Velocity, Kernel);
+		return Velocity;
+	}
+
+	int32 CountDifferingPixels(const TArray<FVector2f>& A, const TArray<FVector2f>& B)
+	{
+		check(A.Num() == B.Num());
+		int32 NumDifferingPixels = 0;
+		for (int32 PixelIndex = 0; PixelIndex < A.Num(); ++PixelIndex)
+		{
+			NumDifferingPixels += FMemory::Memcmp(&A[PixelIndex], &B[PixelIndex], sizeof(FVector2f)) != 0 ? 1 : 0;
+		}
+		return NumDifferingPixels;
+	}
+
+	// largest difference in pixels, like r.NGX.DLSS.VelocityCombine.Validate.Tolerance. NaN, i.e. a pixel no tile wrote, counts as infinite
+	float GetLargestDifference(const TArray<FVector2f>& A, const TArray<FVector2f>& B, int32& OutNumDifferingPixels, float Tolerance)
+	{
+		check(A.Num() == B.Num());
+		float LargestDifference = 0.0f;
+		OutNumDifferingPixels = 0;
+		for (int32 PixelIndex = 0; PixelIndex < A.Num(); ++PixelIndex)
+		{
+			const float Difference = FMath::Max(FMath::Abs(A[PixelIndex].X - B[PixelIndex].X), FMath::Abs(A[PixelIndex].Y - B[PixelIndex].Y));
+			const float Clamped = FMath::IsFinite(Difference) ? Difference : MAX_flt;
+			LargestDifference = FMath::Max(LargestDifference, Clamped);
+			OutNumDifferingPixels += Clamped > Tolerance ? 1 : 0;
+		}
+		return LargestDifference;
+	}
+
+	// runs the non dilated velocity combine over the scene once with its own depth and once with every pixel at the near plane
+	int32 CountPixelsDependingOnDepth(const FDLSSInputPrepReferenceScene& Scene, bool bAlternateMotionVectors, EDLSSReferenceKernel Kernel)
+	{
+		TArray<float> NearPlaneDepth;
+		NearPlaneDepth.Init(1.0f, Scene.Depth.Num());
+
+		FDLSSVelocityCombineReferenceInputs Inputs = Scene.GetVelocityCombineInputs(false, bAlternateMotionVectors);
+		const TArray<FVector2f> Velocity = CombineVelocity(Inputs, Kernel);
+		Inputs.Depth = NearPlaneDepth;
+		const TArray<FVector2f> NearPlaneVelocity = CombineVelocity(Inputs, Kernel);
+
+		return CountDifferingPixels(Velocity, NearPlaneVelocity);
+	}
+}
+
+// VelocityCombine.usf only reads depth for pixels without engine velocity. This checks, on the CPU reference of the kernel,
+// that the depth really doesn't contribute to the velocity of the other pixels, so a view the engine wrote velocity for
+// everywhere gets the same motion vectors without any depth reads. Dilation always reads the depth of the neighborhood
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDLSSVelocityCombineEngineVelocityTest, "Plugins.DLSS.VelocityCombine.EngineVelocityIgnoresDepth",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FDLSSVelocityCombineEngineVelocityTest::RunTest(const FString& Parameters)
+{
+	const FDLSSInputPrepReferenceScene Scene(VelocityCombineTestInputSize);
+
+	// every pixel with engine velocity, the pixels of the scene without it get an encoded zero
+	FDLSSInputPrepReferenceScene CoveredScene = Scene;
+	for (FVector4f& EncodedVelocity : CoveredScene.EncodedVelocity)
+	{
+		if (!(EncodedVelocity.X > 0.0f))
+		{
+			EncodedVelocity = FVector4f(32767.0f / 65535.0f, 32767.0f / 65535.0f, 0.0f, 0.0f);
+		}
+	}
+
+	for (const bool bAlternateMotionVectors : { false, true })
+	{
+		for (const EDLSSReferenceKernel Kernel : { EDLSSReferenceKernel::Scalar, EDLSSReferenceKernel::SIMD })
+		{
+			const FString Case = FString::Printf(TEXT("%s%s"),
+				Kernel == EDLSSReferenceKernel::SIMD ? TEXT("SIMD") : TEXT("Scalar"),
+				bAlternateMotionVectors ? TEXT(" AlternateMotionVectors") : TEXT(""));
+
+			TestEqual(*FString::Printf(TEXT("%s: pixels depending on depth with engine velocity everywhere"), *Case),
+				CountPixelsDependingOnDepth(CoveredScene, bAlternateMotionVectors, Kernel), 0);
+
+			// the sky and the floor of the scene have no engine velocity, so their camera motion has to come from depth
+			TestTrue(*FString::Printf(TEXT("%s: pixels without engine velocity depend on depth"), *Case),
+				CountPixelsDependingOnDepth(Scene, bAlternateMotionVectors, Kernel) > 0);
+		}
+	}
+
+	return true;
+}
+
+// The TILED_VELOCITY_COMBINE layout of VelocityCombine.usf, 2x2 pixels per thread and the groupshared neighborhood of the dilation,
+// against the per pixel kernel. Odd sizes leave partial tiles on the right and bottom, and the jitter extremes move the neighborhood
+// of a tile by a whole input pixel
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDLSSVelocityCombineTiledTest, "Plugins.DLSS.VelocityCombine.TiledMatchesPerPixel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FDLSSVelocityCombineTiledTest::RunTest(const FString& Parameters)
+{
+	const float Tolerance = 0.001f;
+
+	struct FTiledCase
+	{
+		const TCHAR* Name;
+		bool bDilateMotionVectors;
+		bool bAlternateMotionVectors;
+		// of the output, relative to the input
+		float UpscaleFactor;
+		FVector2f TemporalJitterPixels;
+	};
+
+	const FTiledCase Cases[] =
+	{
+		{ TEXT("Not dilated"), false, false, 1.5f, FVector2f(0.3125f, -0.4375f) },
+		{ TEXT("Not dilated AlternateMotionVectors"), false, true, 1.5f, FVector2f(0.3125f, -0.4375f) },
+		{ TEXT("Dilated"), true, false, 1.5f, FVector2f(0.3125f, -0.4375f) },
+		{ TEXT("Dilated 2x"), true, false, 2.0f, FVector2f(-0.5f, 0.5f) },
+		{ TEXT("Dilated native resolution"), true, false, 1.0f, FVector2f(0.5f, 0.5f) },
+		{ TEXT("Dilated native resolution negative jitter"), true, false, 1.0f, FVector2f(-0.5f, -0.5f) },
+	};
+
+	FDLSSInputPrepReferenceScene Scene(VelocityCombineTestInputSize);
+	for (const FTiledCase& Case : Cases)
+	{
+		Scene.OutputSize = FIntPoint(FMath::FloorToInt(Scene.InputSize.X * Case.UpscaleFactor), FMath::FloorToInt(Scene.InputSize.Y * Case.UpscaleFactor));
+
+		FDLSSVelocityCombineReferenceInputs Inputs = Scene.GetVelocityCombineInputs(Case.bDilateMotionVectors, Case.bAlternateMotionVectors);
+		Inputs.TemporalJitterPixels = Case.TemporalJitterPixels;
+
+		const TArray<FVector2f> PerPixelVelocity = CombineVelocity(Inputs, EDLSSReferenceKernel::Scalar);
+		TArray<FVector2f> TiledVelocity;
+		TiledVelocity.SetNumUninitialized(PerPixelVelocity.Num());
+		ComputeDLSSTiledVelocityCombineReference(Inputs, TiledVelocity);
+
+		int32 NumDifferingPixels = 0;
+		const float LargestDifference = GetLargestDifference(PerPixelVelocity, TiledVelocity, NumDifferingPixels, Tolerance);
+		TestEqual(*FString::Printf(TEXT("%s: pixels where the tiled kernel differs by more than %g (largest difference %g)"), Case.Name, Tolerance, LargestDifference),
+			NumDifferingPixels, 0);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -10,8 +10,11 @@
 */
 
 #include "VelocityCombinePass.h"
+#include "DLSSAsyncCompute.h"
 
+#include "HAL/IConsoleManager.h"
 #include "RenderGraphUtils.h"
+#include "RHIGPUReadback.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "ScreenPass.h"
 
@@ -22,12 +25,40 @@
 #include "ScenePrivate.h"
 #endif
 
+DEFINE_LOG_CATEGORY_STATIC(LogDLSSVelocityCombine, Log, All);
+
+static TAutoConsoleVariable<int32> CVarNGXDLSSVelocityCombineTiled(
+	TEXT("r.NGX.DLSS.VelocityCombine.Tiled"),
+	1,
+	TEXT("Whether the DLSS velocity combine pass resolves a 2x2 quad of pixels per thread, sharing the depth and velocity of the neighborhood of a tile in groupshared memory when dilating motion vectors (default = 1)\n")
+	TEXT("Only the 2x2 quad layout is implemented, the 4x1 row layout was not. Plugins.DLSS.VelocityCombine.TiledMatchesPerPixel checks the layout against the per pixel kernel\n"),
+	ECVF_RenderThreadSafe);
+
+#if !UE_BUILD_SHIPPING
+static TAutoConsoleVariable<int32> CVarNGXDLSSVelocityCombineValidate(
+	TEXT("r.NGX.DLSS.VelocityCombine.Validate"),
+	0,
+	TEXT("Runs both the per pixel and the tiled DLSS velocity combine kernel each frame and logs when their outputs differ (default = 0)\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarNGXDLSSVelocityCombineValidateTolerance(
+	TEXT("r.NGX.DLSS.VelocityCombine.Validate.Tolerance"),
+	0.001f,
+	TEXT("Largest difference in pixels between the per pixel and the tiled DLSS velocity combine kernel that r.NGX.DLSS.VelocityCombine.Validate accepts (default = 0.001)\n"),
+	ECVF_RenderThreadSafe);
+#endif
+
 const int32 kVelocityCombineComputeTileSizeX = FComputeShaderUtils::kGolden2DGroupSize;
 const int32 kVelocityCombineComputeTileSizeY = FComputeShaderUtils::kGolden2DGroupSize;
 
+// must match TILE_SIZEX/TILE_SIZEY in VelocityCombine.usf and TiledVelocityCombineTileSize in DLSSInputPrepReference.cpp
+const int32 kVelocityCombineTiledPixelsPerGroupX = kVelocityCombineComputeTileSizeX * 2;
+const int32 kVelocityCombineTiledPixelsPerGroupY = kVelocityCombineComputeTileSizeY * 2;
+
 
 class FDilateMotionVectorsDim : SHADER_PERMUTATION_BOOL("DILATE_MOTION_VECTORS");
 class FSupportAlternateMotionVectorDim : SHADER_PERMUTATION_BOOL("SUPPORT_ALTERNATE_MOTION_VECTOR");
+class FTiledVelocityCombineDim : SHADER_PERMUTATION_BOOL("TILED_VELOCITY_COMBINE");
 
 class FVelocityCombineCS : public FGlobalShader
 {
@@ -47,7 +78,7 @@ public:
 		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEX"), kVelocityCombineComputeTileSizeX);
 		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEY"), kVelocityCombineComputeTileSizeY);
 	}
-	using FPermutationDomain = TShaderPermutationDomain<FDilateMotionVectorsDim, FSupportAlternateMotionVectorDim>;
+	using FPermutationDomain = TShaderPermutationDomain<FDilateMotionVectorsDim, FSupportAlternateMotionVectorDim, FTiledVelocityCombineDim>;
 
 	DECLARE_GLOBAL_SHADER(FVelocityCombineCS);
 	SHADER_USE_PARAMETER_STRUCT(FVelocityCombineCS, FGlobalShader);
@@ -77,6 +108,199 @@ public:
 
 IMPLEMENT_GLOBAL_SHADER(FVelocityCombineCS, "/Plugin/DLSS/Private/VelocityCombine.usf", "VelocityCombineMain", SF_Compute);
 
+#if !UE_BUILD_SHIPPING
+class FVelocityCombineCompareCS : public FGlobalShader
+{
+public:
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return FVelocityCombineCS::ShouldCompilePermutation(Parameters);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FVelocityCombineCS::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+	}
+
+	DECLARE_GLOBAL_SHADER(FVelocityCombineCompareCS);
+	SHADER_USE_PARAMETER_STRUCT(FVelocityCombineCompareCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float2>, ReferenceVelocityTexture)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float2>, TestVelocityTexture)
+		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, CombinedVelocity)
+		SHADER_PARAMETER(float, CompareTolerance)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, OutCompareResults)
+	END_SHADER_PARAMETER_STRUCT()
+};
+
+IMPLEMENT_GLOBAL_SHADER(FVelocityCombineCompareCS, "/Plugin/DLSS/Private/VelocityCombine.usf", "VelocityCombineCompareMain", SF_Compute);
+
+// Compares the tiled kernel against the per pixel one on real frames.
+// Render thread only, like AddVelocityCombinePass. A global resource so the readbacks get freed at RHI shutdown
+class FVelocityCombineValidator : public FRenderResource
+{
+public:
+	static FVelocityCombineValidator& Get();
+
+	virtual void ReleaseRHI() override
+	{
+		for (FPendingReadback& Pending : PendingReadbacks)
+		{
+			Pending.Readback.Reset();
+		}
+		FirstPendingReadback = 0;
+		NumPendingReadbacks = 0;
+	}
+
+	// TestName and ReferenceName only go into the log, so they have to be string literals
+	void AddComparePass(FRDGBuilder& GraphBuilder, const FGlobalShaderMap* ShaderMap, const TCHAR* TestName, const TCHAR* ReferenceName, FRDGTextureRef ReferenceTexture, FRDGTextureRef TestTexture, const FScreenPassTextureViewportParameters& Viewport, FIntPoint ViewportSize)
+	{
+		ProcessReadbacks();
+
+		// never wait on the GPU here, rather skip a comparison
+		if (NumPendingReadbacks == MaxPendingReadbacks)
+		{
+			return;
+		}
+
+		FPendingReadback& Pending = PendingReadbacks[(FirstPendingReadback + NumPendingReadbacks) % MaxPendingReadbacks];
+		if (!Pending.Readback.IsValid())
+		{
+			Pending.Readback = MakeUnique<FRHIGPUBufferReadback>(TEXT("DLSS.VelocityCombineCompareReadback"));
+		}
+		Pending.TestName = TestName;
+		Pending.ReferenceName = ReferenceName;
+		Pending.ViewportSize = ViewportSize;
+		Pending.Tolerance = CVarNGXDLSSVelocityCombineValidateTolerance.GetValueOnRenderThread();
+
+		FRDGBufferRef CompareResults = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), NumCompareResults), TEXT("DLSSVelocityCombineCompareResults"));
+		FRDGBufferUAVRef CompareResultsUAV = GraphBuilder.CreateUAV(CompareResults, PF_R32_UINT);
+		AddClearUAVPass(GraphBuilder, CompareResultsUAV, 0u);
+
+		FVelocityCombineCompareCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FVelocityCombineCompareCS::FParameters>();
+		PassParameters->ReferenceVelocityTexture = ReferenceTexture;
+		PassParameters->TestVelocityTexture = TestTexture;
+		PassParameters->CombinedVelocity = Viewport;
+		PassParameters->CompareTolerance = Pending.Tolerance;
+		PassParameters->OutCompareResults = CompareResultsUAV;
+
+		TShaderMapRef<FVelocityCombineCompareCS> ComputeShader(ShaderMap);
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("Velocity Combine Compare (%dx%d)", ViewportSize.X, ViewportSize.Y),
+			ComputeShader,
+			PassParameters,
+			FComputeShaderUtils::GetGroupCount(ViewportSize, FComputeShaderUtils::kGolden2DGroupSize));
+
+		AddEnqueueCopyPass(GraphBuilder, Pending.Readback.Get(), CompareResults, NumCompareResults * sizeof(uint32));
+		++NumPendingReadbacks;
+	}
+
+private:
+	void ProcessReadbacks()
+	{
+		// readbacks complete in submission order, so stop at the first one that isn't ready yet
+		while (NumPendingReadbacks > 0 && PendingReadbacks[FirstPendingReadback].Readback->IsReady())
+		{
+			FPendingReadback& Pending = PendingReadbacks[FirstPendingReadback];
+
+			const uint32* Results = static_cast<const uint32*>(Pending.Readback->Lock(NumCompareResults * sizeof(uint32)));
+			const uint32 NumMismatchingPixels = Results[0];
+			float MaxDifference;
+			FMemory::Memcpy(&MaxDifference, &Results[1], sizeof(float));
+			Pending.Readback->Unlock();
+
+			++NumValidatedFrames;
+			if (NumMismatchingPixels > 0)
+			{
+				++NumMismatchingFrames;
+				UE_LOG(LogDLSSVelocityCombine, Warning, TEXT("%s differs from %s in %u of %d pixels (%dx%d), by up to %f pixels (tolerance %f). %u of %u validated frames differed"),
+					Pending.TestName, Pending.ReferenceName, NumMismatchingPixels, Pending.ViewportSize.X * Pending.ViewportSize.Y, Pending.ViewportSize.X, Pending.ViewportSize.Y, MaxDifference, Pending.Tolerance, NumMismatchingFrames, NumValidatedFrames);
+			}
+			else
+			{
+				UE_LOG(LogDLSSVelocityCombine, Verbose, TEXT("%s matches %s (%dx%d), largest difference %f pixels"),
+					Pending.TestName, Pending.ReferenceName, Pending.ViewportSize.X, Pending.ViewportSize.Y, MaxDifference);
+			}
+
+			FirstPendingReadback = (FirstPendingReadback + 1) % MaxPendingReadbacks;
+			--NumPendingReadbacks;
+		}
+	}
+
+	static constexpr int32 NumCompareResults = 2;
+	static constexpr int32 MaxPendingReadbacks = 4;
+
+	struct FPendingReadback
+	{
+		TUniquePtr<FRHIGPUBufferReadback> Readback;
+		const TCHAR* TestName = TEXT("");
+		const TCHAR* ReferenceName = TEXT("");
+		FIntPoint ViewportSize = FIntPoint::ZeroValue;
+		float Tolerance = 0.0f;
+	};
+
+	FPendingReadback PendingReadbacks[MaxPendingReadbacks];
+	int32 FirstPendingReadback = 0;
+	int32 NumPendingReadbacks = 0;
+
+	uint32 NumValidatedFrames = 0;
+	uint32 NumMismatchingFrames = 0;
+};
+
+static TGlobalResource<FVelocityCombineValidator> GVelocityCombineValidator;
+
+FVelocityCombineValidator& FVelocityCombineValidator::Get()
+{
+	return GVelocityCombineValidator;
+}
+#endif
+
+static bool CanUseTiledVelocityCombine(bool bDilateMotionVectors, FIntRect InputViewRect, FIntRect OutputViewRect)
+{
+	// the groupshared neighborhood is sized for at most one input pixel per output pixel, which holds as long as DLSS only upscales
+	return !bDilateMotionVectors || (InputViewRect.Width() <= OutputViewRect.Width() && InputViewRect.Height() <= OutputViewRect.Height());
+}
+
+static void AddVelocityCombineKernelPass(
+	FRDGBuilder& GraphBuilder,
+	const FGlobalShaderMap* ShaderMap,
+	const FVelocityCombineCS::FParameters& SharedParameters,
+	FVelocityCombineCS::FPermutationDomain PermutationVector,
+	bool bTiled,
+	FRDGTextureRef CombinedVelocityTexture,
+	FIntRect InputViewRect,
+	FIntRect OutputViewRect)
+{
+	FVelocityCombineCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FVelocityCombineCS::FParameters>();
+	*PassParameters = SharedParameters;
+	PassParameters->OutVelocityCombinedTexture = GraphBuilder.CreateUAV(CombinedVelocityTexture);
+
+	PermutationVector.Set<FTiledVelocityCombineDim>(bTiled);
+	TShaderMapRef<FVelocityCombineCS> ComputeShader(ShaderMap, PermutationVector);
+
+	const bool bDilateMotionVectors = PermutationVector.Get<FDilateMotionVectorsDim>();
+	const bool bHasAlternateMotionVectors = PermutationVector.Get<FSupportAlternateMotionVectorDim>();
+	const FIntPoint PixelsPerGroup = bTiled ?
+		FIntPoint(kVelocityCombineTiledPixelsPerGroupX, kVelocityCombineTiledPixelsPerGroupY) :
+		FIntPoint(kVelocityCombineComputeTileSizeX, kVelocityCombineComputeTileSizeY);
+
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("Velocity Combine%s%s%s (%dx%d -> %dx%d)", 
+			bDilateMotionVectors ? TEXT(" Dilate") : TEXT(""),
+			bHasAlternateMotionVectors ? TEXT(" AlternateMotionVectors") : TEXT("SceneMotionVectors"),
+			bTiled ? TEXT(" Tiled") : TEXT(""),
+			InputViewRect.Width(), InputViewRect.Height(),
+			OutputViewRect.Width(), OutputViewRect.Height()
+		),
+		GetDLSSComputePassFlags(EDLSSComputePass::VelocityCombine),
+		ComputeShader,
+		PassParameters,
+		FComputeShaderUtils::GetGroupCount(OutputViewRect.Size(), PixelsPerGroup));
+}
+
 FRDGTextureRef AddVelocityCombinePass(
 	FRDGBuilder& GraphBuilder,
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
@@ -132,13 +356,8 @@ FRDGTextureRef AddVelocityCombinePass(
 	}
 
 	// output combined velocity
-	{
-		PassParameters->OutVelocityCombinedTexture = GraphBuilder.CreateUAV(CombinedVelocityTexture);
-
-		FScreenPassTextureViewport CombinedVelocityViewport(CombinedVelocityTexture, OutputViewRect);
-		FScreenPassTextureViewportParameters CombinedVelocityViewportParameters = GetScreenPassTextureViewportParameters(CombinedVelocityViewport);
-		PassParameters->CombinedVelocity = CombinedVelocityViewportParameters;
-	}
+	FScreenPassTextureViewport CombinedVelocityViewport(CombinedVelocityTexture, OutputViewRect);
+	PassParameters->CombinedVelocity = GetScreenPassTextureViewportParameters(CombinedVelocityViewport);
 
 	// various state
 	{
@@ -151,19 +370,24 @@ FRDGTextureRef AddVelocityCombinePass(
 	PermutationVector.Set<FSupportAlternateMotionVectorDim>(bHasAlternateMotionVectors);
 
 	const FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(View.GetFeatureLevel());
-	TShaderMapRef<FVelocityCombineCS> ComputeShader(ShaderMap, PermutationVector);
+	const bool bCanUseTiled = CanUseTiledVelocityCombine(bDilateMotionVectors, InputViewRect, OutputViewRect);
+	const bool bTiled = bCanUseTiled && CVarNGXDLSSVelocityCombineTiled.GetValueOnRenderThread() != 0;
+
+	AddVelocityCombineKernelPass(GraphBuilder, ShaderMap, *PassParameters, PermutationVector, bTiled, CombinedVelocityTexture, InputViewRect, OutputViewRect);
+
+#if !UE_BUILD_SHIPPING
+	if (bCanUseTiled && CVarNGXDLSSVelocityCombineValidate.GetValueOnRenderThread() != 0)
+	{
+		// DLSS keeps consuming the kernel selected by r.NGX.DLSS.VelocityCombine.Tiled, the other one only feeds the comparison
+		FRDGTextureRef OtherVelocityTexture = GraphBuilder.CreateTexture(CombinedVelocityDesc, TEXT("DLSSCombinedVelocityValidation"));
+		AddVelocityCombineKernelPass(GraphBuilder, ShaderMap, *PassParameters, PermutationVector, !bTiled, OtherVelocityTexture, InputViewRect, OutputViewRect);
+
+		FVelocityCombineValidator::Get().AddComparePass(GraphBuilder, ShaderMap, TEXT("Tiled velocity combine"), TEXT("the per pixel kernel"),
+			bTiled ? OtherVelocityTexture : CombinedVelocityTexture,
+			bTiled ? CombinedVelocityTexture : OtherVelocityTexture,
+			PassParameters->CombinedVelocity, OutputViewRect.Size());
+	}
+#endif
 
-	FComputeShaderUtils::AddPass(
-		GraphBuilder,
-		RDG_EVENT_NAME("Velocity Combine%s%s (%dx%d -> %dx%d)", 
-			bDilateMotionVectors ? TEXT(" Dilate") : TEXT(""),
-			bHasAlternateMotionVectors ? TEXT(" AlternateMotionVectors") : TEXT("SceneMotionVectors"),
-			InputViewRect.Width(), InputViewRect.Height(),
-			OutputViewRect.Width(), OutputViewRect.Height()
-		),
-		ComputeShader,
-		PassParameters,
-		FComputeShaderUtils::GetGroupCount(OutputViewRect.Size(), FComputeShaderUtils::kGolden2DGroupSize));
-		
 	return CombinedVelocityTexture;
 }
\ No newline at end of file
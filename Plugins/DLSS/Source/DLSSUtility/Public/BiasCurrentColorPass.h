@@ -40,4 +40,7 @@ extern DLSSUTILITY_API FRDGTextureRef AddBiasCurrentColorPass(
 	const FIntRect& InputViewRect,
 	struct FCustomDepthTextures InSceneDepthTexture,
 	uint8 CustomOffset
-);
\ No newline at end of file
+);
+
+// PF_R8 with r.NGX.DLSS.BiasCurrentColorMask.Compact, PF_R16F otherwise
+extern DLSSUTILITY_API EPixelFormat GetBiasCurrentColorMaskFormat();
@@ -0,0 +1,32 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderGraphDefinitions.h"
+
+// compute passes that r.NGX.DLSS.AsyncCompute.Passes can move to the async compute pipe
+enum class EDLSSComputePass : uint8
+{
+	VelocityCombine,
+	BiasCurrentColor,
+	InputPrep,
+	GBufferResolve,
+	Num
+};
+
+// name of the pass in r.NGX.DLSS.AsyncCompute.Passes
+extern DLSSUTILITY_API const TCHAR* GetDLSSComputePassName(EDLSSComputePass Pass);
+
+// ERDGPassFlags::AsyncCompute if r.NGX.DLSS.AsyncCompute opts the pass in, ERDGPassFlags::Compute otherwise.
+// RDG adds the fences and transitions to the graphics pipe consumers, and runs the pass on the graphics pipe where async compute isn't available
+extern DLSSUTILITY_API ERDGPassFlags GetDLSSComputePassFlags(EDLSSComputePass Pass);
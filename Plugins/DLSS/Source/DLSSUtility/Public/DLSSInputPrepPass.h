@@ -0,0 +1,92 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RendererInterface.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "ScreenPass.h"
+#include "GBufferResolvePass.h"
+
+// Most views AddDLSSInputPrepBatchedPass handles in one dispatch, e.g. both eyes of instanced stereo or four split screen players
+constexpr int32 kDLSSInputPrepMaxBatchedViews = 4;
+
+struct FDLSSInputPrepOutputs
+{
+	FRDGTextureRef CombinedVelocity = nullptr;
+	// only if the custom depth stencil is available, same as AddBiasCurrentColorPass
+	FRDGTextureRef BiasCurrentColor = nullptr;
+	// only if bResolveGBuffer
+	FGBufferResolveOutputs ResolvedGBuffer;
+};
+
+// Whether AddDLSSInputPrepPass can replace AddBiasCurrentColorPass, AddVelocityCombinePass and, with bResolveGBuffer, AddGBufferResolvePass
+extern DLSSUTILITY_API bool CanUseDLSSInputPrepPass(
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	const ITemporalUpscaler::FInputs& PassInputs,
+#endif
+	bool bDilateMotionVectors,
+	bool bResolveGBuffer
+);
+
+// Produces the render resolution DLSS inputs of the separate passes above with a single dispatch, reading their shared inputs once
+extern DLSSUTILITY_API FDLSSInputPrepOutputs AddDLSSInputPrepPass(
+	FRDGBuilder& GraphBuilder,
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	const FSceneView& View,
+#else
+	const FViewInfo& View,
+#endif
+	FRDGTextureRef InSceneDepthTexture,
+	FRDGTextureRef InVelocityTexture,
+	FRDGTextureRef AlternateMotionVectorTexture,
+	const struct FCustomDepthTextures& CustomDepthTextures,
+	uint8 BiasCurrentColorMaskCustomOffset,
+	FIntRect InputViewRect,
+	bool bResolveGBuffer
+);
+
+// AddDLSSInputPrepPass for several views of a family that share the scene textures, with a single dispatch for all of them.
+// Returns the outputs in the order of Views, or none if the views can't be batched, in which case each of them needs AddDLSSInputPrepPass.
+// The input view rect of each view is its ViewRect. Doesn't support the GBuffer resolve, which needs the full view uniform buffer of each view
+extern DLSSUTILITY_API TArray<FDLSSInputPrepOutputs> AddDLSSInputPrepBatchedPass(
+	FRDGBuilder& GraphBuilder,
+	TConstArrayView<const FSceneView*> Views,
+	FRDGTextureRef InSceneDepthTexture,
+	FRDGTextureRef InVelocityTexture,
+	FRDGTextureRef AlternateMotionVectorTexture,
+	const struct FCustomDepthTextures& CustomDepthTextures,
+	uint8 BiasCurrentColorMaskCustomOffset
+);
+
+enum class EDLSSInputPrepBatch : uint8
+{
+	// the view got its own passes
+	None,
+	// the view added the batched dispatch of its family
+	First,
+	// the view uses the outputs of the batched dispatch the first view added
+	Later,
+};
+
+// Accounts the DLSS input preparation of a view in the STATGROUP_DLSSInputPrep counters, for whichever of the fused or the separate passes got added.
+// The estimate for the other choice is tracked as well, so the two can be compared on the same frames
+extern DLSSUTILITY_API void RecordDLSSInputPrepPassStats(
+	bool bFused,
+	FRDGTextureRef InSceneDepthTexture,
+	FRDGTextureRef InVelocityTexture,
+	FRDGTextureRef AlternateMotionVectorTexture,
+	bool bBiasCurrentColor,
+	bool bResolveGBuffer,
+	FIntRect InputViewRect,
+	EDLSSInputPrepBatch Batch = EDLSSInputPrepBatch::None
+);
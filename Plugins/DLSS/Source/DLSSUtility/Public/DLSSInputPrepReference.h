@@ -0,0 +1,68 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// CPU reference implementations of the DLSS input preparation kernels in VelocityCombine.usf and CreateBiasCurrentColor.usf,
+// to validate the GPU passes against and for offline pipelines that prepare DLSS inputs without a GPU.
+// Both variants evaluate the same operations in the same order without fused multiply-adds, so their outputs are bit identical
+enum class EDLSSReferenceKernel : uint8
+{
+	Scalar,
+	// four pixels per iteration using the VectorRegister math of the platform
+	SIMD,
+};
+
+// Buffers are tightly packed rows of the view, i.e. the viewport min of every texture is 0
+struct FDLSSVelocityCombineReferenceInputs
+{
+	// size of the depth and velocity buffers, i.e. the DLSS input resolution
+	FIntPoint InputSize = FIntPoint::ZeroValue;
+	// DLSS output resolution, only used when dilating. Without dilation the combined velocity has the input resolution
+	FIntPoint OutputSize = FIntPoint::ZeroValue;
+
+	// device Z, with an inverted Z buffer
+	TConstArrayView<float> Depth;
+	// encoded as in the scene velocity texture. Empty is equivalent to the 1x1 black texture, i.e. only camera motion
+	TConstArrayView<FVector4f> EncodedVelocity;
+	// encoded as in the alternate motion vector texture, ignored when dilating like in the shader. Empty disables them
+	TConstArrayView<FVector2f> EncodedAlternateVelocity;
+
+	// View.ClipToPrevClip
+	FMatrix44f ClipToPrevClip = FMatrix44f::Identity;
+	FVector2f TemporalJitterPixels = FVector2f::ZeroVector;
+	bool bDilateMotionVectors = false;
+
+	FIntPoint GetCombinedVelocitySize() const { return bDilateMotionVectors ? OutputSize : InputSize; }
+};
+
+// Writes GetCombinedVelocitySize() pixels of motion vectors in DLSS convention to OutVelocity.
+// The GPU pass stores them as PF_G16R16F, so compare against it after converting to half precision
+extern DLSSUTILITY_API void ComputeDLSSVelocityCombineReference(
+	const FDLSSVelocityCombineReferenceInputs& Inputs,
+	TArrayView<FVector2f> OutVelocity,
+	EDLSSReferenceKernel Kernel = EDLSSReferenceKernel::SIMD);
+
+// The same for the TILED_VELOCITY_COMBINE layout of the kernel, with its 16x16 pixel tiles and the groupshared neighborhood
+// of the dilation. Scalar only, it exists to check that layout against the per pixel kernel
+extern DLSSUTILITY_API void ComputeDLSSTiledVelocityCombineReference(
+	const FDLSSVelocityCombineReferenceInputs& Inputs,
+	TArrayView<FVector2f> OutVelocity);
+
+// Writes 1 for every pixel whose stencil value equals StencilValue and 0 for all others, like AddBiasCurrentColorPass
+extern DLSSUTILITY_API void ComputeDLSSBiasCurrentColorReference(
+	FIntPoint Size,
+	TConstArrayView<uint8> Stencil,
+	uint8 StencilValue,
+	TArrayView<float> OutBiasCurrentColor,
+	EDLSSReferenceKernel Kernel = EDLSSReferenceKernel::SIMD);
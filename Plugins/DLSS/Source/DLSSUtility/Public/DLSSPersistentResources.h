@@ -0,0 +1,49 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderGraphDefinitions.h"
+#include "RenderGraphResources.h"
+#include "RenderResource.h"
+#include "Templates/Function.h"
+
+// Constant GPU resources of the plugin (dummy textures, lookup tables, cleared masks) that get created and initialized once,
+// then registered into every graph that needs them as external textures instead of being recreated per pass. Render thread only
+class DLSSUTILITY_API FDLSSPersistentResources : public FRenderResource
+{
+public:
+	static FDLSSPersistentResources& Get();
+
+	// Returns the texture registered under Name, creating it and calling Initialize to fill it the first time or when Desc changes.
+	// Name is also the debug name of the texture, so it has to be a string literal
+	FRDGTextureRef RegisterTexture(FRDGBuilder& GraphBuilder, const TCHAR* Name, const FRDGTextureDesc& Desc, TFunctionRef<void(FRDGBuilder&, FRDGTextureRef)> Initialize);
+
+	// RegisterTexture for render targets whose content only needs to be cleared once
+	FRDGTextureRef RegisterClearedTexture(FRDGBuilder& GraphBuilder, const TCHAR* Name, const FRDGTextureDesc& Desc);
+
+	uint64 GetMemorySize() const { return MemorySize; }
+	int32 GetNumTextures() const { return Textures.Num(); }
+
+	virtual void ReleaseRHI() override;
+
+private:
+	struct FPersistentTexture
+	{
+		TRefCountPtr<IPooledRenderTarget> PooledTexture;
+		FRDGTextureDesc Desc;
+		uint64 Size = 0;
+	};
+
+	TMap<FName, FPersistentTexture> Textures;
+	uint64 MemorySize = 0;
+};
@@ -52,6 +52,10 @@ struct FGBufferResolveOutputs
 
 };
 
+// r.NGX.DLSS.GBufferResolve.Compute selects the compute resolve, with sky tile classification and, in mode 2, packed guide buffers.
+// The fused DLSS input prep pass only implements the per pixel resolve, so it leaves the GBuffer resolve to AddGBufferResolvePass then
+extern DLSSUTILITY_API bool ShouldUseGBufferResolveCompute();
+
 extern DLSSUTILITY_API FGBufferResolveOutputs AddGBufferResolvePass(
 	FRDGBuilder& GraphBuilder,
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
@@ -47,6 +47,7 @@ public class NGXRHI : ModuleRules
 					"Projects",
 					"RenderCore",
 					"RHI",
+					"TraceLog",
 
 					"NGX",
 			}
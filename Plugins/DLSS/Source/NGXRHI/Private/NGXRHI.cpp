@@ -10,10 +10,14 @@
 */
 
 #include "NGXRHI.h"
+#include "NVRenderingFeatureMemory.h"
 
 #include "Misc/Paths.h"
+#include "Features/IModularFeatures.h"
 #include "GenericPlatform/GenericPlatformFile.h"
 #include "Interfaces/IPluginManager.h"
+#include "HAL/PlatformTime.h"
+#include "Trace/Trace.h"
 
 #include "nvsdk_ngx.h"
 #include "nvsdk_ngx_params.h"
@@ -30,6 +34,63 @@ DECLARE_STATS_GROUP(TEXT("DLSS"), STATGROUP_DLSS, STATCAT_Advanced);
 DECLARE_MEMORY_STAT_POOL(TEXT("DLSS: Video memory"), STAT_DLSSInternalGPUMemory, STATGROUP_DLSS, FPlatformMemory::MCR_GPU);
 DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS: Num DLSS features"), STAT_DLSSNumFeatures, STATGROUP_DLSS);
 
+#ifndef NGX_TRACE_ENABLED
+#define NGX_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif
+
+#if NGX_TRACE_ENABLED
+// Feature lifetime events of the "NGX" trace logger. Keep in sync with FStreamlineTraceAnalyzer in the StreamlineInsights module
+UE_TRACE_CHANNEL(NGXChannel)
+
+UE_TRACE_EVENT_BEGIN(NGX, FeatureCreate)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, FeatureId)
+	UE_TRACE_EVENT_FIELD(uint32, FrameCounter)
+	UE_TRACE_EVENT_FIELD(int32, SrcWidth)
+	UE_TRACE_EVENT_FIELD(int32, SrcHeight)
+	UE_TRACE_EVENT_FIELD(int32, DestWidth)
+	UE_TRACE_EVENT_FIELD(int32, DestHeight)
+	UE_TRACE_EVENT_FIELD(int32, PerfQuality)
+	UE_TRACE_EVENT_FIELD(uint8, DenoiserMode)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(NGX, FeatureEvict)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, FeatureId)
+	UE_TRACE_EVENT_FIELD(uint32, FrameCounter)
+	UE_TRACE_EVENT_FIELD(uint8, bShutdown)
+UE_TRACE_EVENT_END()
+
+static void TraceNGXFeatureCreate(const NGXDLSSFeature* Feature, uint32 FrameCounter)
+{
+	UE_TRACE_LOG(NGX, FeatureCreate, NGXChannel)
+		<< FeatureCreate.Cycle(FPlatformTime::Cycles64())
+		<< FeatureCreate.FeatureId(UPTRINT(Feature))
+		<< FeatureCreate.FrameCounter(FrameCounter)
+		<< FeatureCreate.SrcWidth(Feature->Desc.SrcRect.Width())
+		<< FeatureCreate.SrcHeight(Feature->Desc.SrcRect.Height())
+		<< FeatureCreate.DestWidth(Feature->Desc.DestRect.Width())
+		<< FeatureCreate.DestHeight(Feature->Desc.DestRect.Height())
+		<< FeatureCreate.PerfQuality(Feature->Desc.PerfQuality)
+		<< FeatureCreate.DenoiserMode(uint8(Feature->Desc.DenoiserMode));
+}
+
+static void TraceNGXFeatureEvict(const NGXDLSSFeature* Feature, uint32 FrameCounter, bool bShutdown)
+{
+	UE_TRACE_LOG(NGX, FeatureEvict, NGXChannel)
+		<< FeatureEvict.Cycle(FPlatformTime::Cycles64())
+		<< FeatureEvict.FeatureId(UPTRINT(Feature))
+		<< FeatureEvict.FrameCounter(FrameCounter)
+		<< FeatureEvict.bShutdown(bShutdown);
+}
+
+#define TRACE_NGX_FEATURE_CREATE(Feature, FrameCounter) TraceNGXFeatureCreate(Feature, FrameCounter)
+#define TRACE_NGX_FEATURE_EVICT(Feature, FrameCounter, bShutdown) TraceNGXFeatureEvict(Feature, FrameCounter, bShutdown)
+#else
+#define TRACE_NGX_FEATURE_CREATE(Feature, FrameCounter)
+#define TRACE_NGX_FEATURE_EVICT(Feature, FrameCounter, bShutdown)
+#endif
+
 #define LOCTEXT_NAMESPACE "NGXRHI"
 
 static TAutoConsoleVariable<int32> CVarNGXLogLevel(
@@ -54,6 +115,52 @@ static TAutoConsoleVariable<int32> CVarNGXRenameLogSeverities(
 	TEXT("2: on, for all messages\n"),
 	ECVF_Default);
 
+// Reports the NGX DLSS-SR/RR video memory to the VRAM budget manager in the Streamline plugin, if that is enabled too
+class FNGXRHIMemoryReporter final : public INVRenderingFeatureMemoryReporter
+{
+public:
+	explicit FNGXRHIMemoryReporter(NGXRHI& InOwner)
+		: Owner(InOwner)
+	{
+		IModularFeatures::Get().RegisterModularFeature(GetModularFeatureName(), this);
+	}
+
+	virtual ~FNGXRHIMemoryReporter()
+	{
+		IModularFeatures::Get().UnregisterModularFeature(GetModularFeatureName(), this);
+	}
+
+	virtual void GetFootprints(TArray<FNVRenderingFeatureFootprint>& OutFootprints) const override
+	{
+		FNVRenderingFeatureFootprint& Footprint = OutFootprints.AddDefaulted_GetRef();
+		Footprint.Feature = FeatureName;
+		Footprint.Bytes = Owner.DLSSVideoMemoryBytes;
+		Footprint.Reduction = (Owner.NumIdleDLSSFeatures > 0 && !Owner.bEvictIdleDLSSFeatures) ? ENVRenderingFeatureMemoryReduction::EvictIdle : ENVRenderingFeatureMemoryReduction::None;
+	}
+
+	virtual bool ReduceFootprint(FName Feature, ENVRenderingFeatureMemoryReduction Reduction) override
+	{
+		if (Feature != FeatureName || Reduction != ENVRenderingFeatureMemoryReduction::EvictIdle)
+		{
+			return false;
+		}
+		Owner.bEvictIdleDLSSFeatures = true;
+		return true;
+	}
+
+	virtual void RestoreFootprint(FName Feature, ENVRenderingFeatureMemoryReduction Reduction) override
+	{
+		if (Feature == FeatureName)
+		{
+			Owner.bEvictIdleDLSSFeatures = false;
+		}
+	}
+
+private:
+	NGXRHI& Owner;
+	const FName FeatureName = FName(TEXT("DLSS"));
+};
+
 void FRHIDLSSArguments::Validate() const
 {
 
@@ -179,6 +286,7 @@ static void RemoveDuplicateSlashesFromPath(FString& Path)
 
 NGXRHI::NGXRHI(const FNGXRHICreateArguments& Arguments)
 	: DynamicRHI(Arguments.DynamicRHI)
+	, MemoryReporter(MakeUnique<FNGXRHIMemoryReporter>(*this))
 {
 	FString PluginNGXProductionBinariesDir  = FPaths::Combine(Arguments.PluginBaseDir, TEXT("Binaries/ThirdParty/Win64/"));
 	FString PluginNGXDevelopmentBinariesDir = FPaths::Combine(Arguments.PluginBaseDir, TEXT("Binaries/ThirdParty/Win64/Development/"));
@@ -332,6 +440,7 @@ bool NGXRHI::NeedExtraPassesForDebugLayerCompatibility()
 NGXRHI::~NGXRHI()
 {
 	UE_LOG(LogDLSSNGXRHI, Log, TEXT("%s Enter"), ANSI_TO_TCHAR(__FUNCTION__));
+	MemoryReporter.Reset();
 	UE_LOG(LogDLSSNGXRHI, Log, TEXT("%s Leave"), ANSI_TO_TCHAR(__FUNCTION__));
 }
 
@@ -589,6 +698,7 @@ NVSDK_NGX_DLSSD_Create_Params FRHIDLSSArguments::GetNGXDLSSRRCreateParams() cons
 	Result.InEnableOutputSubrects = OutputColor->GetTexture2D()->GetSizeXY() != DestRect.Size();
 	// Note: we clamp here the higher level enum (which has support for experimental) to on/off which is what NGX supports at this point in time
 	Result.InDenoiseMode = NVSDK_NGX_DLSS_Denoise_Mode_DLUnified;
+	Result.InRoughnessMode = bPackedRoughness ? NVSDK_NGX_DLSS_Roughness_Mode_Packed : NVSDK_NGX_DLSS_Roughness_Mode_Unpacked;
 
 	return Result;
 }
@@ -611,6 +721,7 @@ void NGXRHI::RegisterFeature(TSharedPtr<NGXDLSSFeature> InFeature)
 { 
 	check(!IsRunningRHIInSeparateThread() || IsInRHIThread());
 	UE_LOG(LogDLSSNGXRHI, Log, TEXT("Creating   NGX DLSS Feature  %s "), *InFeature->Desc.GetDebugDescription());
+	TRACE_NGX_FEATURE_CREATE(InFeature.Get(), FrameCounter);
 	AllocatedDLSSFeatures.Add(InFeature);
 }
 
@@ -645,6 +756,7 @@ void NGXRHI::ReleaseAllocatedFeatures()
 	for (int FeatureIndex = 0; FeatureIndex < AllocatedDLSSFeatures.Num(); ++FeatureIndex)
 	{
 		checkf(AllocatedDLSSFeatures[FeatureIndex].GetSharedReferenceCount() == 1,TEXT("There should be no FDLSSState::DLSSFeature references elsewhere."));
+		TRACE_NGX_FEATURE_EVICT(AllocatedDLSSFeatures[FeatureIndex].Get(), FrameCounter, true);
 	}
 
 	AllocatedDLSSFeatures.Empty();
@@ -682,6 +794,7 @@ void NGXRHI::TickPoolElements()
 	const uint32 kFramesUntilRelease = CVarNGXFramesUntilFeatureDestruction.GetValueOnAnyThread();
 
 	int32 FeatureIndex = 0;
+	int32 NumIdleFeatures = 0;
 
 	while (FeatureIndex < AllocatedDLSSFeatures.Num())
 	{
@@ -690,17 +803,21 @@ void NGXRHI::TickPoolElements()
 		const bool bIsUnused = Feature.GetSharedReferenceCount() == 1;
 		const bool bNotRequestedRecently = (FrameCounter - Feature->LastUsedFrame) > kFramesUntilRelease;
 
-		if (bIsUnused && bNotRequestedRecently)
+		if (bIsUnused && (bNotRequestedRecently || bEvictIdleDLSSFeatures))
 		{
+			TRACE_NGX_FEATURE_EVICT(Feature.Get(), FrameCounter, false);
 			Swap(Feature, AllocatedDLSSFeatures.Last());
 			AllocatedDLSSFeatures.Pop();
 		}
 		else
 		{
+			NumIdleFeatures += bIsUnused ? 1 : 0;
 			++FeatureIndex;
 		}
 	}
 
+	NumIdleDLSSFeatures = NumIdleFeatures;
+
 	SET_DWORD_STAT(STAT_DLSSNumFeatures, AllocatedDLSSFeatures.Num());
 	
 	if(NGXQueryFeature.CapabilityParameters)
@@ -713,6 +830,7 @@ void NGXRHI::TickPoolElements()
 		if (NVSDK_NGX_SUCCEED(ResultGetStats))
 		{
 			SET_DWORD_STAT(STAT_DLSSInternalGPUMemory, VRAM);
+			DLSSVideoMemoryBytes = VRAM;
 		}
 	}
 
@@ -20,6 +20,8 @@
 #include "nvsdk_ngx_helpers_dlssd.h"
 #include "SceneTexturesConfig.h"
 
+#include <atomic>
+
 #include "Misc/EngineVersionComparison.h"
 #define UE_VERSION_AT_LEAST(MajorVersion, MinorVersion, PatchVersion) (!UE_VERSION_OLDER_THAN(MajorVersion, MinorVersion, PatchVersion))
 
@@ -97,7 +99,8 @@ struct FDLSSFeatureDesc
 			|| bReleaseMemoryOnDelete != Other.bReleaseMemoryOnDelete
 			|| GPUNode != Other.GPUNode
 			|| GPUVisibility != Other.GPUVisibility
-			|| DenoiserMode != Other.DenoiserMode;
+			|| DenoiserMode != Other.DenoiserMode
+			|| bPackedRoughness != Other.bPackedRoughness;
 	}
 
 	bool operator == (const FDLSSFeatureDesc& Other) const
@@ -118,6 +121,7 @@ struct FDLSSFeatureDesc
 	uint32 GPUNode = 0;
 	uint32 GPUVisibility = 0;
 	ENGXDLSSDenoiserMode DenoiserMode = ENGXDLSSDenoiserMode::Off;
+	bool bPackedRoughness = false;
 
 DLSS_DISABLE_DEPRECATED_WARNINGS
 	FString GetDebugDescription() const
@@ -193,7 +197,7 @@ DLSS_DISABLE_DEPRECATED_WARNINGS
 			}
 		};
 
-		return FString::Printf(TEXT("SrcRect=[%dx%d->%dx%d], DestRect=[%dx%d->%dx%d], ScaleX=%f, ScaleY=%f, NGXDLSSPreset=%s(%d), NGXDLSSRRPreset=%s(%d), NGXPerfQuality=%s(%d), bHighResolutionMotionVectors=%d, bNonZeroSharpness=%d, bUseAutoExposure=%d, bEnableAlphaUpscaling=%d, bReleaseMemoryOnDelete=%d, GPUNode=%u, GPUVisibility=0x%x, DenoiseMode=%s"),
+		return FString::Printf(TEXT("SrcRect=[%dx%d->%dx%d], DestRect=[%dx%d->%dx%d], ScaleX=%f, ScaleY=%f, NGXDLSSPreset=%s(%d), NGXDLSSRRPreset=%s(%d), NGXPerfQuality=%s(%d), bHighResolutionMotionVectors=%d, bNonZeroSharpness=%d, bUseAutoExposure=%d, bEnableAlphaUpscaling=%d, bReleaseMemoryOnDelete=%d, GPUNode=%u, GPUVisibility=0x%x, DenoiseMode=%s, bPackedRoughness=%d"),
 			SrcRect.Min.X, SrcRect.Min.Y, SrcRect.Max.X, SrcRect.Max.Y,
 			DestRect.Min.X, DestRect.Min.Y, DestRect.Max.X, DestRect.Max.Y,
 			float(SrcRect.Width()) / float(DestRect.Width()),
@@ -208,7 +212,8 @@ DLSS_DISABLE_DEPRECATED_WARNINGS
 			bReleaseMemoryOnDelete,
 			GPUNode,
 			GPUVisibility,
-			NGXDenoiserModeString(DenoiserMode));
+			NGXDenoiserModeString(DenoiserMode),
+			bPackedRoughness);
 
 	}
 DLSS_RESTORE_DEPRECATED_WARNINGS
@@ -281,6 +286,8 @@ struct NGXRHI_API FRHIDLSSArguments
 	uint32 GPUVisibility = 0;
 
 	ENGXDLSSDenoiserMode DenoiserMode = ENGXDLSSDenoiserMode::Off;
+	// DLSS-RR reads roughness from InputNormals.w instead of InputRoughness
+	bool bPackedRoughness = false;
 
 	void Validate() const;
 	
@@ -290,7 +297,7 @@ struct NGXRHI_API FRHIDLSSArguments
 		{ 
 			SrcRect, DestRect, DLSSPreset,DLSSRRPreset, PerfQuality,
 			bHighResolutionMotionVectors, Sharpness != 0.0f, bUseAutoExposure, bEnableAlphaUpscaling,
-			bReleaseMemoryOnDelete, GPUNode, GPUVisibility, DenoiserMode
+			bReleaseMemoryOnDelete, GPUNode, GPUVisibility, DenoiserMode, bPackedRoughness
 		};
 	}
 
@@ -427,6 +434,8 @@ struct FDLSSOptimalSettings
 	}
 };
 
+class FNGXRHIMemoryReporter;
+
 class NGXRHI_API NGXRHI
 {
 	struct NGXRHI_API FDLSSQueryFeature
@@ -565,8 +574,17 @@ protected:
 	static bool bNGXInitialized;
 	static bool bIsIncompatibleAPICaptureToolActive;
 private:
+	friend class FNGXRHIMemoryReporter;
+
 	TArray< TSharedPtr<NGXDLSSFeature>> AllocatedDLSSFeatures;
 
+	// written by TickPoolElements on the RHI thread, read by the VRAM budget manager on the game thread
+	std::atomic<uint64> DLSSVideoMemoryBytes = 0;
+	std::atomic<int32> NumIdleDLSSFeatures = 0;
+	// set by the VRAM budget manager to evict idle features right away instead of after r.NGX.FramesUntilFeatureDestruction
+	std::atomic<bool> bEvictIdleDLSSFeatures = false;
+	TUniquePtr<FNGXRHIMemoryReporter> MemoryReporter;
+
 	TTuple<FString, bool> DLSSSRGenericBinaryInfo;
 	TTuple<FString, bool> DLSSSRCustomBinaryInfo;
 
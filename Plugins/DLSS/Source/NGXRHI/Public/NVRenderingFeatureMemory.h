@@ -0,0 +1,72 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+// The DLSS and Streamline plugins don't depend on each other, so this header is shipped by both (NGXRHI and StreamlineRHI) and needs to stay identical.
+// The include guard below makes sure only one copy gets compiled when a module can see both
+#ifndef NV_RENDERING_FEATURE_MEMORY_INTERFACE
+#define NV_RENDERING_FEATURE_MEMORY_INTERFACE 1
+
+// Bump with every change to this header, in both copies
+#define NV_RENDERING_FEATURE_MEMORY_INTERFACE_VERSION 1
+
+#include "CoreMinimal.h"
+#include "Features/IModularFeature.h"
+
+// How a feature can give memory back when the VRAM budget is exceeded, from least to most noticeable
+enum class ENVRenderingFeatureMemoryReduction : uint8
+{
+	None,
+	// drop resources that haven't been used for a while, e.g. DLSS features of views that went away
+	EvictIdle,
+	// keep running with a smaller footprint, e.g. fewer DLSS-FG generated frames
+	ReduceQuality,
+	// turn the feature off
+	Disable
+};
+
+struct FNVRenderingFeatureFootprint
+{
+	FName Feature;
+	uint64 Bytes = 0;
+	// cheapest reduction the feature can currently apply, None if there is nothing left to give back
+	ENVRenderingFeatureMemoryReduction Reduction = ENVRenderingFeatureMemoryReduction::None;
+};
+
+// Registered as a modular feature by each plugin that allocates GPU memory for NVIDIA rendering features. Called on the game thread
+class INVRenderingFeatureMemoryReporter : public IModularFeature
+{
+public:
+	static FName GetModularFeatureName()
+	{
+		static const FName FeatureName(TEXT("NVRenderingFeatureMemoryReporter"));
+		return FeatureName;
+	}
+
+	// the first function of the interface, so the budget manager can ask reporters built against another version of this header, e.g. a binary release of the other plugin
+	virtual uint32 GetInterfaceVersion() const
+	{
+		return NV_RENDERING_FEATURE_MEMORY_INTERFACE_VERSION;
+	}
+
+	virtual ~INVRenderingFeatureMemoryReporter() = default;
+
+	virtual void GetFootprints(TArray<FNVRenderingFeatureFootprint>& OutFootprints) const = 0;
+	// applies the reduction reported in GetFootprints. Returns false if that's not possible (anymore)
+	virtual bool ReduceFootprint(FName Feature, ENVRenderingFeatureMemoryReduction Reduction) = 0;
+	// undoes a previous ReduceFootprint once there is room in the budget again
+	virtual void RestoreFootprint(FName Feature, ENVRenderingFeatureMemoryReduction Reduction) = 0;
+};
+
+#endif // NV_RENDERING_FEATURE_MEMORY_INTERFACE
+
+// only the copy that got included first is compiled, this checks that the other one matches it
+static_assert(NV_RENDERING_FEATURE_MEMORY_INTERFACE_VERSION == 1, "The NGXRHI and StreamlineRHI copies of NVRenderingFeatureMemory.h differ, update both");
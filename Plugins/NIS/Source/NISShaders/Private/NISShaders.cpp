@@ -81,6 +81,12 @@ static TAutoConsoleVariable<int> CVarNISHDRMode(
 	TEXT("2: PQ\n"),
 	ECVF_RenderThreadSafe);
 
+static TAutoConsoleVariable<int> CVarNISAsyncCompute(
+	TEXT("r.NIS.AsyncCompute"),
+	0,
+	TEXT("Whether the NIS upscaling and sharpening passes get added as async compute passes, so they can overlap with graphics work where the RHI supports it and r.RDG.AsyncCompute is enabled (default: 0)\n"),
+	ECVF_RenderThreadSafe);
+
 // this should match NISConfig
 BEGIN_SHADER_PARAMETER_STRUCT(FNISConfigParameters, )
 	SHADER_PARAMETER(float, kDetectRatio)
@@ -669,6 +675,7 @@ FScreenPassTexture AddSharpenOrUpscalePass(
 			IntermediateDestRect.Min.X, IntermediateDestRect.Min.Y,
 			IntermediateDestRect.Max.X, IntermediateDestRect.Max.Y
 		),
+		CVarNISAsyncCompute.GetValueOnRenderThread() != 0 ? ERDGPassFlags::AsyncCompute : ERDGPassFlags::Compute,
 		Shader,
 		PassParameters,
 		FComputeShaderUtils::GetGroupCount(Output.ViewRect.Size(), Shader->GetComputeTileSize(bIsUpscaling, bIsAnyHalfPrecisionPermutation))
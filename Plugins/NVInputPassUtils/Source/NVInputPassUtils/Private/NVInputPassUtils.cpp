@@ -0,0 +1,109 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "NVInputPassUtils.h"
+
+#include "Misc/OutputDeviceRedirector.h"
+#include "Modules/ModuleManager.h"
+#include "RenderGraphBuilder.h"
+#include "RenderingThread.h"
+
+#include <atomic>
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, NVInputPassUtils)
+
+#if WITH_DEV_AUTOMATION_TESTS
+BEGIN_SHADER_PARAMETER_STRUCT(FNVAsyncComputeValidationProducerParameters, )
+	RDG_TEXTURE_ACCESS(Output, ERHIAccess::UAVCompute)
+END_SHADER_PARAMETER_STRUCT()
+
+BEGIN_SHADER_PARAMETER_STRUCT(FNVAsyncComputeValidationConsumerParameters, )
+	RDG_TEXTURE_ACCESS_DYNAMIC(Input)
+END_SHADER_PARAMETER_STRUCT()
+
+namespace
+{
+	// counts what RDG reports while the validation graph is built and executed, from whichever thread it logs on
+	class FNVRDGErrorCounter : public FOutputDevice
+	{
+	public:
+		FNVRDGErrorCounter()
+		{
+			GLog->AddOutputDevice(this);
+		}
+
+		virtual ~FNVRDGErrorCounter()
+		{
+			GLog->RemoveOutputDevice(this);
+		}
+
+		virtual void Serialize(const TCHAR* Message, ELogVerbosity::Type Verbosity, const FName& Category) override
+		{
+			if (Category == RDGCategory && (Verbosity & ELogVerbosity::VerbosityMask) <= ELogVerbosity::Warning)
+			{
+				++NumErrors;
+			}
+		}
+
+		virtual bool CanBeUsedOnAnyThread() const override
+		{
+			return true;
+		}
+
+		std::atomic<int32> NumErrors{ 0 };
+
+	private:
+		const FName RDGCategory = TEXT("LogRDG");
+	};
+}
+
+int32 ValidateNVAsyncComputeGraph(TConstArrayView<const TCHAR*> PassNames, bool bAsync, ERHIAccess ConsumerAccess, ERDGPassFlags ConsumerFlags)
+{
+	check(IsInGameThread());
+
+	FNVRDGErrorCounter ErrorCounter;
+	TArray<const TCHAR*> Names(PassNames);
+
+	ENQUEUE_RENDER_COMMAND(ValidateNVAsyncComputeGraph)([Names, bAsync, ConsumerAccess, ConsumerFlags](FRHICommandListImmediate& RHICmdList)
+	{
+		FRDGBuilder GraphBuilder(RHICmdList);
+
+		for (const TCHAR* Name : Names)
+		{
+			FRDGTextureRef Texture = GraphBuilder.CreateTexture(
+				FRDGTextureDesc::Create2D(FIntPoint(8, 8), PF_G16R16F, FClearValueBinding::Black, TexCreate_ShaderResource | TexCreate_UAV),
+				Name);
+
+			FNVAsyncComputeValidationProducerParameters* ProducerParameters = GraphBuilder.AllocParameters<FNVAsyncComputeValidationProducerParameters>();
+			ProducerParameters->Output = Texture;
+			GraphBuilder.AddPass(
+				RDG_EVENT_NAME("AsyncCompute Validation %s", Name),
+				ProducerParameters,
+				bAsync ? ERDGPassFlags::AsyncCompute : ERDGPassFlags::Compute,
+				[](FRHIComputeCommandList& RHICmdList) {});
+
+			FNVAsyncComputeValidationConsumerParameters* ConsumerParameters = GraphBuilder.AllocParameters<FNVAsyncComputeValidationConsumerParameters>();
+			ConsumerParameters->Input = FRDGTextureAccess(Texture, ConsumerAccess);
+			GraphBuilder.AddPass(
+				RDG_EVENT_NAME("AsyncCompute Validation Consumer %s", Name),
+				ConsumerParameters,
+				ConsumerFlags,
+				[](FRHICommandListImmediate& RHICmdList) {});
+		}
+
+		GraphBuilder.Execute();
+	});
+
+	FlushRenderingCommands();
+
+	return ErrorCounter.NumErrors;
+}
+#endif
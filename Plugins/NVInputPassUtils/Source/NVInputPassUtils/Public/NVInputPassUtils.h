@@ -0,0 +1,96 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+// Shared by the input passes of the DLSS (DLSSUtility) and the Streamline (StreamlineShaders) plugins, which otherwise don't depend on each other.
+// Everything plugin specific (cvars, log categories, pass tables) gets passed in by the including module
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderGraphDefinitions.h"
+
+// A comma separated list of pass names (e.g. from an r.*.AsyncCompute.Passes cvar) parsed into one bit per EPass. Render thread only
+template<typename EPass>
+class TNVAsyncComputePolicy
+{
+public:
+	// one name per EPass, in enum order
+	explicit TNVAsyncComputePolicy(TConstArrayView<const TCHAR*> InPassNames) : PassNames(InPassNames) {}
+
+	// Parses Passes if it differs from the last call. Returns true if it did, GetUnknownPasses then holds the names that didn't match any pass
+	bool Update(const FString& Passes)
+	{
+		if (bParsed && Passes == ParsedPasses)
+		{
+			return false;
+		}
+
+		bParsed = true;
+		ParsedPasses = Passes;
+		AsyncPassMask = 0;
+		UnknownPasses.Reset();
+
+		TArray<FString> Names;
+		Passes.ParseIntoArray(Names, TEXT(","), true);
+		for (FString& Name : Names)
+		{
+			Name.TrimStartAndEndInline();
+
+			int32 PassIndex = 0;
+			while (PassIndex < PassNames.Num() && !Name.Equals(PassNames[PassIndex], ESearchCase::IgnoreCase))
+			{
+				++PassIndex;
+			}
+
+			if (PassIndex < PassNames.Num())
+			{
+				AsyncPassMask |= 1u << PassIndex;
+			}
+			else if (!Name.IsEmpty())
+			{
+				UnknownPasses.Add(Name);
+			}
+		}
+
+		return true;
+	}
+
+	// as of the last Update
+	bool IsAsync(EPass Pass) const
+	{
+		return (AsyncPassMask & (1u << uint32(Pass))) != 0;
+	}
+
+	const TCHAR* GetPassName(EPass Pass) const
+	{
+		return PassNames[int32(Pass)];
+	}
+
+	const TArray<FString>& GetUnknownPasses() const
+	{
+		return UnknownPasses;
+	}
+
+private:
+	TConstArrayView<const TCHAR*> PassNames;
+	FString ParsedPasses;
+	uint32 AsyncPassMask = 0;
+	TArray<FString> UnknownPasses;
+	bool bParsed = false;
+};
+
+#if WITH_DEV_AUTOMATION_TESTS
+// Builds and executes a graph where a pass per entry of PassNames writes a texture the way the input passes write their outputs, as async
+// compute if bAsync, and a pass declared with ConsumerAccess and ConsumerFlags reads each of them like the pass of the plugin that hands
+// them to the feature. Blocks until the render thread executed the graph and returns the number of errors and warnings RDG logged meanwhile.
+// With -nullrhi this checks the pass flags and resource accesses, the async compute fences only get exercised on RHIs with async compute
+extern NVINPUTPASSUTILS_API int32 ValidateNVAsyncComputeGraph(TConstArrayView<const TCHAR*> PassNames, bool bAsync, ERHIAccess ConsumerAccess, ERDGPassFlags ConsumerFlags);
+#endif
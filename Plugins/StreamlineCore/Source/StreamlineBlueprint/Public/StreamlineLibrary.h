@@ -87,6 +87,43 @@ public:
 
 static_assert(uint8(EStreamlineFeature::Count) == 4u, "dear NVIDIA plugin developer, please update the Keywords below handle the new enum values");
 
+USTRUCT(BlueprintType)
+struct FStreamlineResourceHibernationPolicy
+{
+	GENERATED_BODY()
+public:
+
+	/** Seconds the feature keeps its resources after getting turned off. < 0 keeps them until it gets turned on again, 0 (the default) means no grace period: DLSS-FG releases them right away, Latewarp and DeepDVC keep them */
+	UPROPERTY(BlueprintReadWrite, Category = "Streamline")
+	float GracePeriodSeconds = 0.0f;
+
+	/** Release kept resources early when video memory gets tight or the engine asks to trim memory */
+	UPROPERTY(BlueprintReadWrite, Category = "Streamline")
+	bool bReleaseOnMemoryPressure = true;
+};
+
+USTRUCT(BlueprintType)
+struct FStreamlineResourceHibernationStats
+{
+	GENERATED_BODY()
+public:
+
+	/** Times the feature got turned back on while its resources were still kept */
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline")
+	int32 HitchesAvoided = 0;
+	/** Times the feature got turned back on after its resources had been released */
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline")
+	int32 Reallocations = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline")
+	int32 GracePeriodReleases = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline")
+	int32 MemoryPressureReleases = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline")
+	int32 Prewarms = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline")
+	int32 NumHibernatingViews = 0;
+};
+
 USTRUCT(BlueprintType)
 struct FStreamlineFeatureRequirements 
 {
@@ -19,6 +19,9 @@
 #include "StreamlineDLSSG.h"
 #include "StreamlineLatewarp.h"
 #include "StreamlineDeepDVC.h"
+#include "StreamlineHibernation.h"
+#include "StreamlineMemoryReporter.h"
+#include "StreamlineStartupProbes.h"
 
 #include "StreamlineRHI.h"
 #include "sl_helpers.h"
@@ -32,6 +35,7 @@
 #endif
 #include "SceneViewExtension.h"
 #include "SceneView.h"
+#include "Misc/CoreDelegates.h"
 #include "Misc/MessageDialog.h"
 
 #define LOCTEXT_NAMESPACE "FStreamlineModule"
@@ -70,37 +74,14 @@ void FStreamlineCoreModule::StartupModule()
 
 	if (GetPlatformStreamlineSupport() == EStreamlineSupport::Supported)
 	{
-		// set the view family extension that's gonna call into SL in the postprocessing pass
-		bool bShouldCreateViewExtension = IsStreamlineDLSSGSupported() || IsStreamlineLatewarpSupported() || IsStreamlineDeepDVCSupported();
-		if (FParse::Param(FCommandLine::Get(), TEXT("slviewextension")))
-		{
-			bShouldCreateViewExtension = true;
-		}
-		if (FParse::Param(FCommandLine::Get(), TEXT("slnoviewextension")))
-		{
-			bShouldCreateViewExtension = false;
-		}
-		if (bShouldCreateViewExtension)
-		{
-			StreamlineViewExtension = FSceneViewExtensions::NewExtension<FStreamlineViewExtension>(GetStreamlineRHI());
-		}
-		else
-		{
-			StreamlineViewExtension = nullptr;
-		}
-		
-		RegisterStreamlineReflexHooks();
+		BeginStreamlineStartupTiming();
 
-		if (ForceTagStreamlineBuffers() || IsStreamlineDLSSGSupported())
-		{
-			RegisterStreamlineDLSSGHooks(GetStreamlineRHI());
-		}
-		if (ForceTagStreamlineBuffers() || IsStreamlineLatewarpSupported())
-		{
-			RegisterStreamlineLatewarpHooks(GetStreamlineRHI());
-		}
+		// the probes overlap with the startup of the modules loaded after this one. Everything that calls into Streamline waits for
+		// the first frame, so the probe task is the only caller until then
+		StartStreamlineFeatureProbes();
+		OnBeginFrameHandle = FCoreDelegates::OnBeginFrame.AddRaw(this, &FStreamlineCoreModule::FinishStartup);
 
-		LogStreamlineFeatureSupport(sl::kFeatureImGUI, *GetStreamlineRHI()->GetAdapterInfo());
+		EndStreamlineStartupTiming(false);
 	}
 
 	UE_LOG(LogStreamline, Log, TEXT("NVIDIA Streamline supported %u"), QueryStreamlineSupport() == EStreamlineSupport::Supported);
@@ -126,6 +107,59 @@ void FStreamlineCoreModule::StartupModule()
 	UE_LOG(LogStreamline, Log, TEXT("%s Leave"), ANSI_TO_TCHAR(__FUNCTION__));
 }
 
+void FStreamlineCoreModule::FinishStartup()
+{
+	FCoreDelegates::OnBeginFrame.Remove(OnBeginFrameHandle);
+	OnBeginFrameHandle.Reset();
+
+	BeginStreamlineStartupTiming();
+	WaitForStreamlineFeatureProbes();
+
+	// features the project doesn't load can't be supported, so their queries are left to whoever asks first
+	const bool bDLSSGSupported = IsStreamlineFeatureLoadEnabled(sl::kFeatureDLSS_G) && IsStreamlineDLSSGSupported();
+	const bool bLatewarpSupported = IsStreamlineFeatureLoadEnabled(sl::kFeatureLatewarp) && IsStreamlineLatewarpSupported();
+	const bool bDeepDVCSupported = IsStreamlineFeatureLoadEnabled(sl::kFeatureDeepDVC) && IsStreamlineDeepDVCSupported();
+
+	// set the view family extension that's gonna call into SL in the postprocessing pass
+	bool bShouldCreateViewExtension = bDLSSGSupported || bLatewarpSupported || bDeepDVCSupported;
+	if (FParse::Param(FCommandLine::Get(), TEXT("slviewextension")))
+	{
+		bShouldCreateViewExtension = true;
+	}
+	if (FParse::Param(FCommandLine::Get(), TEXT("slnoviewextension")))
+	{
+		bShouldCreateViewExtension = false;
+	}
+	if (bShouldCreateViewExtension)
+	{
+		StreamlineViewExtension = FSceneViewExtensions::NewExtension<FStreamlineViewExtension>(GetStreamlineRHI());
+	}
+	else
+	{
+		StreamlineViewExtension = nullptr;
+	}
+
+	RegisterStreamlineReflexHooks();
+	RegisterStreamlineHibernationHooks();
+	RegisterStreamlineMemoryReporter();
+
+	bDLSSGHooksRegistered = ForceTagStreamlineBuffers() || bDLSSGSupported;
+	if (bDLSSGHooksRegistered)
+	{
+		RegisterStreamlineDLSSGHooks(GetStreamlineRHI());
+	}
+	bLatewarpHooksRegistered = ForceTagStreamlineBuffers() || bLatewarpSupported;
+	if (bLatewarpHooksRegistered)
+	{
+		RegisterStreamlineLatewarpHooks(GetStreamlineRHI());
+	}
+
+	LogStreamlineFeatureSupport(sl::kFeatureImGUI, *GetStreamlineRHI()->GetAdapterInfo());
+
+	bStartupFinished = true;
+	EndStreamlineStartupTiming(true);
+}
+
 void FStreamlineCoreModule::ShutdownModule()
 {
 	auto CVarInitializePlugin = IConsoleManager::Get().FindConsoleVariable(TEXT("r.Streamline.InitializePlugin"));
@@ -140,19 +174,35 @@ void FStreamlineCoreModule::ShutdownModule()
 		StreamlineViewExtension = nullptr;
 	}
 
+	if (OnBeginFrameHandle.IsValid())
+	{
+		FCoreDelegates::OnBeginFrame.Remove(OnBeginFrameHandle);
+		OnBeginFrameHandle.Reset();
+	}
+
 	if (GetPlatformStreamlineSupport() == EStreamlineSupport::Supported)
 	{
-		if (IsStreamlineLatewarpSupported())
+		WaitForStreamlineFeatureProbes();
+	}
+
+	// shut down before the first frame, e.g. by a commandlet, so nothing got registered
+	if (bStartupFinished)
+	{
+		if (bLatewarpHooksRegistered)
 		{
 			UnregisterStreamlineLatewarpHooks();
 		}
 
-		if (IsStreamlineDLSSGSupported())
+		if (bDLSSGHooksRegistered)
 		{
 			UnregisterStreamlineDLSSGHooks();
 		}
 		
+		UnregisterStreamlineMemoryReporter();
+		UnregisterStreamlineHibernationHooks();
 		UnregisterStreamlineReflexHooks();
+		UnregisterStreamlineReflexCameraHooks();
+		bStartupFinished = false;
 	}
 
 #if WITH_EDITOR
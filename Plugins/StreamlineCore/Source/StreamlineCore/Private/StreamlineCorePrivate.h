@@ -16,6 +16,7 @@
 #include "RenderGraphBuilder.h"
 #include "RenderGraphUtils.h"
 #include "StreamlineRHI.h"
+#include "StreamlinePersistentResources.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogStreamline, Verbose, All);
 
@@ -43,11 +44,10 @@ END_SHADER_PARAMETER_STRUCT()
 inline void AddDebugLayerCompatibilitySetupPasses(FRDGBuilder& GraphBuilder, FDebugLayerCompatibilityShaderParameters* PassParameters)
 {
 	RDG_EVENT_SCOPE(GraphBuilder, "UE5.5AndOlderDebugLayerCompatibilitySetup");
+	// persistent, so only the first graph creates and clears them
 	FRDGTextureDesc Desc = FRDGTextureDesc::Create2D(FIntPoint(1, 1), PF_FloatRGBA, FClearValueBinding::Black, TexCreate_RenderTargetable);
-	PassParameters->DebugLayerCompatibilityHelperSource = GraphBuilder.CreateTexture(Desc, TEXT("UE5.5AndOlderDebugLayerCompatibilityHelperSource"));
-	PassParameters->DebugLayerCompatibilityHelperDest = GraphBuilder.CreateTexture(Desc, TEXT("UE5.5AndOlderDebugLayerCompatibilityHelperDest"));
-	AddClearRenderTargetPass(GraphBuilder, PassParameters->DebugLayerCompatibilityHelperSource);
-	AddClearRenderTargetPass(GraphBuilder, PassParameters->DebugLayerCompatibilityHelperDest);
+	PassParameters->DebugLayerCompatibilityHelperSource = FStreamlinePersistentResources::Get().RegisterClearedTexture(GraphBuilder, TEXT("UE5.5AndOlderDebugLayerCompatibilityHelperSource"), Desc);
+	PassParameters->DebugLayerCompatibilityHelperDest = FStreamlinePersistentResources::Get().RegisterClearedTexture(GraphBuilder, TEXT("UE5.5AndOlderDebugLayerCompatibilityHelperDest"), Desc);
 }
 
 inline void DebugLayerCompatibilityRHISetup(const FDebugLayerCompatibilityShaderParameters& PassParameters, FRHIStreamlineResource& Texture)
@@ -94,4 +94,43 @@ void AddStreamlineStateRenderPass(const TCHAR* FeatureName, FRDGBuilder& GraphBu
 					OnRHIThread(Cmd, ViewID, SecondaryViewRect, Options);
 				});
 			});
-}
\ No newline at end of file
+}
+
+struct FStreamlineStateBatchView
+{
+	uint32 ViewID = 0;
+	FIntRect SecondaryViewRect;
+};
+
+// Same as AddStreamlineStateRenderPass, but for all views of a view family in a single pass: the options of every view get computed together
+// on the render thread and submitted back to back in one RHI thread lambda
+template<typename StateOnRenderThreadLambda, typename RHIThreadLambda >
+void AddStreamlineBatchedStateRenderPass(const TCHAR* FeatureName, FRDGBuilder& GraphBuilder, TArray<FStreamlineStateBatchView>&& Views, StateOnRenderThreadLambda StateOnRenderThread, RHIThreadLambda OnRHIThread)
+{
+	using FOptions = decltype(StateOnRenderThread(uint32(0), FIntRect()));
+
+	FSLSetStateShaderParameters* PassParameters = GraphBuilder.AllocParameters<FSLSetStateShaderParameters>();
+
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("Streamline %s State NumViews = %d", FeatureName, Views.Num()),
+		PassParameters,
+		ERDGPassFlags::Compute | ERDGPassFlags::Raster | ERDGPassFlags::SkipRenderPass | ERDGPassFlags::NeverCull,
+		[Views = MoveTemp(Views), StateOnRenderThread, OnRHIThread](FRHICommandListImmediate& RHICmdList) mutable
+		{
+			TArray<FOptions, TInlineAllocator<4>> Options;
+			Options.Reserve(Views.Num());
+			for (const FStreamlineStateBatchView& View : Views)
+			{
+				Options.Add(StateOnRenderThread(View.ViewID, View.SecondaryViewRect));
+			}
+
+			RHICmdList.EnqueueLambda(
+				[Views = MoveTemp(Views), Options = MoveTemp(Options), OnRHIThread](FRHICommandListImmediate& Cmd) mutable
+				{
+					for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
+					{
+						OnRHIThread(Cmd, Views[ViewIndex].ViewID, Views[ViewIndex].SecondaryViewRect, Options[ViewIndex]);
+					}
+				});
+		});
+}
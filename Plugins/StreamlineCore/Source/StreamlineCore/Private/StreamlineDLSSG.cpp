@@ -10,12 +10,19 @@
 */
 
 #include "StreamlineDLSSG.h"
+#include "StreamlineDLSSGPacing.h"
+#include "StreamlineHibernation.h"
 #include "StreamlineLatewarp.h"
+#include "StreamlineOptionsCache.h"
+#include "StreamlinePresentWindowCache.h"
 #include "StreamlineCore.h"
 #include "StreamlineShaders.h"
 #include "StreamlineCorePrivate.h"
+#include "StreamlineStartupProbes.h"
 #include "StreamlineAPI.h"
 #include "StreamlineRHI.h"
+#include "StreamlineTrace.h"
+#include "StreamlineUICoverage.h"
 #include "StreamlineViewExtension.h"
 #include "sl_helpers.h"
 #include "sl_dlss_g.h"
@@ -28,6 +35,13 @@
 #include "ScenePrivate.h"
 #include "SystemTextures.h"
 #include "HAL/PlatformApplicationMisc.h"
+#include "Misc/CoreDelegates.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "Widgets/SWindow.h"
+#include "Windows/WindowsHWrapper.h"
+
+#include <atomic>
 
 static FDelegateHandle OnPreRHIViewportCreateHandle;
 static FDelegateHandle OnPostRHIViewportCreateHandle;
@@ -119,6 +133,47 @@ static TAutoConsoleVariable<int32> CVarStreamlineDLSSGFramesToGenerate(
 	TEXT("1..3: \n"),
 	ECVF_Default);
 
+static TAutoConsoleVariable<bool> CVarStreamlineDLSSGVRAMEstimate(
+	TEXT("r.Streamline.DLSSG.VRAMEstimate"),
+	false,
+	TEXT("Request a VRAM estimate from DLSS-FG each frame, shown in stat DLSSG and reported to the VRAM budget manager (default = false)\n")
+	TEXT("The estimate is currently unreliable, so by default DLSS-FG reports no footprint and isn't budgeted\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarStreamlineDLSSGAdaptiveFramesToGenerate(
+	TEXT("r.Streamline.DLSSG.Adaptive.Enable"),
+	false,
+	TEXT("Pick the number of generated frames each frame so that the output frame rate gets close to, but does not exceed, the display refresh rate (default = false)\n")
+	TEXT("r.Streamline.DLSSG.FramesToGenerate is then used as the upper limit\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamlineDLSSGAdaptiveTargetRefreshRate(
+	TEXT("r.Streamline.DLSSG.Adaptive.TargetRefreshRate"),
+	0.0f,
+	TEXT("Output frame rate the adaptive frames to generate controller aims for, in Hz (default = 0)\n")
+	TEXT("0: use the refresh rate of the current display mode of the monitor the game window is on\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamlineDLSSGAdaptiveHysteresis(
+	TEXT("r.Streamline.DLSSG.Adaptive.Hysteresis"),
+	0.05f,
+	TEXT("Fraction of the target refresh rate the output frame rate has to stay below before the adaptive controller generates one more frame. ")
+	TEXT("The controller generates one less as soon as the output frame rate exceeds the target refresh rate, so the band lies entirely below the target (default = 0.05)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarStreamlineDLSSGAdaptiveSettleFrames(
+	TEXT("r.Streamline.DLSSG.Adaptive.SettleFrames"),
+	30,
+	TEXT("Number of consecutive rendered frames the adaptive controller needs to agree on a new number of generated frames before switching to it (default = 30)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamlineDLSSGAdaptiveMaxGPUUtilization(
+	TEXT("r.Streamline.DLSSG.Adaptive.MaxGPUUtilization"),
+	0.9f,
+	TEXT("GPU time as a fraction of the rendered frame time above which the adaptive controller won't generate more frames, and generates one less once that persists (default = 0.9)\n")
+	TEXT("0: ignore GPU time\n"),
+	ECVF_Default);
+
 
 static int32 NumDLSSGInstances = 0;
 
@@ -142,67 +197,77 @@ static void DLSSGAPIErrorCallBack(const sl::APIError& lastError)
 }
 
 
-// TODO template shenanigans to infer from TSharedPtr mode, to allow modifed UE4 with threadsafe shared pointers work automatically
-constexpr bool AreSlateSharedPointersThreadSafe()
+// Console variable derived state of DLSSGOnBackBufferReadyToPresent, so the present callback doesn't need to look up and read them every frame.
+// Refreshed from a console variable sink, and at the beginning of every frame since bShouldTagBuffers also depends on the feature support
+// and -slforcetagging rather than only on console variables. Only changes get sent to the render thread
+struct FDLSSGPresentSettings
 {
-#if ENGINE_MAJOR_VERSION == 4
-	return false;
-#else
-	return true;
-#endif
-}
+	int32 ViewIndexToTag = -1;
+	float UIColorAlphaThreshold = 0.0f;
+	bool bTagUIColorAlpha = true;
+	bool bTagBackbuffer = true;
+	bool bShouldTagBuffers = false;
+	bool bNeedViewIdOverride = false;
+
+	bool Equals(const FDLSSGPresentSettings& Other) const
+	{
+		return ViewIndexToTag == Other.ViewIndexToTag
+			&& UIColorAlphaThreshold == Other.UIColorAlphaThreshold
+			&& bTagUIColorAlpha == Other.bTagUIColorAlpha
+			&& bTagBackbuffer == Other.bTagBackbuffer
+			&& bShouldTagBuffers == Other.bShouldTagBuffers
+			&& bNeedViewIdOverride == Other.bNeedViewIdOverride;
+	}
+};
 
-static FIntRect GetViewportRect(SWindow& InWindow)
+// render thread
+static FDLSSGPresentSettings GDLSSGPresentSettings;
+// game thread, what got sent to the render thread last
+static FDLSSGPresentSettings GDLSSGPresentSettingsGameThread;
+static bool bDLSSGPresentSettingsSent = false;
+static FConsoleVariableSinkHandle DLSSGPresentSettingsSinkHandle;
+static FDelegateHandle DLSSGPresentSettingsBeginFrameHandle;
+
+static void UpdateDLSSGPresentSettings()
 {
-	// During app shutdown, the window might not have a viewport anymore, so using SWindow::GetViewportSize() that handles that transparently.
-	FIntRect ViewportRect = FIntRect(FIntPoint::ZeroValue,InWindow.GetViewportSize().IntPoint());
+	check(IsInGameThread());
 
-	
-	if (AreSlateSharedPointersThreadSafe())
-	{
-		if (TSharedPtr<ISlateViewport> Viewport = InWindow.GetViewport())
-		{
-			if (TSharedPtr<SWidget> Widget = Viewport->GetWidget().Pin())
-			{
-				FGeometry Geom = Widget->GetPaintSpaceGeometry();
+	static const auto CVarStreamlineViewIndexToTag = IConsoleManager::Get().FindConsoleVariable(TEXT("r.Streamline.ViewIndexToTag"));
 
-				FIntPoint Min = { int32(Geom.GetAbsolutePosition().X),int32(Geom.GetAbsolutePosition().Y) };
-				FIntPoint Max = { int32((Geom.GetAbsolutePosition() + Geom.GetAbsoluteSize()).X),
-									int32((Geom.GetAbsolutePosition() + Geom.GetAbsoluteSize()).Y) };
+	FDLSSGPresentSettings Settings;
+	Settings.ViewIndexToTag = CVarStreamlineViewIndexToTag ? CVarStreamlineViewIndexToTag->GetInt() : -1;
+	Settings.UIColorAlphaThreshold = CVarStreamlineTagUIColorAlphaThreshold.GetValueOnGameThread();
+	Settings.bTagUIColorAlpha = ForceTagStreamlineBuffers() || (GIsEditor ? CVarStreamlineEditorTagUIColorAlpha.GetValueOnGameThread() : CVarStreamlineTagUIColorAlpha.GetValueOnGameThread());
+	Settings.bTagBackbuffer = ForceTagStreamlineBuffers() || CVarStreamlineTagBackbuffer.GetValueOnGameThread();
+	Settings.bShouldTagBuffers = ShouldTagStreamlineBuffers();
+	Settings.bNeedViewIdOverride = NeedStreamlineViewIdOverride();
 
-				ViewportRect = FIntRect(Min.X, Min.Y, Max.X, Max.Y);
-			}
-		}
-	}
-	else
+	if (bDLSSGPresentSettingsSent && Settings.Equals(GDLSSGPresentSettingsGameThread))
 	{
-		// this is off by a bit in UE5 due to additional borders and editor UI scaling that's not present in UE4
-		// but we expect to run this only in UE4, if at all
-		const FSlateRect ClientRectInScreen = InWindow.GetClientRectInScreen();
-		const FSlateRect ClientRectInWindow = ClientRectInScreen.OffsetBy(-InWindow.GetPositionInScreen());
-
-		const FIntRect RectFromWindow = FIntRect(ClientRectInWindow.Left, ClientRectInWindow.Top, ClientRectInWindow.Right, ClientRectInWindow.Bottom);
-		ViewportRect = RectFromWindow;
+		return;
 	}
+	GDLSSGPresentSettingsGameThread = Settings;
+	bDLSSGPresentSettingsSent = true;
 
-	return ViewportRect;
+	ENQUEUE_RENDER_COMMAND(UpdateDLSSGPresentSettings)(
+		[Settings](FRHICommandListImmediate& RHICmdList)
+	{
+		GDLSSGPresentSettings = Settings;
+	});
 }
 
 static void DLSSGOnBackBufferReadyToPresent(SWindow& InWindow, const FTextureRHIRef& InBackBuffer)
 {
 	check(IsInRenderingThread());
 
-	const bool bIsGameWindow = InWindow.GetType() == EWindowType::GameWindow;
-#if WITH_EDITOR
-	const bool bIsPIEWindow = GIsEditor && (InWindow.GetTitle().ToString().Contains(TEXT("Preview [NetMode:")));
-#else
-	const bool bIsPIEWindow = false;
-#endif
-	if (!(bIsGameWindow || bIsPIEWindow))
+	const FStreamlinePresentWindowState& WindowState = GetStreamlinePresentWindowState(InWindow, InBackBuffer->GetTexture2D());
+	if (!WindowState.bIsPresentTarget)
 	{
 		return;
 	}
 
+	TRACE_STREAMLINE_PRESENT_SCOPE(sl::kFeatureDLSS_G, GFrameCounterRenderThread);
+
 	// we need to "consume" the views for this backbuffer, even if we don't tag them
 #if DEBUG_STREAMLINE_VIEW_TRACKING
 	FStreamlineViewExtension::LogTrackedViews(*FString::Printf(TEXT("%s Entry %s Backbuffer=%p"), ANSI_TO_TCHAR(__FUNCTION__), *CurrentThreadName(), InBackBuffer->GetTexture2D()));
@@ -214,66 +279,20 @@ static void DLSSGOnBackBufferReadyToPresent(SWindow& InWindow, const FTextureRHI
 	// in game mode, this is the actual backbuffer (same as the argument to this callback)
 	// in the editor, this is a different, intermediate rendertarget (BufferedRT)
 	// so we need to handle either case to associate views to this backbuffer
-	FRHITexture* RealOrBufferedBackBuffer = InBackBuffer->GetTexture2D();
-
-	if (AreSlateSharedPointersThreadSafe())
-	{
-		if (TSharedPtr<ISlateViewport> Viewport = InWindow.GetViewport())
-		{
-			FSceneViewport* SceneViewport = static_cast<FSceneViewport*> (Viewport.Get());
-			const FTextureRHIRef& SceneViewPortRenderTarget = SceneViewport->GetRenderTargetTexture();
-
-			if (SceneViewPortRenderTarget.IsValid())
-			{
-				RealOrBufferedBackBuffer = SceneViewPortRenderTarget->GetTexture2D();
-			}
-		}
-		else
-		{
-			check(!GIsEditor);
-		}
-	}
-	else
-	{
-		// this is not trivial/impossible to implement without getting the window/ rendertarget information from the gamethread
-		// this is OK in UE5 since by default we can talk to the gamethread from the renderthread here in a thread safe way
-		// but not in UE4
-	}
-
-	// Note: we cannot empty the array after we found the views for the current backbufffer since we get multiple present callbacks in case when we have multiple 
-	// swapchains / windows so selectively removing those only for the current backbuffer still keeps those around for the next time we get the present callback for a different swapchain.
-	// This can happen in PIE mode with multiple active PIE windows
-
-
 	TArray<FTrackedView> ViewsInThisBackBuffer;
-	int32 ViewRectIndex = 0;
-	while (ViewRectIndex < TrackedViews.Num())
-	{
-		if (TrackedViews[ViewRectIndex].Texture->GetTexture2D() == RealOrBufferedBackBuffer)
-		{
-			ViewsInThisBackBuffer.Add(TrackedViews[ViewRectIndex]);
-			TrackedViews.RemoveAtSwap(ViewRectIndex);
-		}
-		else
-		{
-			++ViewRectIndex;
-		}
-	}
+	ExtractStreamlineTrackedViewsForBackBuffer(TrackedViews, WindowState.RealOrBufferedBackBuffer, ViewsInThisBackBuffer);
 
-	const static auto CVarStreamlineViewIndexToTag = IConsoleManager::Get().FindConsoleVariable(TEXT("r.Streamline.ViewIndexToTag"));
-	if (CVarStreamlineViewIndexToTag )
+	const FDLSSGPresentSettings& Settings = GDLSSGPresentSettings;
+	if (Settings.ViewIndexToTag != -1)
 	{
-		if (const int32 ViewIndexToTag = CVarStreamlineViewIndexToTag->GetInt() != -1)
+		for (int32 ViewIndex = 0; ViewIndex < ViewsInThisBackBuffer.Num(); ++ViewIndex)
 		{
-			for (int32 ViewIndex = 0; ViewIndex < ViewsInThisBackBuffer.Num(); ++ViewIndex)
+			if (ViewIndex == Settings.ViewIndexToTag)
 			{
-				if (ViewIndex == ViewIndexToTag)
-				{
-					const FTrackedView ViewToTrack = ViewsInThisBackBuffer[ViewIndex];
-					ViewsInThisBackBuffer.Empty();
-					ViewsInThisBackBuffer.Add(ViewToTrack);
-					break;
-				}
+				const FTrackedView ViewToTrack = ViewsInThisBackBuffer[ViewIndex];
+				ViewsInThisBackBuffer.Empty();
+				ViewsInThisBackBuffer.Add(ViewToTrack);
+				break;
 			}
 		}
 	}
@@ -292,7 +311,7 @@ static void DLSSGOnBackBufferReadyToPresent(SWindow& InWindow, const FTextureRHI
 #endif
 	
 
-	if (!ShouldTagStreamlineBuffers())
+	if (!Settings.bShouldTagBuffers)
 	{
 		return;
 	}
@@ -302,8 +321,8 @@ static void DLSSGOnBackBufferReadyToPresent(SWindow& InWindow, const FTextureRHI
 		return;
 	}
 
-	const bool bTagUIColorAlpha = ForceTagStreamlineBuffers() ||(GIsEditor ? CVarStreamlineEditorTagUIColorAlpha.GetValueOnRenderThread() : CVarStreamlineTagUIColorAlpha.GetValueOnRenderThread());
-	const bool bTagBackbuffer = ForceTagStreamlineBuffers() || (CVarStreamlineTagBackbuffer.GetValueOnRenderThread());
+	const bool bTagUIColorAlpha = Settings.bTagUIColorAlpha;
+	const bool bTagBackbuffer = Settings.bTagBackbuffer;
 	
 	// TODO maybe add a helper function to add the RDG pass to tag a resource and use that everywhere
 	FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
@@ -314,7 +333,9 @@ static void DLSSGOnBackBufferReadyToPresent(SWindow& InWindow, const FTextureRHI
 	
 	FIntPoint BackBufferDimension = { int32(InBackBuffer->GetTexture2D()->GetSizeX()), int32(InBackBuffer->GetTexture2D()->GetSizeY()) };
 	
-	const FIntRect WindowClientAreaRect = GetViewportRect(InWindow);
+	const FIntRect WindowClientAreaRect = WindowState.ViewportRect;
+
+	AddStreamlineUICoverageDetectionPasses(GraphBuilder, InBackBuffer, WindowClientAreaRect);
 
 	// in PIE windows, the actual client area the scene gets rendered into is offset to make space
 	// for the window title bar and such.
@@ -348,8 +369,7 @@ static void DLSSGOnBackBufferReadyToPresent(SWindow& InWindow, const FTextureRHI
 		
 	if (bTagUIColorAlpha)
 	{
-		const float AlphaThreshold = CVarStreamlineTagUIColorAlphaThreshold.GetValueOnRenderThread();
-		FRDGTextureRef UIHintTexture = AddStreamlineUIHintExtractionPass(GraphBuilder, AlphaThreshold, InBackBuffer);
+		FRDGTextureRef UIHintTexture = AddStreamlineUIHintExtractionPass(GraphBuilder, Settings.UIColorAlphaThreshold, InBackBuffer);
 		PassParameters->UIColorAndAlpha = UIHintTexture;
 	}
 
@@ -360,7 +380,7 @@ static void DLSSGOnBackBufferReadyToPresent(SWindow& InWindow, const FTextureRHI
 	}
 #endif
 
-	AddStreamlineUIHintTagPass(GraphBuilder, bTagBackbuffer, bTagUIColorAlpha, BackBufferDimension, PassParameters, 0, RHIExtensions, ViewsInThisBackBuffer, WindowClientAreaRect, NeedStreamlineViewIdOverride());
+	AddStreamlineUIHintTagPass(GraphBuilder, bTagBackbuffer, bTagUIColorAlpha, BackBufferDimension, PassParameters, 0, RHIExtensions, ViewsInThisBackBuffer, WindowClientAreaRect, Settings.bNeedViewIdOverride);
 }
 
 void RegisterStreamlineDLSSGHooks(FStreamlineRHI* InStreamlineRHI)
@@ -373,6 +393,10 @@ void RegisterStreamlineDLSSGHooks(FStreamlineRHI* InStreamlineRHI)
 		check(FSlateApplication::IsInitialized());
 		FSlateRenderer* SlateRenderer = FSlateApplication::Get().GetRenderer();
 
+		UpdateDLSSGPresentSettings();
+		DLSSGPresentSettingsSinkHandle = IConsoleManager::Get().RegisterConsoleVariableSink_Handle(FConsoleCommandDelegate::CreateStatic(&UpdateDLSSGPresentSettings));
+		DLSSGPresentSettingsBeginFrameHandle = FCoreDelegates::OnBeginFrame.AddStatic(&UpdateDLSSGPresentSettings);
+
 		OnBackBufferReadyToPresentHandle = SlateRenderer->OnBackBufferReadyToPresent().AddStatic(&DLSSGOnBackBufferReadyToPresent);
 
 		// ShutdownModule is too late for this
@@ -384,6 +408,8 @@ void RegisterStreamlineDLSSGHooks(FStreamlineRHI* InStreamlineRHI)
 			check(SlateRenderer);
 
 			SlateRenderer->OnBackBufferReadyToPresent().Remove(OnBackBufferReadyToPresentHandle);
+			IConsoleManager::Get().UnregisterConsoleVariableSink_Handle(DLSSGPresentSettingsSinkHandle);
+			FCoreDelegates::OnBeginFrame.Remove(DLSSGPresentSettingsBeginFrameHandle);
 		}
 		);
 
@@ -400,22 +426,37 @@ void UnregisterStreamlineDLSSGHooks()
 static Streamline::EStreamlineFeatureSupport GStreamlineDLSSGSupport = Streamline::EStreamlineFeatureSupport::NotSupported;
 
 
-// this is currently unreliable so 
-#define WITH_DLSS_FG_VRAM_ESTIMATE 0
-
-
-
 namespace
 {
 	float GLastDLSSGFrameRate = 0.0f;
 	int32 GLastDLSSGFramesPresented = 0;
-#if WITH_DLSS_FG_VRAM_ESTIMATE
-	float GLastDLSSGVRAMEstimate = 0;
-#endif
+	// written on the game thread by GetDLSSGStatusFromStreamline, read by the VRAM budget manager
+	std::atomic<uint64> GLastDLSSGVRAMEstimateBytes = 0;
 	int32 GDLSSGMinWidthOrHeight = 0;
 
 	int32 GDLSSGMinGeneratedFrames = 0;
 	int32 GDLSSGMaxGeneratedFrames = 0;
+
+	// written on the game thread once per frame by UpdateAdaptiveDLSSGFramesToGenerate, read from any thread
+	std::atomic<int32> GDLSSGAdaptiveFramesToGenerate = 0;
+
+	// game thread state of UpdateAdaptiveDLSSGFramesToGenerate. Reset whenever the controller gets turned on or off, so it starts over
+	// from r.Streamline.DLSSG.FramesToGenerate rather than finishing a switch a previous session had pending
+	struct FDLSSGAdaptiveFramesToGenerateState
+	{
+		bool bActive = false;
+		int32 PendingFramesToGenerate = 0;
+		int32 NumFramesPending = 0;
+		// the display mode can change at any time, e.g. when the window moves to another monitor, so it gets queried again periodically
+		float DisplayRefreshRate = 0.0f;
+		double DisplayRefreshRateQueryTime = 0.0;
+	};
+	FDLSSGAdaptiveFramesToGenerateState GDLSSGAdaptiveState;
+	// there can be multiple view families per frame
+	uint64 GDLSSGAdaptiveLastUpdateFrame = 0;
+
+	// upper limit set by the VRAM budget manager, 0 if not limited. Game thread writes, any thread reads
+	std::atomic<int32> GDLSSGBudgetMaxFramesToGenerate = 0;
 }
 
 
@@ -444,7 +485,7 @@ STREAMLINECORE_API Streamline::EStreamlineFeatureSupport QueryStreamlineDLSSGSup
 			if (StreamlineRHI->IsDLSSGSupportedByRHI())
 			{
 				const sl::Feature Feature = sl::kFeatureDLSS_G;
-				sl::Result SupportedResult = SLisFeatureSupported(Feature, *StreamlineRHI->GetAdapterInfo());
+				sl::Result SupportedResult = GetStreamlineFeatureProbeResult(Feature);
 				LogStreamlineFeatureSupport(Feature, *StreamlineRHI->GetAdapterInfo());
 
 				GStreamlineDLSSGSupport = TranslateStreamlineResult(SupportedResult);
@@ -509,7 +550,21 @@ int32 GetStreamlineDLSSGNumFramesToGenerate()
 {
 	//return 1;
 	// TODO clamp by runtime query of min/max
-	return FMath::Clamp(CVarStreamlineDLSSGFramesToGenerate.GetValueOnAnyThread(), GDLSSGMinGeneratedFrames, GDLSSGMaxGeneratedFrames);
+	int32 MaxFramesToGenerate = FMath::Clamp(CVarStreamlineDLSSGFramesToGenerate.GetValueOnAnyThread(), GDLSSGMinGeneratedFrames, GDLSSGMaxGeneratedFrames);
+
+	const int32 BudgetMaxFramesToGenerate = GDLSSGBudgetMaxFramesToGenerate;
+	if (BudgetMaxFramesToGenerate > 0)
+	{
+		MaxFramesToGenerate = FMath::Clamp(BudgetMaxFramesToGenerate, GDLSSGMinGeneratedFrames, MaxFramesToGenerate);
+	}
+
+	const int32 AdaptiveFramesToGenerate = GDLSSGAdaptiveFramesToGenerate;
+	if (CVarStreamlineDLSSGAdaptiveFramesToGenerate.GetValueOnAnyThread() && AdaptiveFramesToGenerate > 0)
+	{
+		return FMath::Clamp(AdaptiveFramesToGenerate, GDLSSGMinGeneratedFrames, MaxFramesToGenerate);
+	}
+
+	return MaxFramesToGenerate;
 }
 
 void GetStreamlineDLSSGMinMaxGeneratedFrames(int32& MinGeneratedFrames, int32& MaxGeneratedFrames)
@@ -518,15 +573,61 @@ void GetStreamlineDLSSGMinMaxGeneratedFrames(int32& MinGeneratedFrames, int32& M
 	MaxGeneratedFrames = GDLSSGMaxGeneratedFrames;
 }
 
+bool IsStreamlineDLSSGVRAMEstimateEnabled()
+{
+	return CVarStreamlineDLSSGVRAMEstimate.GetValueOnAnyThread();
+}
+
+uint64 GetStreamlineDLSSGVRAMEstimateBytes()
+{
+	return (IsStreamlineDLSSGVRAMEstimateEnabled() && IsDLSSGActive()) ? GLastDLSSGVRAMEstimateBytes.load() : 0;
+}
+
+bool CanReduceStreamlineDLSSGFramesToGenerateForBudget()
+{
+	return IsDLSSGActive() && GetStreamlineDLSSGNumFramesToGenerate() > FMath::Max(1, GDLSSGMinGeneratedFrames);
+}
+
+bool ReduceStreamlineDLSSGFramesToGenerateForBudget()
+{
+	if (!CanReduceStreamlineDLSSGFramesToGenerateForBudget())
+	{
+		return false;
+	}
+
+	GDLSSGBudgetMaxFramesToGenerate = GetStreamlineDLSSGNumFramesToGenerate() - 1;
+	return true;
+}
+
+void RestoreStreamlineDLSSGFramesToGenerateForBudget()
+{
+	const int32 BudgetMaxFramesToGenerate = GDLSSGBudgetMaxFramesToGenerate;
+	if (BudgetMaxFramesToGenerate > 0)
+	{
+		// each reduction took away one generated frame, so each restore gives one back
+		GDLSSGBudgetMaxFramesToGenerate = (BudgetMaxFramesToGenerate + 1 < GDLSSGMaxGeneratedFrames) ? BudgetMaxFramesToGenerate + 1 : 0;
+	}
+}
+
 DECLARE_STATS_GROUP(TEXT("DLSS-G"), STATGROUP_DLSSG, STATCAT_Advanced);
 DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS-G: Frames Presented"), STAT_DLSSGFramesPresented, STATGROUP_DLSSG);
 DECLARE_FLOAT_COUNTER_STAT(TEXT("DLSS-G: Average FPS"), STAT_DLSSGAverageFPS, STATGROUP_DLSSG);
-#if WITH_DLSS_FG_VRAM_ESTIMATE
 DECLARE_FLOAT_COUNTER_STAT(TEXT("DLSS-G: VRAM Estimate (MiB)"), STAT_DLSSGVRAMEstimate, STATGROUP_DLSSG);
-#endif
 DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS-G: Minimum Width or Height "), STAT_DLSSGMinWidthOrHeight, STATGROUP_DLSSG);
 DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS-G: Minimum Number of Generated Frames "), STAT_DLSSGMinGeneratedFrames, STATGROUP_DLSSG);
 DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS-G: Maximum Number of Generated Frames "), STAT_DLSSGMaxGeneratedFrames, STATGROUP_DLSSG);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("DLSS-G: Pacing Average Rendered Frame Interval (ms)"), STAT_DLSSGPacingAverageIntervalMs, STATGROUP_DLSSG);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("DLSS-G: Pacing Rendered Frame Interval StdDev (ms)"), STAT_DLSSGPacingIntervalStdDevMs, STATGROUP_DLSSG);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("DLSS-G: Pacing Max Rendered Frame Interval (ms)"), STAT_DLSSGPacingMaxIntervalMs, STATGROUP_DLSSG);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("DLSS-G: Pacing 1% Low Rendered FPS"), STAT_DLSSGPacingOnePercentLowFPS, STATGROUP_DLSSG);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("DLSS-G: Pacing 0.1% Low Rendered FPS"), STAT_DLSSGPacingPointOnePercentLowFPS, STATGROUP_DLSSG);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("DLSS-G: Pacing Generated / Presented"), STAT_DLSSGPacingGeneratedRatio, STATGROUP_DLSSG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS-G: Adaptive Frames To Generate"), STAT_DLSSGAdaptiveFramesToGenerate, STATGROUP_DLSSG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS-G: Adaptive Desired Frames To Generate"), STAT_DLSSGAdaptiveDesiredFramesToGenerate, STATGROUP_DLSSG);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("DLSS-G: Adaptive Target Refresh Rate"), STAT_DLSSGAdaptiveTargetRefreshRate, STATGROUP_DLSSG);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("DLSS-G: Adaptive Rendered FPS"), STAT_DLSSGAdaptiveRenderedFPS, STATGROUP_DLSSG);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("DLSS-G: Adaptive GPU Utilization"), STAT_DLSSGAdaptiveGPUUtilization, STATGROUP_DLSSG);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("DLSS-G: Adaptive Changes"), STAT_DLSSGAdaptiveChanges, STATGROUP_DLSSG);
 
 
 namespace sl
@@ -556,10 +657,7 @@ void GetDLSSGStatusFromStreamline(bool bQueryOncePerAppLifetimeValues)
 	GLastDLSSGFrameRate = GAverageFPS;
 	GLastDLSSGFramesPresented = 1;
 
-
-#if WITH_DLSS_FG_VRAM_ESTIMATE
-	GLastDLSSGVRAMEstimate = 0;
-#endif
+	GLastDLSSGVRAMEstimateBytes = 0;
 
 	if (bQueryOncePerAppLifetimeValues)
 	{
@@ -582,9 +680,11 @@ void GetDLSSGStatusFromStreamline(bool bQueryOncePerAppLifetimeValues)
 
 		sl::DLSSGOptions StreamlineConstantsDLSSG;
 
-#if WITH_DLSS_FG_VRAM_ESTIMATE
-		StreamlineConstantsDLSSG.flags = sl::DLSSGFlags::eRequestVRAMEstimate;
-#endif
+		const bool bRequestVRAMEstimate = IsStreamlineDLSSGVRAMEstimateEnabled();
+		if (bRequestVRAMEstimate)
+		{
+			StreamlineConstantsDLSSG.flags = sl::DLSSGFlags::eRequestVRAMEstimate;
+		}
 		StreamlineConstantsDLSSG.mode = (!NeedStreamlineViewIdOverride()) ?  SLDLSSGModeFromCvar() : sl::DLSSGMode::eOff;
 
 		// TODO incorporate the checks (foreground, viewport large enough) from SetStreamlineDLSSGState
@@ -596,13 +696,29 @@ void GetDLSSGStatusFromStreamline(bool bQueryOncePerAppLifetimeValues)
 		GLastDLSSGFramesPresented = State.numFramesActuallyPresented;
 		SET_DWORD_STAT(STAT_DLSSGFramesPresented, GLastDLSSGFramesPresented);
 
+		if (!bQueryOncePerAppLifetimeValues)
+		{
+			FStreamlineDLSSGPacingAnalyzer::Get().RecordRenderedFrame(FPlatformTime::Seconds(), GLastDLSSGFramesPresented);
+#if STATS
+			FStreamlineDLSSGPacingStats PacingStats;
+			GetStreamlineDLSSGPacingStats(PacingStats);
+			SET_FLOAT_STAT(STAT_DLSSGPacingAverageIntervalMs, PacingStats.AverageFrameIntervalMs);
+			SET_FLOAT_STAT(STAT_DLSSGPacingIntervalStdDevMs, PacingStats.FrameIntervalStdDevMs);
+			SET_FLOAT_STAT(STAT_DLSSGPacingMaxIntervalMs, PacingStats.MaxFrameIntervalMs);
+			SET_FLOAT_STAT(STAT_DLSSGPacingOnePercentLowFPS, PacingStats.OnePercentLowRenderedFPS);
+			SET_FLOAT_STAT(STAT_DLSSGPacingPointOnePercentLowFPS, PacingStats.PointOnePercentLowRenderedFPS);
+			SET_FLOAT_STAT(STAT_DLSSGPacingGeneratedRatio, PacingStats.GeneratedToPresentedRatio);
+#endif
+		}
+
 		GLastDLSSGFrameRate = GAverageFPS * GLastDLSSGFramesPresented;
 		SET_FLOAT_STAT(STAT_DLSSGAverageFPS, GLastDLSSGFrameRate);
 
-#if WITH_DLSS_FG_VRAM_ESTIMATE
-		GLastDLSSGVRAMEstimate = float(State.estimatedVRAMUsageInBytes) / (1024 * 1024);
-		SET_FLOAT_STAT(STAT_DLSSGVRAMEstimate, GLastDLSSGVRAMEstimate);
-#endif
+		if (bRequestVRAMEstimate)
+		{
+			GLastDLSSGVRAMEstimateBytes = State.estimatedVRAMUsageInBytes;
+		}
+		SET_FLOAT_STAT(STAT_DLSSGVRAMEstimate, float(GLastDLSSGVRAMEstimateBytes.load()) / (1024 * 1024));
 		if (bQueryOncePerAppLifetimeValues)
 		{
 			GDLSSGMinWidthOrHeight = State.minWidthOrHeight;
@@ -632,57 +748,265 @@ STREAMLINECORE_API void GetStreamlineDLSSGFrameTiming(float& FrameRateInHertz, i
 	FramesPresented = GLastDLSSGFramesPresented;
 }
 
-void AddStreamlineDLSSGStateRenderPass(FRDGBuilder& GraphBuilder, uint32 ViewID, const FIntRect& SecondaryViewRect)
+// computes the SL options struct based on cvars and other state
+static sl::DLSSGOptions GetDLSSGStateOptions(uint32 ViewID, const FIntRect& SecondaryViewRect)
 {
-	AddStreamlineStateRenderPass (TEXT("DLSS-G"), GraphBuilder, ViewID, SecondaryViewRect,
-		// this lambda computes the SL options struct based on cvars and other state
-		[] (uint32 ViewID, const FIntRect & SecondaryViewRect) ->sl::DLSSGOptions
-		{
-			// the callsite is expcted to not call this, so we don't need to if bail out here
-			check(IsStreamlineDLSSGSupported());
-			check(IsInRenderingThread());
+	// the callsite is expcted to not call this, so we don't need to if bail out here
+	check(IsStreamlineDLSSGSupported());
+	check(IsInRenderingThread());
 
-			sl::DLSSGOptions SLConstants;
-			SLConstants.onErrorCallback = DLSSGAPIErrorCallBack;
+	sl::DLSSGOptions SLConstants;
+	SLConstants.onErrorCallback = DLSSGAPIErrorCallBack;
 
 #if (ENGINE_MAJOR_VERSION == 4)
-			const bool bIsForeground = FApp::HasVRFocus() || FApp::IsBenchmarking() || FPlatformApplicationMisc::IsThisApplicationForeground();
+	const bool bIsForeground = FApp::HasVRFocus() || FApp::IsBenchmarking() || FPlatformApplicationMisc::IsThisApplicationForeground();
 #else
-			const bool bIsForeground = FApp::HasFocus();
+	const bool bIsForeground = FApp::HasFocus();
 #endif
-			const bool bIsLargeEnough = FMath::Min(SecondaryViewRect.Width(), SecondaryViewRect.Height()) >= GDLSSGMinWidthOrHeight;
+	const bool bIsLargeEnough = FMath::Min(SecondaryViewRect.Width(), SecondaryViewRect.Height()) >= GDLSSGMinWidthOrHeight;
 
-			SLConstants.mode = (bIsForeground && bIsLargeEnough) ? SLDLSSGModeFromCvar() : sl::DLSSGMode::eOff;
+	const bool bIsSuspendedByUI = IsStreamlineUICoverageSuspendingFrameGeneration();
 
-			if (CVarStreamlineFullScreenMenuDetection.GetValueOnRenderThread() != 0)
-			{
-				EnumAddFlags(SLConstants.flags, sl::DLSSGFlags::eEnableFullscreenMenuDetection);
-			}
+	SLConstants.mode = (bIsForeground && bIsLargeEnough && !bIsSuspendedByUI) ? SLDLSSGModeFromCvar() : sl::DLSSGMode::eOff;
 
-			if (CVarStreamlineDLSSGDynamicResolutionMode.GetValueOnRenderThread() != 0)
-			{
-				EnumAddFlags(SLConstants.flags, sl::DLSSGFlags::eDynamicResolutionEnabled);
-			}
+	if (CVarStreamlineFullScreenMenuDetection.GetValueOnRenderThread() != 0)
+	{
+		EnumAddFlags(SLConstants.flags, sl::DLSSGFlags::eEnableFullscreenMenuDetection);
+	}
 
-			if (CVarStreamlineDLSSGRetainResourcesWhenOff.GetValueOnRenderThread() != 0)
-			{
-				EnumAddFlags(SLConstants.flags, sl::DLSSGFlags::eRetainResourcesWhenOff);
-			}
-			
-			SLConstants.numFramesToGenerate = GetStreamlineDLSSGNumFramesToGenerate();
+	if (CVarStreamlineDLSSGDynamicResolutionMode.GetValueOnRenderThread() != 0)
+	{
+		EnumAddFlags(SLConstants.flags, sl::DLSSGFlags::eDynamicResolutionEnabled);
+	}
+
+	const bool bForceRetainResources = (CVarStreamlineDLSSGRetainResourcesWhenOff.GetValueOnRenderThread() != 0) || (bIsSuspendedByUI && ShouldStreamlineUICoverageRetainResources());
+	if (UpdateStreamlineHibernation(EStreamlineHibernationFeature::DLSSG, ViewID, SLConstants.mode != sl::DLSSGMode::eOff, bForceRetainResources))
+	{
+		EnumAddFlags(SLConstants.flags, sl::DLSSGFlags::eRetainResourcesWhenOff);
+	}
+	
+	SLConstants.numFramesToGenerate = GetStreamlineDLSSGNumFramesToGenerate();
+
+	return SLConstants;
+}
 
-			return SLConstants;
+static bool AreDLSSGOptionsEquivalent(const sl::DLSSGOptions& Opt1, const sl::DLSSGOptions& Opt2)
+{
+	return (Opt1.mode == Opt2.mode)
+		&& (Opt1.numFramesToGenerate == Opt2.numFramesToGenerate)
+		&& (Opt1.flags == Opt2.flags)
+		&& (Opt1.dynamicResWidth == Opt2.dynamicResWidth)
+		&& (Opt1.dynamicResHeight == Opt2.dynamicResHeight)
+		&& (Opt1.numBackBuffers == Opt2.numBackBuffers)
+		&& (Opt1.mvecDepthWidth == Opt2.mvecDepthWidth)
+		&& (Opt1.mvecDepthHeight == Opt2.mvecDepthHeight)
+		&& (Opt1.colorWidth == Opt2.colorWidth)
+		&& (Opt1.colorHeight == Opt2.colorHeight)
+		&& (Opt1.colorBufferFormat == Opt2.colorBufferFormat)
+		&& (Opt1.mvecBufferFormat == Opt2.mvecBufferFormat)
+		&& (Opt1.depthBufferFormat == Opt2.depthBufferFormat)
+		&& (Opt1.hudLessBufferFormat == Opt2.hudLessBufferFormat)
+		&& (Opt1.uiBufferFormat == Opt2.uiBufferFormat)
+		&& (Opt1.onErrorCallback == Opt2.onErrorCallback)
+		&& (Opt1.queueParallelismMode == Opt2.queueParallelismMode);
+}
+
+static TStreamlineOptionsCache<sl::DLSSGOptions> GDLSSGOptionsCache(TEXT("DLSS-G"), &AreDLSSGOptionsEquivalent);
+
+static void SetDLSSGStateOptions(FRHICommandListImmediate& RHICmdList, uint32 ViewID, const FIntRect& SecondaryViewRect, const sl::DLSSGOptions& Options)
+{
+	if (GDLSSGOptionsCache.ShouldSubmit(ViewID, Options))
+	{
+		CALL_SL_FEATURE_FN(sl::kFeatureDLSS_G, slDLSSGSetOptions, sl::ViewportHandle(ViewID), Options);
+	}
+}
+
+void AddStreamlineDLSSGStateRenderPass(FRDGBuilder& GraphBuilder, uint32 ViewID, const FIntRect& SecondaryViewRect)
+{
+	AddStreamlineStateRenderPass (TEXT("DLSS-G"), GraphBuilder, ViewID, SecondaryViewRect,
+		[] (uint32 ViewID, const FIntRect & SecondaryViewRect) ->sl::DLSSGOptions
+		{
+			return GetDLSSGStateOptions(ViewID, SecondaryViewRect);
 		},
 		// this lambda is only here since templating the function pointer and functin name and such below is inconvenient
 		[](FRHICommandListImmediate& RHICmdList, uint32 ViewID, const FIntRect& SecondaryViewRect, const sl::DLSSGOptions& Options)
 		{
-			CALL_SL_FEATURE_FN(sl::kFeatureDLSS_G, slDLSSGSetOptions, sl::ViewportHandle(ViewID), Options);
+			SetDLSSGStateOptions(RHICmdList, ViewID, SecondaryViewRect, Options);
 		}
 		);
 }
 
+void AddStreamlineDLSSGStateRenderPass(FRDGBuilder& GraphBuilder, TArray<FStreamlineStateBatchView>&& Views)
+{
+	AddStreamlineBatchedStateRenderPass(TEXT("DLSS-G"), GraphBuilder, MoveTemp(Views),
+		[](uint32 ViewID, const FIntRect& SecondaryViewRect) -> sl::DLSSGOptions
+		{
+			return GetDLSSGStateOptions(ViewID, SecondaryViewRect);
+		},
+		[](FRHICommandListImmediate& RHICmdList, uint32 ViewID, const FIntRect& SecondaryViewRect, const sl::DLSSGOptions& Options)
+		{
+			SetDLSSGStateOptions(RHICmdList, ViewID, SecondaryViewRect, Options);
+		}
+		);
+}
+
+// Refresh rate of the display mode the game window is on right now. FPlatformMisc::GetMaxRefreshRate is the highest mode the panel
+// supports, which isn't what it runs at when the desktop or the game picked a lower one
+static float QueryActiveDisplayRefreshRate()
+{
+	HMONITOR Monitor = nullptr;
+	if (GEngine && GEngine->GameViewport)
+	{
+		const TSharedPtr<SWindow> Window = GEngine->GameViewport->GetWindow();
+		if (Window.IsValid() && Window->GetNativeWindow().IsValid())
+		{
+			Monitor = MonitorFromWindow(HWND(Window->GetNativeWindow()->GetOSWindowHandle()), MONITOR_DEFAULTTOPRIMARY);
+		}
+	}
+	if (!Monitor)
+	{
+		Monitor = MonitorFromWindow(nullptr, MONITOR_DEFAULTTOPRIMARY);
+	}
+
+	MONITORINFOEXW MonitorInfo = {};
+	MonitorInfo.cbSize = sizeof(MonitorInfo);
+	DEVMODEW DisplayMode = {};
+	DisplayMode.dmSize = sizeof(DisplayMode);
+
+	// 0 and 1 stand for the default of the hardware
+	if (GetMonitorInfoW(Monitor, &MonitorInfo) && EnumDisplaySettingsW(MonitorInfo.szDevice, ENUM_CURRENT_SETTINGS, &DisplayMode) && DisplayMode.dmDisplayFrequency > 1)
+	{
+		return float(DisplayMode.dmDisplayFrequency);
+	}
+
+	return float(FPlatformMisc::GetMaxRefreshRate());
+}
+
+static float GetAdaptiveDLSSGTargetRefreshRate()
+{
+	const float TargetRefreshRate = CVarStreamlineDLSSGAdaptiveTargetRefreshRate.GetValueOnGameThread();
+	if (TargetRefreshRate > 0.0f)
+	{
+		return TargetRefreshRate;
+	}
+
+	FDLSSGAdaptiveFramesToGenerateState& State = GDLSSGAdaptiveState;
+	const double Now = FPlatformTime::Seconds();
+	if (State.DisplayRefreshRate <= 0.0f || Now - State.DisplayRefreshRateQueryTime > 1.0)
+	{
+		State.DisplayRefreshRate = QueryActiveDisplayRefreshRate();
+		State.DisplayRefreshRateQueryTime = Now;
+	}
+	return State.DisplayRefreshRate;
+}
+
+static void UpdateAdaptiveDLSSGFramesToGenerate()
+{
+	check(IsInGameThread());
+
+	if (GDLSSGAdaptiveLastUpdateFrame == GFrameCounter)
+	{
+		return;
+	}
+	GDLSSGAdaptiveLastUpdateFrame = GFrameCounter;
+
+	FDLSSGAdaptiveFramesToGenerateState& State = GDLSSGAdaptiveState;
+
+	const bool bActive = CVarStreamlineDLSSGAdaptiveFramesToGenerate.GetValueOnGameThread() && IsDLSSGActive();
+	if (bActive != State.bActive)
+	{
+		State = FDLSSGAdaptiveFramesToGenerateState();
+		State.bActive = bActive;
+		GDLSSGAdaptiveFramesToGenerate = 0;
+	}
+
+	if (!bActive)
+	{
+		return;
+	}
+
+	const int32 MinFramesToGenerate = FMath::Max(1, GDLSSGMinGeneratedFrames);
+	const int32 MaxFramesToGenerate = FMath::Clamp(CVarStreamlineDLSSGFramesToGenerate.GetValueOnGameThread(), MinFramesToGenerate, FMath::Max(MinFramesToGenerate, GDLSSGMaxGeneratedFrames));
+
+	int32 CurrentFramesToGenerate = GDLSSGAdaptiveFramesToGenerate;
+	if (CurrentFramesToGenerate <= 0)
+	{
+		// start from the configured value and let the controller walk down from there
+		CurrentFramesToGenerate = MaxFramesToGenerate;
+	}
+	CurrentFramesToGenerate = FMath::Clamp(CurrentFramesToGenerate, MinFramesToGenerate, MaxFramesToGenerate);
+
+	extern ENGINE_API float GAverageFPS;
+	extern ENGINE_API float GAverageMS;
+	const float RenderedFPS = GAverageFPS;
+	const float TargetRefreshRate = GetAdaptiveDLSSGTargetRefreshRate();
+	const float Hysteresis = FMath::Clamp(CVarStreamlineDLSSGAdaptiveHysteresis.GetValueOnGameThread(), 0.0f, 0.5f);
+
+	const float GPUFrameTimeMs = FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles());
+	const float GPUUtilization = GAverageMS > 0.0f ? GPUFrameTimeMs / GAverageMS : 0.0f;
+	const float MaxGPUUtilization = CVarStreamlineDLSSGAdaptiveMaxGPUUtilization.GetValueOnGameThread();
+	const bool bIsOverGPUBudget = MaxGPUUtilization > 0.0f && GPUUtilization > MaxGPUUtilization;
+
+	int32 DesiredFramesToGenerate = CurrentFramesToGenerate;
+	if (RenderedFPS > 0.0f && TargetRefreshRate > 0.0f)
+	{
+		// N generated frames present (N + 1) frames per rendered frame. Presenting faster than the display refreshes only queues up frames,
+		// so the output never gets to exceed the target and the hysteresis band lies below it: generating more only when that still
+		// clearly stays below the refresh rate keeps us from flapping right at the boundary
+		const float OutputFPS = RenderedFPS * (CurrentFramesToGenerate + 1);
+		const float OutputFPSWithOneMore = RenderedFPS * (CurrentFramesToGenerate + 2);
+
+		if (OutputFPS > TargetRefreshRate)
+		{
+			DesiredFramesToGenerate = FMath::FloorToInt32(TargetRefreshRate / RenderedFPS) - 1;
+		}
+		else if (OutputFPSWithOneMore <= TargetRefreshRate * (1.0f - Hysteresis) && !bIsOverGPUBudget)
+		{
+			DesiredFramesToGenerate = FMath::FloorToInt32(TargetRefreshRate * (1.0f - Hysteresis) / RenderedFPS) - 1;
+		}
+		else if (bIsOverGPUBudget)
+		{
+			// a saturated GPU pays for every generated frame with rendered frame rate
+			DesiredFramesToGenerate = CurrentFramesToGenerate - 1;
+		}
+	}
+	DesiredFramesToGenerate = FMath::Clamp(DesiredFramesToGenerate, MinFramesToGenerate, MaxFramesToGenerate);
+
+	if (DesiredFramesToGenerate != CurrentFramesToGenerate)
+	{
+		if (DesiredFramesToGenerate != State.PendingFramesToGenerate)
+		{
+			State.PendingFramesToGenerate = DesiredFramesToGenerate;
+			State.NumFramesPending = 0;
+		}
+
+		if (++State.NumFramesPending >= FMath::Max(1, CVarStreamlineDLSSGAdaptiveSettleFrames.GetValueOnGameThread()))
+		{
+			UE_LOG(LogStreamline, Verbose, TEXT("Adaptive DLSS-FG: generating %d instead of %d frames (rendered %.1f FPS, target %.1f Hz, GPU utilization %.2f)"),
+				DesiredFramesToGenerate, CurrentFramesToGenerate, RenderedFPS, TargetRefreshRate, GPUUtilization);
+			CurrentFramesToGenerate = DesiredFramesToGenerate;
+			State.NumFramesPending = 0;
+			INC_DWORD_STAT(STAT_DLSSGAdaptiveChanges);
+		}
+	}
+	else
+	{
+		State.NumFramesPending = 0;
+	}
+
+	GDLSSGAdaptiveFramesToGenerate = CurrentFramesToGenerate;
+
+	SET_DWORD_STAT(STAT_DLSSGAdaptiveFramesToGenerate, CurrentFramesToGenerate);
+	SET_DWORD_STAT(STAT_DLSSGAdaptiveDesiredFramesToGenerate, DesiredFramesToGenerate);
+	SET_FLOAT_STAT(STAT_DLSSGAdaptiveTargetRefreshRate, TargetRefreshRate);
+	SET_FLOAT_STAT(STAT_DLSSGAdaptiveRenderedFPS, RenderedFPS);
+	SET_FLOAT_STAT(STAT_DLSSGAdaptiveGPUUtilization, GPUUtilization);
+}
+
 void BeginRenderViewFamilyDLSSG(FSceneViewFamily& InViewFamily)
 {
+	UpdateAdaptiveDLSSGFramesToGenerate();
+
 	if(IsDLSSGActive() && CVarStreamlineDLSSGAdjustMotionBlurTimeScale.GetValueOnAnyThread() && InViewFamily.Views.Num())
 	{
 		// this is 1 when FG is off (or auto modes turns it off)
@@ -0,0 +1,235 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineDLSSGPacing.h"
+#include "StreamlineCorePrivate.h"
+#include "StreamlineDLSSG.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+static TAutoConsoleVariable<int32> CVarStreamlineDLSSGPacingHistorySize(
+	TEXT("r.Streamline.DLSSG.Pacing.HistorySize"),
+	4096,
+	TEXT("Number of rendered frames the DLSS-FG pacing analyzer keeps to compute frame interval histograms, variance and 1%/0.1% lows (default = 4096)\n")
+	TEXT("0: disables the pacing analyzer\n"),
+	ECVF_Default);
+
+static FAutoConsoleCommand CCmdStreamlineDLSSGPacingReset(
+	TEXT("r.Streamline.DLSSG.Pacing.Reset"),
+	TEXT("Clears the rendered frames recorded by the DLSS-FG pacing analyzer"),
+	FConsoleCommandDelegate::CreateStatic(&ResetStreamlineDLSSGPacingStats));
+
+static FAutoConsoleCommand CCmdStreamlineDLSSGPacingDumpCSV(
+	TEXT("r.Streamline.DLSSG.Pacing.DumpCSV"),
+	TEXT("Writes the rendered frames recorded by the DLSS-FG pacing analyzer to a CSV file. Optional argument: file name, defaults to one in the profiling directory"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		DumpStreamlineDLSSGPacingToCSV(Args.Num() > 0 ? Args[0] : FString());
+	}));
+
+FStreamlineDLSSGPacingAnalyzer& FStreamlineDLSSGPacingAnalyzer::Get()
+{
+	static FStreamlineDLSSGPacingAnalyzer Analyzer;
+	return Analyzer;
+}
+
+void FStreamlineDLSSGPacingAnalyzer::ResizeRingBuffer(int32 NewCapacity)
+{
+	Samples.SetNum(NewCapacity);
+	FirstSample = 0;
+	NumSamples = 0;
+
+	Histogram.Init(0, NumHistogramBuckets);
+	SumIntervalMs = 0.0;
+	SumSquaredIntervalMs = 0.0;
+	NumPresented = 0;
+}
+
+void FStreamlineDLSSGPacingAnalyzer::AddSample(const FRenderedFrameSample& Sample)
+{
+	const int32 Capacity = Samples.Num();
+
+	if (NumSamples == Capacity)
+	{
+		// evict the oldest sample from the running totals
+		const FRenderedFrameSample& Evicted = Samples[FirstSample];
+		--Histogram[GetHistogramBucket(Evicted.IntervalMs)];
+		SumIntervalMs -= Evicted.IntervalMs;
+		SumSquaredIntervalMs -= double(Evicted.IntervalMs) * Evicted.IntervalMs;
+		NumPresented -= Evicted.NumFramesPresented;
+
+		FirstSample = (FirstSample + 1) % Capacity;
+		--NumSamples;
+	}
+
+	Samples[(FirstSample + NumSamples) % Capacity] = Sample;
+	++NumSamples;
+
+	++Histogram[GetHistogramBucket(Sample.IntervalMs)];
+	SumIntervalMs += Sample.IntervalMs;
+	SumSquaredIntervalMs += double(Sample.IntervalMs) * Sample.IntervalMs;
+	NumPresented += Sample.NumFramesPresented;
+}
+
+void FStreamlineDLSSGPacingAnalyzer::RecordRenderedFrame(double PresentTimeInSeconds, int32 NumFramesActuallyPresented)
+{
+	const int32 HistorySize = FMath::Max(0, CVarStreamlineDLSSGPacingHistorySize.GetValueOnAnyThread());
+
+	FScopeLock Lock(&Section);
+
+	if (HistorySize != Samples.Num())
+	{
+		ResizeRingBuffer(HistorySize);
+		LastRenderedPresentTime = -1.0;
+	}
+
+	if (HistorySize == 0)
+	{
+		return;
+	}
+
+	// the first frame after a reset only establishes the time base
+	if (LastRenderedPresentTime < 0.0 || PresentTimeInSeconds <= LastRenderedPresentTime)
+	{
+		LastRenderedPresentTime = PresentTimeInSeconds;
+		return;
+	}
+
+	FRenderedFrameSample Sample;
+	Sample.PresentTime = PresentTimeInSeconds;
+	Sample.IntervalMs = float((PresentTimeInSeconds - LastRenderedPresentTime) * 1000.0);
+	// numFramesActuallyPresented includes the rendered frame, so everything else in this interval got generated
+	Sample.NumFramesPresented = FMath::Max(1, NumFramesActuallyPresented);
+	AddSample(Sample);
+
+	LastRenderedPresentTime = PresentTimeInSeconds;
+}
+
+float FStreamlineDLSSGPacingAnalyzer::GetIntervalPercentileMs(float Percentile) const
+{
+	// walk the histogram from the slow end until we have covered the requested fraction of the worst frames
+	const int32 NumWorst = FMath::Max(1, FMath::CeilToInt32(NumSamples * (1.0f - Percentile)));
+	int32 NumSeen = 0;
+
+	for (int32 Bucket = NumHistogramBuckets - 1; Bucket >= 0; --Bucket)
+	{
+		NumSeen += Histogram[Bucket];
+		if (NumSeen >= NumWorst)
+		{
+			return (Bucket + 0.5f) * HistogramBucketWidthMs;
+		}
+	}
+
+	return 0.0f;
+}
+
+void FStreamlineDLSSGPacingAnalyzer::GetStats(FStreamlineDLSSGPacingStats& OutStats, bool bWithHistogram) const
+{
+	FScopeLock Lock(&Section);
+
+	OutStats = FStreamlineDLSSGPacingStats();
+	OutStats.HistogramBucketWidthMs = HistogramBucketWidthMs;
+
+	if (bWithHistogram)
+	{
+		OutStats.FrameIntervalHistogram = Histogram;
+	}
+
+	if (NumSamples == 0)
+	{
+		return;
+	}
+
+	OutStats.NumRenderedFrames = NumSamples;
+	OutStats.NumPresentedFrames = NumPresented;
+	OutStats.GeneratedToPresentedRatio = float(NumPresented - NumSamples) / float(NumPresented);
+
+	const double Mean = SumIntervalMs / NumSamples;
+	const double Variance = FMath::Max(0.0, SumSquaredIntervalMs / NumSamples - Mean * Mean);
+	OutStats.AverageFrameIntervalMs = float(Mean);
+	OutStats.FrameIntervalVarianceMs2 = float(Variance);
+	OutStats.FrameIntervalStdDevMs = float(FMath::Sqrt(Variance));
+	OutStats.AverageRenderedFPS = Mean > 0.0 ? float(1000.0 / Mean) : 0.0f;
+
+	float MaxIntervalMs = 0.0f;
+	for (int32 Index = 0; Index < NumSamples; ++Index)
+	{
+		MaxIntervalMs = FMath::Max(MaxIntervalMs, Samples[(FirstSample + Index) % Samples.Num()].IntervalMs);
+	}
+	OutStats.MaxFrameIntervalMs = MaxIntervalMs;
+
+	// the overflow bucket has no meaningful midpoint, so clamp the percentiles to the slowest interval we actually saw
+	const float OnePercentLowMs = FMath::Min(GetIntervalPercentileMs(0.99f), MaxIntervalMs);
+	const float PointOnePercentLowMs = FMath::Min(GetIntervalPercentileMs(0.999f), MaxIntervalMs);
+	OutStats.OnePercentLowRenderedFPS = OnePercentLowMs > 0.0f ? 1000.0f / OnePercentLowMs : 0.0f;
+	OutStats.PointOnePercentLowRenderedFPS = PointOnePercentLowMs > 0.0f ? 1000.0f / PointOnePercentLowMs : 0.0f;
+}
+
+void FStreamlineDLSSGPacingAnalyzer::Reset()
+{
+	FScopeLock Lock(&Section);
+	ResizeRingBuffer(Samples.Num());
+	LastRenderedPresentTime = -1.0;
+}
+
+bool FStreamlineDLSSGPacingAnalyzer::DumpToCSV(const FString& Filename) const
+{
+	TArray<FString> Lines;
+	{
+		FScopeLock Lock(&Section);
+
+		Lines.Reserve(NumSamples + 1);
+		Lines.Add(TEXT("Frame,PresentTimeSeconds,FrameIntervalMs,FramesPresented"));
+
+		const double FirstTime = NumSamples > 0 ? Samples[FirstSample].PresentTime : 0.0;
+		for (int32 Index = 0; Index < NumSamples; ++Index)
+		{
+			const FRenderedFrameSample& Sample = Samples[(FirstSample + Index) % Samples.Num()];
+			Lines.Add(FString::Printf(TEXT("%d,%.6f,%.4f,%d"), Index, Sample.PresentTime - FirstTime, Sample.IntervalMs, Sample.NumFramesPresented));
+		}
+	}
+
+	return FFileHelper::SaveStringArrayToFile(Lines, *Filename);
+}
+
+STREAMLINECORE_API void GetStreamlineDLSSGPacingStats(FStreamlineDLSSGPacingStats& OutStats, bool bWithHistogram)
+{
+	FStreamlineDLSSGPacingAnalyzer::Get().GetStats(OutStats, bWithHistogram);
+}
+
+STREAMLINECORE_API void ResetStreamlineDLSSGPacingStats()
+{
+	FStreamlineDLSSGPacingAnalyzer::Get().Reset();
+}
+
+STREAMLINECORE_API FString DumpStreamlineDLSSGPacingToCSV(const FString& Filename)
+{
+	const FString OutFilename = !Filename.IsEmpty() ? Filename :
+		FPaths::Combine(FPaths::ProfilingDir(), TEXT("Streamline"), FString::Printf(TEXT("DLSSGPacing-%s.csv"), *FDateTime::Now().ToString()));
+
+	if (!FStreamlineDLSSGPacingAnalyzer::Get().DumpToCSV(OutFilename))
+	{
+		UE_LOG(LogStreamline, Warning, TEXT("Failed to write the DLSS-FG pacing CSV to %s"), *OutFilename);
+		return FString();
+	}
+
+	FStreamlineDLSSGPacingStats Stats;
+	GetStreamlineDLSSGPacingStats(Stats);
+	UE_LOG(LogStreamline, Log, TEXT("Wrote %d DLSS-FG rendered frames to %s: %.1f rendered FPS average, %.1f FPS 1%% low, %.1f FPS 0.1%% low, frame interval stddev %.3f ms, %.1f%% of %d presented frames generated"),
+		Stats.NumRenderedFrames, *OutFilename, Stats.AverageRenderedFPS, Stats.OnePercentLowRenderedFPS, Stats.PointOnePercentLowRenderedFPS, Stats.FrameIntervalStdDevMs,
+		100.0f * Stats.GeneratedToPresentedRatio, Stats.NumPresentedFrames);
+
+	return OutFilename;
+}
@@ -0,0 +1,68 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+struct FStreamlineDLSSGPacingStats;
+
+// Keeps the most recent rendered frames in a ring buffer and derives pacing metrics from the intervals between their presents.
+// Streamline only reports how many frames got presented since the last rendered frame, not when, so the intervals between
+// generated presents can't be measured here. Those are only counted, to report the share of presented frames DLSS-FG generated
+class FStreamlineDLSSGPacingAnalyzer
+{
+public:
+	static FStreamlineDLSSGPacingAnalyzer& Get();
+
+	// called once per rendered frame, right after present
+	void RecordRenderedFrame(double PresentTimeInSeconds, int32 NumFramesActuallyPresented);
+
+	void GetStats(FStreamlineDLSSGPacingStats& OutStats, bool bWithHistogram) const;
+	void Reset();
+	bool DumpToCSV(const FString& Filename) const;
+
+	static constexpr float HistogramBucketWidthMs = 0.25f;
+	// the last bucket collects everything at or above NumHistogramBuckets * HistogramBucketWidthMs
+	static constexpr int32 NumHistogramBuckets = 400;
+
+private:
+	struct FRenderedFrameSample
+	{
+		double PresentTime = 0.0;
+		float IntervalMs = 0.0f;
+		// the rendered frame and the frames generated ahead of it
+		int32 NumFramesPresented = 1;
+	};
+
+	void AddSample(const FRenderedFrameSample& Sample);
+	void ResizeRingBuffer(int32 NewCapacity);
+	float GetIntervalPercentileMs(float Percentile) const;
+
+	static int32 GetHistogramBucket(float IntervalMs)
+	{
+		return FMath::Clamp(int32(IntervalMs / HistogramBucketWidthMs), 0, NumHistogramBuckets - 1);
+	}
+
+	mutable FCriticalSection Section;
+
+	TArray<FRenderedFrameSample> Samples;
+	int32 FirstSample = 0;
+	int32 NumSamples = 0;
+
+	// running totals over the samples in the ring buffer, updated as samples get added and evicted
+	TArray<int32> Histogram;
+	double SumIntervalMs = 0.0;
+	double SumSquaredIntervalMs = 0.0;
+	int32 NumPresented = 0;
+
+	double LastRenderedPresentTime = -1.0;
+};
@@ -11,6 +11,8 @@
 #include "StreamlineDeepDVC.h"
 #include "StreamlineCore.h"
 #include "StreamlineCorePrivate.h"
+#include "StreamlineStartupProbes.h"
+#include "StreamlineOptionsCache.h"
 #include "StreamlineAPI.h"
 #include "StreamlineRHI.h"
 #include "sl_helpers.h"
@@ -25,6 +27,8 @@
 #include "SystemTextures.h"
 #include "HAL/PlatformApplicationMisc.h"
 
+#include <atomic>
+
 static TAutoConsoleVariable<int32> CVarStreamlineDeepDVCEnable(
 	TEXT("r.Streamline.DeepDVC.Enable"),
 	0,
@@ -56,6 +60,9 @@ static Streamline::EStreamlineFeatureSupport GStreamlineDeepDVCSupport = Streaml
 namespace
 {
 	float GLastDeepDVCVRAMEstimate = 0;
+
+	// set by the VRAM budget manager. Game thread writes, any thread reads
+	std::atomic<bool> GDeepDVCSuspendedByBudget = false;
 }
 
 STREAMLINECORE_API Streamline::EStreamlineFeatureSupport QueryStreamlineDeepDVCSupport()
@@ -82,7 +89,7 @@ STREAMLINECORE_API Streamline::EStreamlineFeatureSupport QueryStreamlineDeepDVCS
 			if (StreamlineRHI->IsDeepDVCSupportedByRHI())
 			{
 				const sl::Feature Feature = sl::kFeatureDeepDVC;
-				sl::Result SupportedResult = SLisFeatureSupported(Feature, *StreamlineRHI->GetAdapterInfo());
+				sl::Result SupportedResult = GetStreamlineFeatureProbeResult(Feature);
 				LogStreamlineFeatureSupport(Feature, *StreamlineRHI->GetAdapterInfo());
 
 				GStreamlineDeepDVCSupport = TranslateStreamlineResult(SupportedResult);
@@ -129,7 +136,7 @@ static sl::DeepDVCMode SLDeepDVCModeFromCvar()
 
 bool IsDeepDVCActive()
 {
-	if (!IsStreamlineDeepDVCSupported())
+	if (!IsStreamlineDeepDVCSupported() || GDeepDVCSuspendedByBudget)
 	{
 		return false;
 	}
@@ -141,6 +148,24 @@ bool IsDeepDVCActive()
 
 
 
+uint64 GetStreamlineDeepDVCVRAMEstimateBytes()
+{
+	return uint64(GLastDeepDVCVRAMEstimate * 1024.0f * 1024.0f);
+}
+
+bool IsStreamlineDeepDVCSuspendedByBudget()
+{
+	return GDeepDVCSuspendedByBudget;
+}
+
+void SetStreamlineDeepDVCSuspendedByBudget(bool bSuspended)
+{
+	if (GDeepDVCSuspendedByBudget.exchange(bSuspended) != bSuspended)
+	{
+		UE_LOG(LogStreamline, Log, TEXT("DeepDVC %s by the VRAM budget"), bSuspended ? TEXT("suspended") : TEXT("resumed"));
+	}
+}
+
 DECLARE_STATS_GROUP(TEXT("DeepDVC"), STATGROUP_DeepDVC, STATCAT_Advanced);
 DECLARE_FLOAT_COUNTER_STAT(TEXT("DeepDVC: VRAM Estimate (MiB)"), STAT_DeepDVCVRAMEstimate, STATGROUP_DeepDVC);
 
@@ -183,6 +208,15 @@ SHADER_PARAMETER_STRUCT_INCLUDE(FDebugLayerCompatibilityShaderParameters, DebugL
 END_SHADER_PARAMETER_STRUCT()
 }
 
+static bool AreDeepDVCOptionsEquivalent(const sl::DeepDVCOptions& Opt1, const sl::DeepDVCOptions& Opt2)
+{
+	return (Opt1.mode == Opt2.mode)
+		&& (Opt1.intensity == Opt2.intensity)
+		&& (Opt1.saturationBoost == Opt2.saturationBoost);
+}
+
+static TStreamlineOptionsCache<sl::DeepDVCOptions> GDeepDVCOptionsCache(TEXT("DeepDVC"), &AreDeepDVCOptionsEquivalent);
+
 void AddStreamlineDeepDVCStateRenderPass(FRDGBuilder& GraphBuilder, uint32 ViewID, const FIntRect& SecondaryViewRect)
 {
 	AddStreamlineStateRenderPass(TEXT("DeepDVC"), GraphBuilder, ViewID, SecondaryViewRect,
@@ -204,7 +238,10 @@ void AddStreamlineDeepDVCStateRenderPass(FRDGBuilder& GraphBuilder, uint32 ViewI
 		// this lambda is only here since templating the function pointer and functin name and such below is inconvenient
 		[](FRHICommandListImmediate& RHICmdList, uint32 ViewID, const FIntRect& SecondaryViewRect, const sl::DeepDVCOptions& Options)
 		{
-			CALL_SL_FEATURE_FN(sl::kFeatureDeepDVC, slDeepDVCSetOptions, sl::ViewportHandle(ViewID), Options);
+			if (GDeepDVCOptionsCache.ShouldSubmit(ViewID, Options))
+			{
+				CALL_SL_FEATURE_FN(sl::kFeatureDeepDVC, slDeepDVCSetOptions, sl::ViewportHandle(ViewID), Options);
+			}
 		}
 	);
 
@@ -0,0 +1,410 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineHibernation.h"
+#include "StreamlineCore.h"
+#include "StreamlineCorePrivate.h"
+#include "StreamlineRHI.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+#include "RenderingThread.h"
+#include "RenderUtils.h"
+#include "RHI.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+#include "sl.h"
+
+static TAutoConsoleVariable<float> CVarStreamlineHibernationGracePeriod(
+	TEXT("r.Streamline.Hibernation.GracePeriod"),
+	0.0f,
+	TEXT("Seconds DLSS-FG, Latewarp and DeepDVC keep their resources after getting turned off, so turning them back on (cutscenes, menus, photo mode) doesn't cause a reallocation hitch (default = 0)\n")
+	TEXT("<0: keep them until the feature gets turned on again\n")
+	TEXT("0: no grace period, DLSS-FG releases its resources right away while Latewarp and DeepDVC keep them, as without the hibernation policy\n")
+	TEXT("Can be overridden per feature from Blueprint. r.Streamline.DLSSG.RetainResourcesWhenOff keeps DLSS-FG resources regardless\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarStreamlineHibernationMemoryPressureThreshold(
+	TEXT("r.Streamline.Hibernation.MemoryPressureThreshold"),
+	0.9f,
+	TEXT("Fraction of dedicated video memory in use above which hibernating resources get released before their grace period ends (default = 0.9)\n")
+	TEXT("0: only release early when the engine broadcasts a memory trim\n"),
+	ECVF_RenderThreadSafe);
+
+DECLARE_STATS_GROUP(TEXT("Streamline Hibernation"), STATGROUP_StreamlineHibernation, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Hitches Avoided"), STAT_StreamlineHibernationHitchesAvoided, STATGROUP_StreamlineHibernation);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Reallocations"), STAT_StreamlineHibernationReallocations, STATGROUP_StreamlineHibernation);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Grace Period Releases"), STAT_StreamlineHibernationGracePeriodReleases, STATGROUP_StreamlineHibernation);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Memory Pressure Releases"), STAT_StreamlineHibernationMemoryPressureReleases, STATGROUP_StreamlineHibernation);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Prewarms"), STAT_StreamlineHibernationPrewarms, STATGROUP_StreamlineHibernation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hibernating Views"), STAT_StreamlineHibernationHibernatingViews, STATGROUP_StreamlineHibernation);
+
+namespace
+{
+
+sl::Feature ToSLFeature(EStreamlineHibernationFeature Feature)
+{
+	switch (Feature)
+	{
+	case EStreamlineHibernationFeature::DLSSG:		return sl::kFeatureDLSS_G;
+	case EStreamlineHibernationFeature::Latewarp:	return sl::kFeatureLatewarp;
+	case EStreamlineHibernationFeature::DeepDVC:	return sl::kFeatureDeepDVC;
+	default:
+		checkNoEntry();
+		return sl::kFeatureDLSS_G;
+	}
+}
+
+const TCHAR* GetHibernationFeatureName(EStreamlineHibernationFeature Feature)
+{
+	switch (Feature)
+	{
+	case EStreamlineHibernationFeature::DLSSG:		return TEXT("DLSS-FG");
+	case EStreamlineHibernationFeature::Latewarp:	return TEXT("Latewarp");
+	case EStreamlineHibernationFeature::DeepDVC:	return TEXT("DeepDVC");
+	default:										return TEXT("Unknown");
+	}
+}
+
+bool IsVideoMemoryUnderPressure(float Threshold)
+{
+	if (Threshold <= 0.0f)
+	{
+		return false;
+	}
+
+	FTextureMemoryStats Stats;
+	RHIGetTextureMemoryStats(Stats);
+	if (!Stats.AreHardwareStatsValid() || Stats.DedicatedVideoMemory <= 0)
+	{
+		return false;
+	}
+
+#if ENGINE_MAJOR_VERSION == 4
+	const int64 UsedMemory = Stats.AllocatedMemorySize;
+#else
+	const int64 UsedMemory = Stats.StreamingMemorySize + Stats.NonStreamingMemorySize;
+#endif
+	return double(UsedMemory) > double(Stats.DedicatedVideoMemory) * Threshold;
+}
+
+// Keeps a feature's resources for a while after it got turned off and releases them once the grace period ends or memory gets tight.
+// Feature code calls Update on the render thread every frame, Blueprint and the memory trim delegate come in from the game thread
+class FStreamlineHibernationPolicy
+{
+public:
+	static FStreamlineHibernationPolicy& Get()
+	{
+		static FStreamlineHibernationPolicy Policy;
+		return Policy;
+	}
+
+	bool Update(EStreamlineHibernationFeature Feature, uint32 ViewID, bool bIsEnabled, bool bForceRetain)
+	{
+		check(IsInRenderingThread());
+		FScopeLock Lock(&Section);
+
+		TickOncePerFrame();
+
+		FFeatureData& Data = Features[uint32(Feature)];
+		FViewState& View = Data.Views.FindOrAdd(ViewID);
+
+		if (bIsEnabled)
+		{
+			if (View.State == EViewState::Hibernating)
+			{
+				++Data.Stats.HitchesAvoided;
+				INC_DWORD_STAT(STAT_StreamlineHibernationHitchesAvoided);
+			}
+			else if (View.State == EViewState::Released && View.bHadResources)
+			{
+				++Data.Stats.Reallocations;
+				INC_DWORD_STAT(STAT_StreamlineHibernationReallocations);
+			}
+			View.State = EViewState::Active;
+			View.bHadResources = true;
+			return true;
+		}
+
+		if (View.State == EViewState::Active)
+		{
+			View.State = EViewState::Hibernating;
+			View.HibernationStartTime = FPlatformTime::Seconds();
+		}
+
+		if (View.State != EViewState::Hibernating)
+		{
+			return false;
+		}
+
+		if (bForceRetain)
+		{
+			return true;
+		}
+
+		const FStreamlineHibernationSettings Settings = GetSettingsLocked(Feature);
+		// without a grace period only an explicit memory trim releases early, Latewarp and DeepDVC don't watch video memory on their own
+		const bool bIsUnderMemoryPressure = bIsMemoryTrimmed || (bIsVideoMemoryUnderPressure && Settings.GracePeriodSeconds != 0.0f);
+		if (bIsUnderMemoryPressure && Settings.bReleaseOnMemoryPressure)
+		{
+			Release(Feature, ViewID, View);
+			++Data.Stats.MemoryPressureReleases;
+			INC_DWORD_STAT(STAT_StreamlineHibernationMemoryPressureReleases);
+		}
+		else if (Settings.GracePeriodSeconds == 0.0f)
+		{
+			// no grace period opted into, so the feature does what it did without the policy: DLSS-FG lets go of its resources as soon as it's off,
+			// Latewarp and DeepDVC keep them until the view goes away
+			if (Feature == EStreamlineHibernationFeature::DLSSG)
+			{
+				Release(Feature, ViewID, View);
+			}
+		}
+		else if (Settings.GracePeriodSeconds > 0.0f && FPlatformTime::Seconds() - View.HibernationStartTime >= Settings.GracePeriodSeconds)
+		{
+			Release(Feature, ViewID, View);
+			++Data.Stats.GracePeriodReleases;
+			INC_DWORD_STAT(STAT_StreamlineHibernationGracePeriodReleases);
+		}
+
+		return View.State == EViewState::Hibernating;
+	}
+
+	void ForgetView(uint32 ViewID)
+	{
+		FScopeLock Lock(&Section);
+		for (FFeatureData& Data : Features)
+		{
+			Data.Views.Remove(ViewID);
+		}
+	}
+
+	void SetSettings(EStreamlineHibernationFeature Feature, const TOptional<FStreamlineHibernationSettings>& Settings)
+	{
+		FScopeLock Lock(&Section);
+		Features[uint32(Feature)].SettingsOverride = Settings;
+	}
+
+	FStreamlineHibernationSettings GetSettings(EStreamlineHibernationFeature Feature) const
+	{
+		FScopeLock Lock(&Section);
+		return GetSettingsLocked(Feature);
+	}
+
+	FStreamlineHibernationStats GetStats(EStreamlineHibernationFeature Feature) const
+	{
+		FScopeLock Lock(&Section);
+		const FFeatureData& Data = Features[uint32(Feature)];
+
+		FStreamlineHibernationStats Stats = Data.Stats;
+		for (const TPair<uint32, FViewState>& View : Data.Views)
+		{
+			Stats.NumHibernatingViews += View.Value.State == EViewState::Hibernating ? 1 : 0;
+		}
+		return Stats;
+	}
+
+	void RequestPrewarm(EStreamlineHibernationFeature Feature)
+	{
+		FScopeLock Lock(&Section);
+		Features[uint32(Feature)].bPrewarmRequested = true;
+	}
+
+	void RequestMemoryTrim()
+	{
+		FScopeLock Lock(&Section);
+		bMemoryTrimRequested = true;
+	}
+
+private:
+	enum class EViewState : uint8
+	{
+		Active,
+		Hibernating,
+		Released
+	};
+
+	struct FViewState
+	{
+		EViewState State = EViewState::Released;
+		double HibernationStartTime = 0.0;
+		// distinguishes the first allocation from a reallocation after a release
+		bool bHadResources = false;
+	};
+
+	struct FFeatureData
+	{
+		TMap<uint32, FViewState> Views;
+		TOptional<FStreamlineHibernationSettings> SettingsOverride;
+		FStreamlineHibernationStats Stats;
+		bool bPrewarmRequested = false;
+	};
+
+	FStreamlineHibernationSettings GetSettingsLocked(EStreamlineHibernationFeature Feature) const
+	{
+		const FFeatureData& Data = Features[uint32(Feature)];
+		if (Data.SettingsOverride.IsSet())
+		{
+			return Data.SettingsOverride.GetValue();
+		}
+
+		FStreamlineHibernationSettings Settings;
+		Settings.GracePeriodSeconds = CVarStreamlineHibernationGracePeriod.GetValueOnAnyThread();
+		Settings.bReleaseOnMemoryPressure = true;
+		return Settings;
+	}
+
+	void TickOncePerFrame()
+	{
+		if (LastTickFrame == GFrameCounterRenderThread)
+		{
+			return;
+		}
+		LastTickFrame = GFrameCounterRenderThread;
+
+		bIsMemoryTrimmed = bMemoryTrimRequested;
+		bIsVideoMemoryUnderPressure = IsVideoMemoryUnderPressure(CVarStreamlineHibernationMemoryPressureThreshold.GetValueOnRenderThread());
+		bMemoryTrimRequested = false;
+
+		int32 NumHibernatingViews = 0;
+		for (uint32 FeatureIndex = 0; FeatureIndex < uint32(EStreamlineHibernationFeature::Num); ++FeatureIndex)
+		{
+			FFeatureData& Data = Features[FeatureIndex];
+			if (Data.bPrewarmRequested)
+			{
+				Prewarm(EStreamlineHibernationFeature(FeatureIndex));
+				Data.bPrewarmRequested = false;
+			}
+
+			for (const TPair<uint32, FViewState>& View : Data.Views)
+			{
+				NumHibernatingViews += View.Value.State == EViewState::Hibernating ? 1 : 0;
+			}
+		}
+		SET_DWORD_STAT(STAT_StreamlineHibernationHibernatingViews, NumHibernatingViews);
+	}
+
+	void Release(EStreamlineHibernationFeature Feature, uint32 ViewID, FViewState& View)
+	{
+		UE_LOG(LogStreamline, Verbose, TEXT("Releasing hibernating %s resources for view %u after %.1f s"), GetHibernationFeatureName(Feature), ViewID, FPlatformTime::Seconds() - View.HibernationStartTime);
+		View.State = EViewState::Released;
+
+		// DLSS-FG releases its own resources once Update stops returning true and the feature drops sl::DLSSGFlags::eRetainResourcesWhenOff
+		if (Feature == EStreamlineHibernationFeature::DLSSG)
+		{
+			return;
+		}
+
+		const sl::Feature SLFeature = ToSLFeature(Feature);
+		FRHICommandListExecutor::GetImmediateCommandList().EnqueueLambda([SLFeature, ViewID](FRHICommandList& Cmd)
+		{
+			FStreamlineCoreModule::GetStreamlineRHI()->ReleaseStreamlineResources(SLFeature, ViewID);
+		});
+	}
+
+	void Prewarm(EStreamlineHibernationFeature Feature)
+	{
+		FFeatureData& Data = Features[uint32(Feature)];
+		const sl::Feature SLFeature = ToSLFeature(Feature);
+
+		for (TPair<uint32, FViewState>& View : Data.Views)
+		{
+			if (View.Value.State == EViewState::Active)
+			{
+				continue;
+			}
+
+			if (View.Value.State == EViewState::Released && View.Value.bHadResources)
+			{
+				const uint32 ViewID = View.Key;
+				FRHICommandListExecutor::GetImmediateCommandList().EnqueueLambda([SLFeature, ViewID](FRHICommandList& Cmd)
+				{
+					FStreamlineCoreModule::GetStreamlineRHI()->AllocateStreamlineResources(Cmd, SLFeature, ViewID, GBlackTexture->TextureRHI);
+				});
+				++Data.Stats.Prewarms;
+				INC_DWORD_STAT(STAT_StreamlineHibernationPrewarms);
+			}
+
+			// a hibernating view just gets its grace period restarted
+			if (View.Value.bHadResources)
+			{
+				View.Value.State = EViewState::Hibernating;
+				View.Value.HibernationStartTime = FPlatformTime::Seconds();
+			}
+		}
+	}
+
+	mutable FCriticalSection Section;
+	FFeatureData Features[uint32(EStreamlineHibernationFeature::Num)];
+	uint64 LastTickFrame = 0;
+	bool bIsMemoryTrimmed = false;
+	bool bIsVideoMemoryUnderPressure = false;
+	bool bMemoryTrimRequested = false;
+};
+
+FDelegateHandle MemoryTrimDelegateHandle;
+
+} // namespace
+
+void RegisterStreamlineHibernationHooks()
+{
+	MemoryTrimDelegateHandle = FCoreDelegates::GetMemoryTrimDelegate().AddLambda([]()
+	{
+		FStreamlineHibernationPolicy::Get().RequestMemoryTrim();
+	});
+}
+
+void UnregisterStreamlineHibernationHooks()
+{
+	FCoreDelegates::GetMemoryTrimDelegate().Remove(MemoryTrimDelegateHandle);
+	MemoryTrimDelegateHandle.Reset();
+}
+
+bool UpdateStreamlineHibernation(EStreamlineHibernationFeature Feature, uint32 ViewID, bool bIsEnabled, bool bForceRetain)
+{
+	return FStreamlineHibernationPolicy::Get().Update(Feature, ViewID, bIsEnabled, bForceRetain);
+}
+
+void ForgetStreamlineHibernationView(uint32 ViewID)
+{
+	FStreamlineHibernationPolicy::Get().ForgetView(ViewID);
+}
+
+void RequestStreamlineHibernationMemoryTrim()
+{
+	FStreamlineHibernationPolicy::Get().RequestMemoryTrim();
+}
+
+STREAMLINECORE_API void SetStreamlineHibernationSettings(EStreamlineHibernationFeature Feature, const FStreamlineHibernationSettings& Settings)
+{
+	FStreamlineHibernationPolicy::Get().SetSettings(Feature, Settings);
+}
+
+STREAMLINECORE_API void ResetStreamlineHibernationSettings(EStreamlineHibernationFeature Feature)
+{
+	FStreamlineHibernationPolicy::Get().SetSettings(Feature, TOptional<FStreamlineHibernationSettings>());
+}
+
+STREAMLINECORE_API FStreamlineHibernationSettings GetStreamlineHibernationSettings(EStreamlineHibernationFeature Feature)
+{
+	return FStreamlineHibernationPolicy::Get().GetSettings(Feature);
+}
+
+STREAMLINECORE_API FStreamlineHibernationStats GetStreamlineHibernationStats(EStreamlineHibernationFeature Feature)
+{
+	return FStreamlineHibernationPolicy::Get().GetStats(Feature);
+}
+
+STREAMLINECORE_API void PrewarmStreamlineHibernatingFeature(EStreamlineHibernationFeature Feature)
+{
+	FStreamlineHibernationPolicy::Get().RequestPrewarm(Feature);
+}
@@ -12,10 +12,16 @@
 #include "StreamlineLatewarp.h"
 #include "StreamlineCore.h"
 #include "StreamlineCorePrivate.h"
+#include "StreamlineStartupProbes.h"
 #include "StreamlineShaders.h"
 #include "StreamlineViewExtension.h"
 #include "StreamlineAPI.h"
 #include "StreamlineRHI.h"
+#include "StreamlineTrace.h"
+#include "StreamlineHibernation.h"
+#include "StreamlineOptionsCache.h"
+#include "StreamlinePresentWindowCache.h"
+#include "StreamlineUICoverage.h"
 
 #include "UIHintExtractionPass.h"
 #include "CoreMinimal.h"
@@ -44,27 +50,6 @@ DEFINE_LOG_CATEGORY_STATIC(LogStreamlineLatewarp, Log, All);
 DECLARE_GPU_STAT(Latewarp);
 
 
-static FIntRect LatewarpGetViewportRect(SWindow& InWindow)
-{
-	// During app shutdown, the window might not have a viewport anymore, so using SWindow::GetViewportSize() that handles that transparently.
-	FIntRect ViewportRect = FIntRect(FIntPoint::ZeroValue,InWindow.GetViewportSize().IntPoint());
-	
-	if (TSharedPtr<ISlateViewport> Viewport = InWindow.GetViewport())
-	{
-		if (TSharedPtr<SWidget> Widget = Viewport->GetWidget().Pin())
-		{
-			FGeometry Geom = Widget->GetPaintSpaceGeometry();
-
-			FIntPoint Min = { int32(Geom.GetAbsolutePosition().X),int32(Geom.GetAbsolutePosition().Y) };
-			FIntPoint Max = { int32((Geom.GetAbsolutePosition() + Geom.GetAbsoluteSize()).X),
-								int32((Geom.GetAbsolutePosition() + Geom.GetAbsoluteSize()).Y) };
-
-			ViewportRect = FIntRect(Min.X, Min.Y, Max.X, Max.Y);
-		}
-	}
-
-	return ViewportRect;
-}
 #if	((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))
 static void LatewarpOnBackBufferReadyToPresent(SWindow& InWindow, const FTextureRHIRef& InBackBuffer)
 #else
@@ -73,17 +58,14 @@ static void LatewarpOnBackBufferReadyToPresent(SWindow& InWindow, const FTexture
 {
 	check(IsInRenderingThread());
 
-	const bool bIsGameWindow = InWindow.GetType() == EWindowType::GameWindow;
-#if WITH_EDITOR
-	const bool bIsPIEWindow = GIsEditor && (InWindow.GetTitle().ToString().Contains(TEXT("Preview [NetMode:")));
-#else
-	const bool bIsPIEWindow = false;
-#endif
-	if (!(bIsGameWindow || bIsPIEWindow))
+	const FStreamlinePresentWindowState& WindowState = GetStreamlinePresentWindowState(InWindow, InBackBuffer->GetTexture2D());
+	if (!WindowState.bIsPresentTarget)
 	{
 		return;
 	}
 
+	TRACE_STREAMLINE_PRESENT_SCOPE(sl::kFeatureLatewarp, GFrameCounterRenderThread);
+
 	// TODO maybe add a helper function to add the RDG pass to tag a resource and use that everywhere
 	FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
 	FRDGBuilder GraphBuilder(RHICmdList);
@@ -126,7 +108,8 @@ static void LatewarpOnBackBufferReadyToPresent(SWindow& InWindow, const FTexture
 			++ViewRectIndex;
 		}
 	}
-	const FIntRect WindowClientAreaRect = LatewarpGetViewportRect(InWindow);
+	const FIntRect WindowClientAreaRect = WindowState.ViewportRect;
+	AddStreamlineUICoverageDetectionPasses(GraphBuilder, InBackBuffer, WindowClientAreaRect);
 	AddStreamlineUIHintTagPass(GraphBuilder, true, true, BackBufferDimension, PassParameters, 0, RHIExtensions, ViewsInThisBackBuffer, WindowClientAreaRect, true);
 }
 
@@ -210,7 +193,7 @@ STREAMLINECORE_API Streamline::EStreamlineFeatureSupport QueryStreamlineLatewarp
 			if (StreamlineRHI->IsLatewarpSupportedByRHI())
 			{
 				const sl::Feature Feature = sl::kFeatureLatewarp;
-				sl::Result SupportedResult = SLisFeatureSupported(Feature, *StreamlineRHI->GetAdapterInfo());
+				sl::Result SupportedResult = GetStreamlineFeatureProbeResult(Feature);
 				LogStreamlineFeatureSupport(Feature, *StreamlineRHI->GetAdapterInfo());
 
 				GStreamlineLatewarpSupport = TranslateStreamlineResult(SupportedResult);
@@ -277,6 +260,16 @@ bool IsLatewarpActive()
 #endif
 }
 
+static bool AreLatewarpOptionsEquivalent(const sl::LatewarpOptions& Opt1, const sl::LatewarpOptions& Opt2)
+{
+	return (Opt1.latewarpActive == Opt2.latewarpActive)
+		&& (Opt1.onErrorCallback == Opt2.onErrorCallback);
+}
+
+#if WITH_LATEWARP
+static TStreamlineOptionsCache<sl::LatewarpOptions> GLatewarpOptionsCache(TEXT("Latewarp"), &AreLatewarpOptionsEquivalent);
+#endif
+
 void AddStreamlineLatewarpStateRenderPass(FRDGBuilder& GraphBuilder, uint32 ViewID, const FIntRect& SecondaryViewRect)
 {
 #if WITH_LATEWARP
@@ -306,14 +299,20 @@ void AddStreamlineLatewarpStateRenderPass(FRDGBuilder& GraphBuilder, uint32 View
 
 			// TODO hook up to cvar 
 			// 
-			SLConstants.latewarpActive = (true ||  bIsForeground && bIsLargeEnough) ? IsLatewarpActive() : false;
+			SLConstants.latewarpActive = (true ||  bIsForeground && bIsLargeEnough) ? IsLatewarpActive() && !IsStreamlineUICoverageSuspendingFrameGeneration() : false;
+
+			// Latewarp has no flag to keep its resources while inactive, so they stay around until the hibernation policy frees them
+			UpdateStreamlineHibernation(EStreamlineHibernationFeature::Latewarp, ViewID, SLConstants.latewarpActive);
 		
 			return SLConstants;
 		},
 		// this lambda is only here since templating the function pointer and functin name and such below is inconvenient
 		[](FRHICommandListImmediate& RHICmdList, uint32 ViewID, const FIntRect& SecondaryViewRect, const sl::LatewarpOptions& Options)
 		{
-			CALL_SL_FEATURE_FN(sl::kFeatureLatewarp, slLatewarpSetOptions, sl::ViewportHandle(ViewID), Options);
+			if (GLatewarpOptionsCache.ShouldSubmit(ViewID, Options))
+			{
+				CALL_SL_FEATURE_FN(sl::kFeatureLatewarp, slLatewarpSetOptions, sl::ViewportHandle(ViewID), Options);
+			}
 		}
 	);
 #else
@@ -0,0 +1,95 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineMemoryReporter.h"
+#include "StreamlineDeepDVC.h"
+#include "StreamlineDLSSG.h"
+#include "StreamlineHibernation.h"
+
+#include "Features/IModularFeatures.h"
+#include "NVRenderingFeatureMemory.h"
+
+namespace
+{
+
+class FStreamlineMemoryReporter final : public INVRenderingFeatureMemoryReporter
+{
+public:
+	virtual void GetFootprints(TArray<FNVRenderingFeatureFootprint>& OutFootprints) const override
+	{
+		if (IsStreamlineDLSSGSupported())
+		{
+			FNVRenderingFeatureFootprint& Footprint = OutFootprints.AddDefaulted_GetRef();
+			Footprint.Feature = DLSSGName;
+			Footprint.Bytes = GetStreamlineDLSSGVRAMEstimateBytes();
+			// without the (currently unreliable) Streamline VRAM estimate DLSS-FG isn't budgeted, so it's only listed and never reduced to make room for others
+			const bool bBudgeted = IsStreamlineDLSSGVRAMEstimateEnabled();
+			Footprint.Reduction = (bBudgeted && CanReduceStreamlineDLSSGFramesToGenerateForBudget()) ? ENVRenderingFeatureMemoryReduction::ReduceQuality : ENVRenderingFeatureMemoryReduction::None;
+		}
+
+		if (IsStreamlineDeepDVCSupported())
+		{
+			FNVRenderingFeatureFootprint& Footprint = OutFootprints.AddDefaulted_GetRef();
+			Footprint.Feature = DeepDVCName;
+			Footprint.Bytes = GetStreamlineDeepDVCVRAMEstimateBytes();
+			Footprint.Reduction = IsDeepDVCActive() ? ENVRenderingFeatureMemoryReduction::Disable : ENVRenderingFeatureMemoryReduction::None;
+		}
+	}
+
+	virtual bool ReduceFootprint(FName Feature, ENVRenderingFeatureMemoryReduction Reduction) override
+	{
+		if (Feature == DLSSGName && Reduction == ENVRenderingFeatureMemoryReduction::ReduceQuality)
+		{
+			return ReduceStreamlineDLSSGFramesToGenerateForBudget();
+		}
+
+		if (Feature == DeepDVCName && Reduction == ENVRenderingFeatureMemoryReduction::Disable && IsDeepDVCActive())
+		{
+			SetStreamlineDeepDVCSuspendedByBudget(true);
+			// otherwise the hibernation policy would hold on to the DeepDVC resources for its grace period
+			RequestStreamlineHibernationMemoryTrim();
+			return true;
+		}
+
+		return false;
+	}
+
+	virtual void RestoreFootprint(FName Feature, ENVRenderingFeatureMemoryReduction Reduction) override
+	{
+		if (Feature == DLSSGName)
+		{
+			RestoreStreamlineDLSSGFramesToGenerateForBudget();
+		}
+		else if (Feature == DeepDVCName)
+		{
+			SetStreamlineDeepDVCSuspendedByBudget(false);
+		}
+	}
+
+private:
+	const FName DLSSGName = FName(TEXT("DLSS-FG"));
+	const FName DeepDVCName = FName(TEXT("DeepDVC"));
+};
+
+FStreamlineMemoryReporter GStreamlineMemoryReporter;
+
+} // namespace
+
+void RegisterStreamlineMemoryReporter()
+{
+	IModularFeatures::Get().RegisterModularFeature(INVRenderingFeatureMemoryReporter::GetModularFeatureName(), &GStreamlineMemoryReporter);
+}
+
+void UnregisterStreamlineMemoryReporter()
+{
+	IModularFeatures::Get().UnregisterModularFeature(INVRenderingFeatureMemoryReporter::GetModularFeatureName(), &GStreamlineMemoryReporter);
+	SetStreamlineDeepDVCSuspendedByBudget(false);
+}
@@ -0,0 +1,15 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+// reports the DLSS-FG and DeepDVC video memory to the VRAM budget manager in StreamlineRHI
+void RegisterStreamlineMemoryReporter();
+void UnregisterStreamlineMemoryReporter();
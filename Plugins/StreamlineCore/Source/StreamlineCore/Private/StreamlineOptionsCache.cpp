@@ -0,0 +1,94 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineOptionsCache.h"
+#include "StreamlineCorePrivate.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("Streamline SetOptions"), STATGROUP_StreamlineSetOptions, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("SetOptions calls forwarded"), STAT_StreamlineSetOptionsForwarded, STATGROUP_StreamlineSetOptions);
+DECLARE_DWORD_COUNTER_STAT(TEXT("SetOptions calls elided"), STAT_StreamlineSetOptionsElided, STATGROUP_StreamlineSetOptions);
+
+// the caches register at module load and unregister at unload, but ForEach runs on the RHI thread (ForgetStreamlineOptionsCacheView) and the game thread (r.Streamline.LogSetOptionsStats)
+static FCriticalSection& GetStreamlineOptionsCachesLock()
+{
+	static FCriticalSection CriticalSection;
+	return CriticalSection;
+}
+
+static TArray<FStreamlineOptionsCacheBase*>& GetStreamlineOptionsCaches()
+{
+	static TArray<FStreamlineOptionsCacheBase*> Caches;
+	return Caches;
+}
+
+FStreamlineOptionsCacheBase::FStreamlineOptionsCacheBase(const TCHAR* InFeatureName, EStreamlineOptionsCacheScope InScope)
+	: FeatureName(InFeatureName)
+	, Scope(InScope)
+{
+	FScopeLock Lock(&GetStreamlineOptionsCachesLock());
+	GetStreamlineOptionsCaches().Add(this);
+}
+
+FStreamlineOptionsCacheBase::~FStreamlineOptionsCacheBase()
+{
+	FScopeLock Lock(&GetStreamlineOptionsCachesLock());
+	GetStreamlineOptionsCaches().RemoveSingleSwap(this);
+}
+
+void FStreamlineOptionsCacheBase::ForEach(TFunctionRef<void(FStreamlineOptionsCacheBase&)> Callback)
+{
+	FScopeLock Lock(&GetStreamlineOptionsCachesLock());
+	for (FStreamlineOptionsCacheBase* Cache : GetStreamlineOptionsCaches())
+	{
+		Callback(*Cache);
+	}
+}
+
+void FStreamlineOptionsCacheBase::RecordCall(bool bElided)
+{
+	if (bElided)
+	{
+		++NumElided;
+		INC_DWORD_STAT(STAT_StreamlineSetOptionsElided);
+	}
+	else
+	{
+		++NumForwarded;
+		INC_DWORD_STAT(STAT_StreamlineSetOptionsForwarded);
+	}
+}
+
+void ForgetStreamlineOptionsCacheView(uint32 ViewID)
+{
+	FStreamlineOptionsCacheBase::ForEach([ViewID](FStreamlineOptionsCacheBase& Cache)
+	{
+		if (Cache.GetScope() == EStreamlineOptionsCacheScope::PerView)
+		{
+			Cache.ForgetView(ViewID);
+		}
+	});
+}
+
+static FAutoConsoleCommand CCmdStreamlineLogSetOptionsStats(
+	TEXT("r.Streamline.LogSetOptionsStats"),
+	TEXT("Logs per feature how many sl{Feature}SetOptions calls got forwarded to Streamline and how many got elided since they didn't change anything, see r.Streamline.FilterRedundantSetOptionsCalls"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FStreamlineOptionsCacheBase::ForEach([](FStreamlineOptionsCacheBase& Cache)
+		{
+			const uint64 NumCalls = Cache.GetNumForwarded() + Cache.GetNumElided();
+			UE_LOG(LogStreamline, Log, TEXT("%s SetOptions: %llu forwarded, %llu elided (%.1f%%)"), Cache.GetFeatureName(),
+				Cache.GetNumForwarded(), Cache.GetNumElided(), NumCalls > 0 ? 100.0 * Cache.GetNumElided() / NumCalls : 0.0);
+		});
+	}));
@@ -0,0 +1,101 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StreamlineRHI.h"
+
+#include <atomic>
+
+enum class EStreamlineOptionsCacheScope : uint8
+{
+	// options are set per view, the cached ones of a view get dropped when it stops rendering
+	PerView,
+	// options aren't per view (e.g. Reflex), ForgetStreamlineOptionsCacheView leaves them alone
+	Global,
+};
+
+// Counts the sl{Feature}SetOptions calls a cache let through versus the ones it elided. Each instance registers itself so
+// r.Streamline.LogSetOptionsStats can report all features and ForgetStreamlineOptionsCacheView can reach the per view ones.
+// The instances are file statics of the features, so they register when the module gets loaded, before any thread uses them
+class FStreamlineOptionsCacheBase
+{
+public:
+	FStreamlineOptionsCacheBase(const TCHAR* InFeatureName, EStreamlineOptionsCacheScope InScope);
+	virtual ~FStreamlineOptionsCacheBase();
+
+	const TCHAR* GetFeatureName() const { return FeatureName; }
+	EStreamlineOptionsCacheScope GetScope() const { return Scope; }
+	uint64 GetNumForwarded() const { return NumForwarded; }
+	uint64 GetNumElided() const { return NumElided; }
+
+	static void ForEach(TFunctionRef<void(FStreamlineOptionsCacheBase&)> Callback);
+
+	virtual void ForgetView(uint32 ViewID) = 0;
+
+protected:
+	void RecordCall(bool bElided);
+
+private:
+	const TCHAR* FeatureName;
+	const EStreamlineOptionsCacheScope Scope;
+	std::atomic<uint64> NumForwarded = 0;
+	std::atomic<uint64> NumElided = 0;
+};
+
+// Remembers the options struct last handed to Streamline per view, so the per frame sl{Feature}SetOptions calls (and their logging) can be skipped
+// when nothing changed. SL structs have padding and chaining pointers, so equality is a feature specific comparison over the meaningful fields.
+// Options get set from the thread of the feature while stale views get forgotten on the RHI thread, so the cached options are guarded by a lock
+template<typename OptionsType>
+class TStreamlineOptionsCache : public FStreamlineOptionsCacheBase
+{
+public:
+	typedef bool (*FAreEquivalentFn)(const OptionsType&, const OptionsType&);
+
+	TStreamlineOptionsCache(const TCHAR* InFeatureName, FAreEquivalentFn InAreEquivalent, EStreamlineOptionsCacheScope InScope = EStreamlineOptionsCacheScope::PerView)
+		: FStreamlineOptionsCacheBase(InFeatureName, InScope)
+		, AreEquivalent(InAreEquivalent)
+	{
+	}
+
+	// returns whether the caller needs to pass Options to Streamline, and if so remembers them as the last submitted ones
+	bool ShouldSubmit(uint32 ViewID, const OptionsType& Options)
+	{
+		bool bElided = false;
+		{
+			FScopeLock Lock(&CriticalSection);
+			OptionsType* LastOptions = LastSubmittedOptions.Find(ViewID);
+			bElided = LastOptions && StreamlineFilterRedundantSetOptionsCalls() && AreEquivalent(*LastOptions, Options);
+
+			if (!bElided)
+			{
+				LastSubmittedOptions.Add(ViewID, Options);
+			}
+		}
+
+		RecordCall(bElided);
+		return !bElided;
+	}
+
+	virtual void ForgetView(uint32 ViewID) override final
+	{
+		FScopeLock Lock(&CriticalSection);
+		LastSubmittedOptions.Remove(ViewID);
+	}
+
+private:
+	FAreEquivalentFn AreEquivalent;
+	FCriticalSection CriticalSection;
+	TMap<uint32, OptionsType> LastSubmittedOptions;
+};
+
+// RHI thread, drops the cached options of views that stopped rendering from the per view caches
+void ForgetStreamlineOptionsCacheView(uint32 ViewID);
@@ -0,0 +1,338 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlinePresentWindowCache.h"
+#include "StreamlineCorePrivate.h"
+#include "StreamlineViewExtension.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "RenderingThread.h"
+#include "RenderResource.h"
+#include "RenderUtils.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Widgets/SWindow.h"
+
+static TAutoConsoleVariable<bool> CVarStreamlinePresentWindowCache(
+	TEXT("r.Streamline.PresentWindowCache"),
+	true,
+	TEXT("Cache the per window state (PIE window check, viewport rect, render target) the DLSS-FG and Latewarp present callbacks need, instead of recomputing it on every present (default = true)\n"),
+	ECVF_RenderThreadSafe);
+
+// TODO template shenanigans to infer from TSharedPtr mode, to allow modifed UE4 with threadsafe shared pointers work automatically
+constexpr bool AreSlateSharedPointersThreadSafe()
+{
+#if ENGINE_MAJOR_VERSION == 4
+	return false;
+#else
+	return true;
+#endif
+}
+
+static FIntRect ComputeViewportRect(SWindow& InWindow)
+{
+	// During app shutdown, the window might not have a viewport anymore, so using SWindow::GetViewportSize() that handles that transparently.
+	FIntRect ViewportRect = FIntRect(FIntPoint::ZeroValue, InWindow.GetViewportSize().IntPoint());
+
+	if (AreSlateSharedPointersThreadSafe())
+	{
+		if (TSharedPtr<ISlateViewport> Viewport = InWindow.GetViewport())
+		{
+			if (TSharedPtr<SWidget> Widget = Viewport->GetWidget().Pin())
+			{
+				FGeometry Geom = Widget->GetPaintSpaceGeometry();
+
+				FIntPoint Min = { int32(Geom.GetAbsolutePosition().X),int32(Geom.GetAbsolutePosition().Y) };
+				FIntPoint Max = { int32((Geom.GetAbsolutePosition() + Geom.GetAbsoluteSize()).X),
+									int32((Geom.GetAbsolutePosition() + Geom.GetAbsoluteSize()).Y) };
+
+				ViewportRect = FIntRect(Min.X, Min.Y, Max.X, Max.Y);
+			}
+		}
+	}
+	else
+	{
+		// this is off by a bit in UE5 due to additional borders and editor UI scaling that's not present in UE4
+		// but we expect to run this only in UE4, if at all
+		const FSlateRect ClientRectInScreen = InWindow.GetClientRectInScreen();
+		const FSlateRect ClientRectInWindow = ClientRectInScreen.OffsetBy(-InWindow.GetPositionInScreen());
+
+		const FIntRect RectFromWindow = FIntRect(ClientRectInWindow.Left, ClientRectInWindow.Top, ClientRectInWindow.Right, ClientRectInWindow.Bottom);
+		ViewportRect = RectFromWindow;
+	}
+
+	return ViewportRect;
+}
+
+static void ComputePresentWindowState(SWindow& InWindow, FRHITexture* InBackBuffer, FStreamlinePresentWindowState& OutState)
+{
+	const bool bIsGameWindow = InWindow.GetType() == EWindowType::GameWindow;
+#if WITH_EDITOR
+	const bool bIsPIEWindow = GIsEditor && (InWindow.GetTitle().ToString().Contains(TEXT("Preview [NetMode:")));
+#else
+	const bool bIsPIEWindow = false;
+#endif
+	OutState.bIsPresentTarget = bIsGameWindow || bIsPIEWindow;
+	OutState.RealOrBufferedBackBuffer = InBackBuffer;
+	OutState.ViewportRect = FIntRect();
+
+	if (!OutState.bIsPresentTarget)
+	{
+		return;
+	}
+
+	OutState.ViewportRect = ComputeViewportRect(InWindow);
+
+	if (AreSlateSharedPointersThreadSafe())
+	{
+		if (TSharedPtr<ISlateViewport> Viewport = InWindow.GetViewport())
+		{
+			FSceneViewport* SceneViewport = static_cast<FSceneViewport*> (Viewport.Get());
+			const FTextureRHIRef& SceneViewPortRenderTarget = SceneViewport->GetRenderTargetTexture();
+
+			if (SceneViewPortRenderTarget.IsValid())
+			{
+				OutState.RealOrBufferedBackBuffer = SceneViewPortRenderTarget->GetTexture2D();
+			}
+		}
+		else
+		{
+			check(!GIsEditor);
+		}
+	}
+	else
+	{
+		// this is not trivial/impossible to implement without getting the window/ rendertarget information from the gamethread
+		// this is OK in UE5 since by default we can talk to the gamethread from the renderthread here in a thread safe way
+		// but not in UE4
+	}
+}
+
+namespace
+{
+
+// what the state got computed from
+struct FPresentWindowKey
+{
+	// Slate has no render thread friendly notification for title changes, so comparing the title FText by identity (no string compare) stands in for that
+	FText Title;
+	FIntPoint ViewportSize = FIntPoint::ZeroValue;
+	const FRHITexture* BackBuffer = nullptr;
+	EWindowType Type = EWindowType::Normal;
+	// the viewport widget can move inside the window (e.g. editor layout changes) and get rescaled (DPI changes) without the window size changing
+	FVector2D ViewportWidgetPosition = FVector2D::ZeroVector;
+	float ViewportWidgetScale = 1.0f;
+	// the scene viewport reallocates its render target independently of the window's backbuffer
+	const FRHITexture* SceneViewportRenderTarget = nullptr;
+
+	bool operator==(const FPresentWindowKey& Other) const
+	{
+		return BackBuffer == Other.BackBuffer
+			&& Type == Other.Type
+			&& ViewportSize == Other.ViewportSize
+			&& ViewportWidgetPosition == Other.ViewportWidgetPosition
+			&& ViewportWidgetScale == Other.ViewportWidgetScale
+			&& SceneViewportRenderTarget == Other.SceneViewportRenderTarget
+			&& Title.IdenticalTo(Other.Title);
+	}
+};
+
+struct FCachedPresentWindowState
+{
+	FStreamlinePresentWindowState State;
+	FPresentWindowKey Key;
+
+	uint64 LastUsedFrame = 0;
+};
+
+// render thread only
+TMap<const SWindow*, FCachedPresentWindowState> GPresentWindowStates;
+FStreamlinePresentWindowState GUncachedPresentWindowState;
+uint64 GLastPresentWindowEvictionFrame = 0;
+
+// windows that haven't presented for this long are assumed to be gone
+constexpr uint64 PresentWindowEvictionFrames = 120;
+
+// gathers the inputs of ComputeViewportRect and ComputePresentWindowState, without the string compare and the rect math
+FPresentWindowKey GetPresentWindowKey(SWindow& InWindow, const FRHITexture* InBackBuffer)
+{
+	FPresentWindowKey Key;
+	Key.Title = InWindow.GetTitle();
+	Key.ViewportSize = InWindow.GetViewportSize().IntPoint();
+	Key.BackBuffer = InBackBuffer;
+	Key.Type = InWindow.GetType();
+
+	if (AreSlateSharedPointersThreadSafe())
+	{
+		if (TSharedPtr<ISlateViewport> Viewport = InWindow.GetViewport())
+		{
+			if (TSharedPtr<SWidget> Widget = Viewport->GetWidget().Pin())
+			{
+				const FGeometry Geom = Widget->GetPaintSpaceGeometry();
+				Key.ViewportWidgetPosition = FVector2D(Geom.GetAbsolutePosition());
+				Key.ViewportWidgetScale = Geom.Scale;
+			}
+
+			FSceneViewport* SceneViewport = static_cast<FSceneViewport*> (Viewport.Get());
+			Key.SceneViewportRenderTarget = SceneViewport->GetRenderTargetTexture().GetReference();
+		}
+	}
+
+	return Key;
+}
+
+void EvictStalePresentWindowStates()
+{
+	if (GFrameCounterRenderThread - GLastPresentWindowEvictionFrame < PresentWindowEvictionFrames)
+	{
+		return;
+	}
+	GLastPresentWindowEvictionFrame = GFrameCounterRenderThread;
+
+	for (auto It = GPresentWindowStates.CreateIterator(); It; ++It)
+	{
+		if (GFrameCounterRenderThread - It.Value().LastUsedFrame > PresentWindowEvictionFrames)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+} // namespace
+
+const FStreamlinePresentWindowState& GetStreamlinePresentWindowState(SWindow& InWindow, FRHITexture* InBackBuffer)
+{
+	check(IsInRenderingThread());
+
+	if (!CVarStreamlinePresentWindowCache.GetValueOnRenderThread())
+	{
+		GPresentWindowStates.Reset();
+		ComputePresentWindowState(InWindow, InBackBuffer, GUncachedPresentWindowState);
+		return GUncachedPresentWindowState;
+	}
+
+	EvictStalePresentWindowStates();
+
+	FPresentWindowKey Key = GetPresentWindowKey(InWindow, InBackBuffer);
+
+	FCachedPresentWindowState* Cached = GPresentWindowStates.Find(&InWindow);
+	if (!Cached || !(Cached->Key == Key))
+	{
+		if (!Cached)
+		{
+			Cached = &GPresentWindowStates.Add(&InWindow);
+		}
+
+		ComputePresentWindowState(InWindow, InBackBuffer, Cached->State);
+		Cached->Key = MoveTemp(Key);
+	}
+
+	Cached->LastUsedFrame = GFrameCounterRenderThread;
+	return Cached->State;
+}
+
+void ExtractStreamlineTrackedViewsForBackBuffer(TArray<FTrackedView>& TrackedViews, const FRHITexture* BackBuffer, TArray<FTrackedView>& OutViewsInThisBackBuffer)
+{
+	// Note: we cannot empty the array after we found the views for the current backbufffer since we get multiple present callbacks in case when we have multiple
+	// swapchains / windows so selectively removing those only for the current backbuffer still keeps those around for the next time we get the present callback for a different swapchain.
+	// This can happen in PIE mode with multiple active PIE windows
+	int32 ViewRectIndex = 0;
+	while (ViewRectIndex < TrackedViews.Num())
+	{
+		if (TrackedViews[ViewRectIndex].Texture->GetTexture2D() == BackBuffer)
+		{
+			OutViewsInThisBackBuffer.Add(TrackedViews[ViewRectIndex]);
+			TrackedViews.RemoveAtSwap(ViewRectIndex);
+		}
+		else
+		{
+			++ViewRectIndex;
+		}
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+// Times the CPU side of a present callback (window state plus view lookup) with and without the cache, using synthetic tracked views
+// so the real ones don't get consumed. Half of the synthetic views belong to another backbuffer, like with multiple PIE windows
+static void BenchmarkStreamlinePresentPath(const TArray<FString>& Args)
+{
+	const int32 NumIterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+
+	TSharedPtr<SWindow> Window = FSlateApplication::IsInitialized() ? FSlateApplication::Get().GetActiveTopLevelWindow() : nullptr;
+	if (!Window.IsValid())
+	{
+		UE_LOG(LogStreamline, Warning, TEXT("r.Streamline.BenchmarkPresentPath needs an active window"));
+		return;
+	}
+
+	SWindow* WindowPtr = Window.Get();
+	ENQUEUE_RENDER_COMMAND(BenchmarkStreamlinePresentPath)(
+		[WindowPtr, NumIterations](FRHICommandListImmediate& RHICmdList)
+	{
+		FRHITexture* BackBuffer = GBlackTexture->TextureRHI;
+		FRHITexture* OtherBackBuffer = GWhiteTexture->TextureRHI;
+
+		for (const int32 NumViews : { 1, 4, 16 })
+		{
+			TArray<FTrackedView> SyntheticViews;
+			for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+			{
+				FTrackedView& View = SyntheticViews.AddDefaulted_GetRef();
+				View.Texture = (ViewIndex % 2 == 0) ? BackBuffer : OtherBackBuffer;
+				View.ViewKey = ViewIndex;
+			}
+
+			double Seconds[2] = { 0.0, 0.0 };
+			for (int32 bCached = 0; bCached < 2; ++bCached)
+			{
+				TArray<FTrackedView> TrackedViews;
+				TArray<FTrackedView> ViewsInThisBackBuffer;
+				FStreamlinePresentWindowState UncachedState;
+				int32 NumFound = 0;
+
+				const double StartTime = FPlatformTime::Seconds();
+				for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+				{
+					TrackedViews = SyntheticViews;
+					ViewsInThisBackBuffer.Reset();
+
+					const FStreamlinePresentWindowState* State = &UncachedState;
+					if (bCached)
+					{
+						State = &GetStreamlinePresentWindowState(*WindowPtr, BackBuffer);
+					}
+					else
+					{
+						ComputePresentWindowState(*WindowPtr, BackBuffer, UncachedState);
+					}
+
+					// the synthetic views don't render into the window's real render target, so match them against the synthetic backbuffer
+					ExtractStreamlineTrackedViewsForBackBuffer(TrackedViews, BackBuffer, ViewsInThisBackBuffer);
+					NumFound += State->bIsPresentTarget ? ViewsInThisBackBuffer.Num() : 0;
+				}
+				Seconds[bCached] = FPlatformTime::Seconds() - StartTime;
+				UE_LOG(LogStreamline, Verbose, TEXT("%d views found"), NumFound);
+			}
+
+			UE_LOG(LogStreamline, Log, TEXT("Present path with %2d tracked views: %.3f us uncached, %.3f us cached per present (%d iterations)"),
+				NumViews, 1.0e6 * Seconds[0] / NumIterations, 1.0e6 * Seconds[1] / NumIterations, NumIterations);
+		}
+	});
+
+	// keeps the window alive until the render thread is done with it
+	FlushRenderingCommands();
+}
+
+static FAutoConsoleCommand CCmdStreamlineBenchmarkPresentPath(
+	TEXT("r.Streamline.BenchmarkPresentPath"),
+	TEXT("Logs the CPU time of the present callback window and view lookup with 1, 4 and 16 synthetic tracked views, with and without r.Streamline.PresentWindowCache. Optional argument: number of iterations (default 10000)"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkStreamlinePresentPath));
+#endif
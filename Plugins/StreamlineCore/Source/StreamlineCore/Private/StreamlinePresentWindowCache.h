@@ -0,0 +1,36 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FRHITexture;
+class SWindow;
+struct FTrackedView;
+
+// What the present callbacks need to know about a window. This only changes when the window gets created, resized or retitled, when its viewport
+// widget moves or gets rescaled, or when the scene viewport reallocates its render target,
+// so it gets cached per SWindow instead of being recomputed on every present
+struct FStreamlinePresentWindowState
+{
+	// game windows and PIE windows get tagged, everything else (editor, tool windows) gets skipped
+	bool bIsPresentTarget = false;
+	// client area the scene gets rendered into, in backbuffer pixels. Offset from the origin in PIE windows to make space for the title bar
+	FIntRect ViewportRect;
+	// the texture the tracked views of this window render into: the backbuffer itself in game mode, an intermediate render target (BufferedRT) in the editor
+	FRHITexture* RealOrBufferedBackBuffer = nullptr;
+};
+
+// render thread. The returned reference stays valid until the next call
+const FStreamlinePresentWindowState& GetStreamlinePresentWindowState(SWindow& InWindow, FRHITexture* InBackBuffer);
+
+// render thread. Moves the tracked views rendering into BackBuffer from TrackedViews to OutViewsInThisBackBuffer
+void ExtractStreamlineTrackedViewsForBackBuffer(TArray<FTrackedView>& TrackedViews, const FRHITexture* BackBuffer, TArray<FTrackedView>& OutViewsInThisBackBuffer);
@@ -27,9 +27,12 @@
 #include "StreamlineAPI.h"
 #include "StreamlineCore.h"
 #include "StreamlineCorePrivate.h"
+#include "StreamlineStartupProbes.h"
 #include "StreamlineDLSSG.h"
 #include "StreamlineLatewarp.h"
+#include "StreamlineOptionsCache.h"
 #include "StreamlineRHI.h"
+#include "StreamlineTrace.h"
 
 static TAutoConsoleVariable<bool> CVarStreamlineUnregisterReflexPlugin(
 	TEXT("r.Streamline.UnregisterReflexPlugin"),
@@ -332,14 +335,15 @@ static bool AreReflexOptionsEquivalent(const sl::ReflexOptions& Opt1, const sl::
 		&& (Opt1.idThread == Opt2.idThread);
 }
 
+// Reflex options aren't per viewport, so everything goes into view 0, which stale views never drop
+static TStreamlineOptionsCache<sl::ReflexOptions> GReflexOptionsCache(TEXT("Reflex"), &AreReflexOptionsEquivalent, EStreamlineOptionsCacheScope::Global);
+
 static void UpdateReflexOptionsIfChanged(const sl::ReflexOptions& ReflexOptions)
 {
-	static sl::ReflexOptions LastFrameOptions{};
-	if (!(StreamlineFilterRedundantSetOptionsCalls() && AreReflexOptionsEquivalent(LastFrameOptions, ReflexOptions)))
+	if (GReflexOptionsCache.ShouldSubmit(0, ReflexOptions))
 	{
 		sl::Result Result = CALL_SL_FEATURE_FN(sl::kFeatureReflex, slReflexSetOptions, ReflexOptions);
 		checkf(Result == sl::Result::eOk, TEXT("slReflexSetOptions failed (%s)"), ANSI_TO_TCHAR(sl::getResultAsStr(Result)));
-		LastFrameOptions = ReflexOptions;
 	}
 }
 
@@ -569,6 +573,7 @@ void FStreamlineLatencyMarkers::SetCustomLatencyMarker(uint32 MarkerId, uint64 F
 	{
 		sl::PCLMarker Marker = static_cast<sl::PCLMarker>(MarkerId);
 		sl::FrameToken* FrameToken = FStreamlineCoreModule::GetStreamlineRHI()->GetFrameToken(FrameNumber);
+		TRACE_STREAMLINE_REFLEX_MARKER(FrameNumber, uint32(*FrameToken), MarkerId);
 		sl::Result Result = CALL_SL_FEATURE_FN(sl::kFeaturePCL, slPCLSetMarker, Marker, *FrameToken);
 		checkf(Result == sl::Result::eOk, TEXT("slPCLSetMarker failed MarkerId=%s (%s)"),
 			ANSI_TO_TCHAR(sl::getPCLMarkerAsStr(Marker)), ANSI_TO_TCHAR(sl::getResultAsStr(Result)));
@@ -587,6 +592,7 @@ bool FStreamlineLatencyMarkers::ProcessMessage(HWND hwnd, uint32 msg, WPARAM wPa
 		{
 			// Latency ping based on custom message
 			sl::FrameToken* FrameToken = FStreamlineCoreModule::GetStreamlineRHI()->GetFrameToken(GFrameCounter);
+			TRACE_STREAMLINE_REFLEX_MARKER(GFrameCounter, uint32(*FrameToken), uint32(sl::PCLMarker::ePCLatencyPing));
 			Result = CALL_SL_FEATURE_FN(sl::kFeaturePCL, slPCLSetMarker, sl::PCLMarker::ePCLatencyPing, *FrameToken);
 			checkf(Result == sl::Result::eOk, TEXT("slPCLSetMarker ePCLatencyPing failed (%s)"), ANSI_TO_TCHAR(sl::getResultAsStr(Result)));
 			return true;
@@ -679,7 +685,7 @@ Streamline::EStreamlineFeatureSupport QueryStreamlineReflexSupport()
 			if (StreamlineRHI->IsReflexSupportedByRHI())
 			{
 				const sl::Feature Feature = sl::kFeatureReflex;
-				sl::Result SupportedResult = SLisFeatureSupported(Feature, *StreamlineRHI->GetAdapterInfo());
+				sl::Result SupportedResult = GetStreamlineFeatureProbeResult(Feature);
 				LogStreamlineFeatureSupport(Feature, *StreamlineRHI->GetAdapterInfo());
 
 				GStreamlineReflexSupport = TranslateStreamlineResult(SupportedResult);
@@ -46,6 +46,15 @@
 
 #endif
 
+// FSceneInterface can resolve primitives by FPersistentPrimitiveIndex, which stays stable while the packed scene indices get compacted
+#ifndef STREAMLINE_HAS_PERSISTENT_PRIMITIVE_LOOKUP
+#define STREAMLINE_HAS_PERSISTENT_PRIMITIVE_LOOKUP ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))
+#endif
+
+#ifndef STREAMLINE_HAS_GLOBAL_COMPONENT_REGISTRATION_DELEGATES
+#define STREAMLINE_HAS_GLOBAL_COMPONENT_REGISTRATION_DELEGATES ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))
+#endif
+
 #include "StreamlineAPI.h"
 #include "StreamlineConversions.h"
 #include "StreamlineCore.h"
@@ -84,6 +93,26 @@ static TAutoConsoleVariable<float> CVarStreamlineReflexClipRadius(
 	TEXT("Collision radius for camera extrapolation clipping. (default = 10.f)\n"),
 	ECVF_RenderThreadSafe);
 
+static TAutoConsoleVariable<bool> CVarStreamlineReflexClipCorrectionAsync(
+	TEXT("r.Streamline.Reflex.ClipCorrection.Async"), true,
+	TEXT("Whether the clip correction sweep is issued asynchronously, using the result one frame later. (default = true)\n")
+	TEXT("Async sweeps extend a frame's displacement past the predicted camera, so continuous motion stays within the free space of the last sweep\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamlineReflexClipCorrectionMinDisplacement(
+	TEXT("r.Streamline.Reflex.ClipCorrection.MinDisplacement"), 0.5f,
+	TEXT("Predicted camera displacements shorter than this skip the clip correction sweep. (default = 0.5f)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamlineReflexClipCorrectionFreeSpaceMargin(
+	TEXT("r.Streamline.Reflex.ClipCorrection.FreeSpaceMargin"), 10.f,
+	TEXT("Extra radius added to async clip correction sweeps. A sweep without hits is reused as free space bound for later frames that stay within this margin. (default = 10.f)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarStreamlineReflexClipCorrectionMaxReuseFrames(
+	TEXT("r.Streamline.Reflex.ClipCorrection.MaxReuseFrames"), 4,
+	TEXT("Maximum age in frames of a clip correction sweep result that is reused. (default = 4)\n"),
+	ECVF_Default);
 
 static TAutoConsoleVariable<int32> CVarStreamlineReflexActorDebug(
 	TEXT("r.Streamline.Reflex.ActorDebug"), 0,
@@ -96,6 +125,87 @@ static TAutoConsoleVariable<int32> CVarStreamlineReflexPredictiveRenderingLateUp
 	TEXT("Select how the late update matrix is applied. (default = 1)\n"),
 	ECVF_RenderThreadSafe);
 
+DECLARE_STATS_GROUP(TEXT("Streamline Camera"), STATGROUP_StreamlineCamera, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Late update primitives (RT)"), STAT_StreamlineLateUpdatePrimitives, STATGROUP_StreamlineCamera);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Late update: primitive indices patched"), STAT_StreamlineLateUpdatePrimitivesPatched, STATGROUP_StreamlineCamera);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Late update: primitives removed"), STAT_StreamlineLateUpdatePrimitivesRemoved, STATGROUP_StreamlineCamera);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Late update: full scene scans"), STAT_StreamlineLateUpdateSceneScans, STATGROUP_StreamlineCamera);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Clip correction: sweeps issued"), STAT_StreamlineClipSweepsIssued, STATGROUP_StreamlineCamera);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Clip correction: sweeps skipped"), STAT_StreamlineClipSweepsSkipped, STATGROUP_StreamlineCamera);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Clip correction: sweeps reused"), STAT_StreamlineClipSweepsReused, STATGROUP_StreamlineCamera);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Clip correction: fallback clamps"), STAT_StreamlineClipSweepsClamped, STATGROUP_StreamlineCamera);
+DECLARE_CYCLE_STAT(TEXT("Late update component cache rebuild (GT)"), STAT_StreamlineLateUpdateCacheRebuild, STATGROUP_StreamlineCamera);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Late update: component cache hits"), STAT_StreamlineLateUpdateCacheHits, STATGROUP_StreamlineCamera);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Late update: component cache rebuilds"), STAT_StreamlineLateUpdateCacheRebuilds, STATGROUP_StreamlineCamera);
+
+// Bumped whenever a component of a cached hierarchy gets (un)registered, which invalidates all late update component caches.
+// Attach/detach within a cached hierarchy is caught by hashing the attach children instead.
+static uint32 GLateUpdateComponentRegistrationGeneration = 0;
+static FDelegateHandle LateUpdateComponentRegisterDelegateHandle;
+static FDelegateHandle LateUpdateComponentUnregisterDelegateHandle;
+
+// Root components of the hierarchies all camera managers have a late update component cache for, with the number of caches per root. Game thread only
+static TMap<TObjectKey<USceneComponent>, int32> GLateUpdateCachedHierarchyRoots;
+
+static void AddLateUpdateCachedHierarchyRoot(const TObjectKey<USceneComponent>& Root)
+{
+	++GLateUpdateCachedHierarchyRoots.FindOrAdd(Root);
+}
+
+static void RemoveLateUpdateCachedHierarchyRoot(const TObjectKey<USceneComponent>& Root)
+{
+	if (int32* NumCaches = GLateUpdateCachedHierarchyRoots.Find(Root))
+	{
+		if (--(*NumCaches) <= 0)
+		{
+			GLateUpdateCachedHierarchyRoots.Remove(Root);
+		}
+	}
+}
+
+static bool IsAttachedToLateUpdateCachedHierarchy(const USceneComponent* Component)
+{
+	for (; Component; Component = Component->GetAttachParent())
+	{
+		if (GLateUpdateCachedHierarchyRoots.Contains(Component))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+static void OnLateUpdateComponentRegistrationChanged(UActorComponent* Component)
+{
+	// only scene components are part of the cached hierarchies
+	const USceneComponent* SceneComponent = Cast<USceneComponent>(Component);
+	if (!SceneComponent || GLateUpdateCachedHierarchyRoots.Num() == 0)
+	{
+		return;
+	}
+
+	// components get registered before they are attached and can be unregistered after they got detached, so also go by the root of their owner
+	const AActor* Owner = SceneComponent->GetOwner();
+	if (IsAttachedToLateUpdateCachedHierarchy(SceneComponent) || (Owner && IsAttachedToLateUpdateCachedHierarchy(Owner->GetRootComponent())))
+	{
+		++GLateUpdateComponentRegistrationGeneration;
+	}
+}
+
+static void RegisterLateUpdateComponentRegistrationDelegates()
+{
+#if STREAMLINE_HAS_GLOBAL_COMPONENT_REGISTRATION_DELEGATES
+	if (!LateUpdateComponentRegisterDelegateHandle.IsValid())
+	{
+		LateUpdateComponentRegisterDelegateHandle = UActorComponent::GlobalRegisterComponentDelegate.AddStatic(&OnLateUpdateComponentRegistrationChanged);
+		LateUpdateComponentUnregisterDelegateHandle = UActorComponent::GlobalUnregisterComponentDelegate.AddStatic(&OnLateUpdateComponentRegistrationChanged);
+	}
+#else
+	// without the global delegates, fall back to rebuilding every frame
+	++GLateUpdateComponentRegistrationGeneration;
+#endif
+}
+
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 FCriticalSection GameThreadDebugMessagesCS;
 TArray<FString> GameThreadDebugMessages;
@@ -248,6 +358,29 @@ void DumpActor(const TCHAR* Stage, const AActor* Actor)
 }
 #endif 
 
+FStreamlineCameraManager::~FStreamlineCameraManager()
+{
+	for (const TPair<TObjectKey<USceneComponent>, FLateUpdateComponentCache>& Cache : LateUpdateComponentCaches)
+	{
+		RemoveLateUpdateCachedHierarchyRoot(Cache.Key);
+	}
+}
+
+void UnregisterStreamlineReflexCameraHooks()
+{
+#if STREAMLINE_HAS_GLOBAL_COMPONENT_REGISTRATION_DELEGATES
+	UActorComponent::GlobalRegisterComponentDelegate.Remove(LateUpdateComponentRegisterDelegateHandle);
+	UActorComponent::GlobalUnregisterComponentDelegate.Remove(LateUpdateComponentUnregisterDelegateHandle);
+	LateUpdateComponentRegisterDelegateHandle.Reset();
+	LateUpdateComponentUnregisterDelegateHandle.Reset();
+#endif
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	FCoreDelegates::OnGetOnScreenMessages.Remove(ReflexCameraOnScreenMessagesDelegateHandle);
+	ReflexCameraOnScreenMessagesDelegateHandle.Reset();
+#endif
+}
+
 void FStreamlineCameraManager::LateUpdate_GameThread(const APlayerController* Player, uint64 FrameID)
 {
 	check(IsInGameThread());
@@ -295,27 +428,49 @@ void FStreamlineCameraManager::LateUpdate_GameThread(const APlayerController* Pl
 	GatherLateUpdatePrimitives(FrameID, Component, LateUpdateData.CollisionParams);
 }
 
-void FStreamlineCameraManager::CacheSceneInfo(int64 FrameID, USceneComponent* Component, FCollisionQueryParams& CollisionParams)
+void FStreamlineCameraManager::CacheSceneInfo(FLateUpdateComponentCache& Cache, USceneComponent* Component)
 {
 	ensureMsgf(!Component->IsUsingAbsoluteLocation() && !Component->IsUsingAbsoluteRotation(), TEXT("SceneComponents that use absolute location or rotation are not supported by the LateUpdateManager"));
-	// If a scene proxy is present, cache it
-	UPrimitiveComponent* PrimitiveComponent = dynamic_cast<UPrimitiveComponent*>(Component);
-	if (PrimitiveComponent && PrimitiveComponent->SceneProxy)
+	Cache.SceneComponents.Add(Component);
+
+	if (UPrimitiveComponent* PrimitiveComponent = dynamic_cast<UPrimitiveComponent*>(Component))
 	{
-		CollisionParams.AddIgnoredComponent(PrimitiveComponent);
-		FPrimitiveSceneInfo* PrimitiveSceneInfo = PrimitiveComponent->SceneProxy->GetPrimitiveSceneInfo();
-		if (PrimitiveSceneInfo && PrimitiveSceneInfo->IsIndexValid())
+		Cache.PrimitiveComponents.Add(PrimitiveComponent);
+	}
+}
+
+static uint32 HashLateUpdateHierarchy(const TArray<TWeakObjectPtr<USceneComponent>>& SceneComponents, bool& bOutAllValid)
+{
+	bOutAllValid = true;
+	uint32 Hash = 0;
+	for (const TWeakObjectPtr<USceneComponent>& WeakComponent : SceneComponents)
+	{
+		const USceneComponent* Component = WeakComponent.Get();
+		if (!Component)
 		{
-			PrimitiveComponent->SetRenderCustomDepth(true);
-			PrimitiveComponent->SetCustomDepthStencilValue(1);
-			UpdateStates[FrameID % FramesInFlight].Primitives.Emplace(PrimitiveSceneInfo, PrimitiveSceneInfo->GetIndex());
+			bOutAllValid = false;
+			return 0;
 		}
+
+		for (const USceneComponent* Child : Component->GetAttachChildren())
+		{
+			Hash = HashCombine(Hash, PointerHash(Child));
+		}
+		Hash = HashCombine(Hash, ::GetTypeHash(Component->GetAttachChildren().Num()));
 	}
+	return Hash;
 }
 
-void FStreamlineCameraManager::GatherLateUpdatePrimitives(int64 FrameID, USceneComponent* ParentComponent, FCollisionQueryParams& CollisionParams)
+void FStreamlineCameraManager::RebuildLateUpdateComponentCache(FLateUpdateComponentCache& Cache, USceneComponent* ParentComponent)
 {
-	CacheSceneInfo(FrameID, ParentComponent, CollisionParams);
+	SCOPE_CYCLE_COUNTER(STAT_StreamlineLateUpdateCacheRebuild);
+	INC_DWORD_STAT(STAT_StreamlineLateUpdateCacheRebuilds);
+
+	Cache.SceneComponents.Reset();
+	Cache.PrimitiveComponents.Reset();
+	Cache.RegistrationGeneration = GLateUpdateComponentRegistrationGeneration;
+
+	CacheSceneInfo(Cache, ParentComponent);
 
 	TArray<USceneComponent*> Components;
 	ParentComponent->GetChildrenComponents(true, Components);
@@ -323,7 +478,75 @@ void FStreamlineCameraManager::GatherLateUpdatePrimitives(int64 FrameID, USceneC
 	{
 		if (Component != nullptr)
 		{
-			CacheSceneInfo(FrameID, Component, CollisionParams);
+			CacheSceneInfo(Cache, Component);
+		}
+	}
+
+	bool bAllValid = true;
+	Cache.HierarchyHash = HashLateUpdateHierarchy(Cache.SceneComponents, bAllValid);
+}
+
+void FStreamlineCameraManager::GatherLateUpdatePrimitives(int64 FrameID, USceneComponent* ParentComponent, FCollisionQueryParams& CollisionParams)
+{
+	RegisterLateUpdateComponentRegistrationDelegates();
+
+	// drop caches of camera owners that went away
+	for (auto CacheIt = LateUpdateComponentCaches.CreateIterator(); CacheIt; ++CacheIt)
+	{
+		if (!CacheIt.Key().ResolveObjectPtr())
+		{
+			RemoveLateUpdateCachedHierarchyRoot(CacheIt.Key());
+			CacheIt.RemoveCurrent();
+		}
+	}
+
+	FLateUpdateComponentCache* ExistingCache = LateUpdateComponentCaches.Find(ParentComponent);
+	if (!ExistingCache)
+	{
+		AddLateUpdateCachedHierarchyRoot(ParentComponent);
+	}
+	FLateUpdateComponentCache& Cache = ExistingCache ? *ExistingCache : LateUpdateComponentCaches.Add(ParentComponent);
+
+	bool bAllValid = Cache.RegistrationGeneration == GLateUpdateComponentRegistrationGeneration && Cache.SceneComponents.Num() > 0;
+	if (bAllValid)
+	{
+		const uint32 HierarchyHash = HashLateUpdateHierarchy(Cache.SceneComponents, bAllValid);
+		bAllValid = bAllValid && (HierarchyHash == Cache.HierarchyHash);
+	}
+
+	if (bAllValid)
+	{
+		INC_DWORD_STAT(STAT_StreamlineLateUpdateCacheHits);
+	}
+	else
+	{
+		RebuildLateUpdateComponentCache(Cache, ParentComponent);
+	}
+
+	CollisionParams.AddIgnoredComponents(Cache.PrimitiveComponents);
+
+	TStreamlineLateUpdatePrimitives<FPrimitiveSceneInfo>& Primitives = UpdateStates[FrameID % FramesInFlight].Primitives;
+	Primitives.Reserve(Cache.PrimitiveComponents.Num());
+
+	// If a scene proxy is present, cache it
+	for (const TWeakObjectPtr<UPrimitiveComponent>& WeakPrimitiveComponent : Cache.PrimitiveComponents)
+	{
+		UPrimitiveComponent* PrimitiveComponent = WeakPrimitiveComponent.Get();
+		if (PrimitiveComponent && PrimitiveComponent->SceneProxy)
+		{
+			FPrimitiveSceneInfo* PrimitiveSceneInfo = PrimitiveComponent->SceneProxy->GetPrimitiveSceneInfo();
+			if (PrimitiveSceneInfo && PrimitiveSceneInfo->IsIndexValid())
+			{
+				// those early out internally when the value doesn't change
+				PrimitiveComponent->SetRenderCustomDepth(true);
+				PrimitiveComponent->SetCustomDepthStencilValue(1);
+
+#if STREAMLINE_HAS_PERSISTENT_PRIMITIVE_LOOKUP
+				Primitives.Add(PrimitiveSceneInfo, PrimitiveSceneInfo->GetIndex(), PrimitiveSceneInfo->GetPersistentIndex().Index);
+#else
+				Primitives.Add(PrimitiveSceneInfo, PrimitiveSceneInfo->GetIndex(), INDEX_NONE);
+#endif
+			}
 		}
 	}
 }
@@ -371,6 +594,45 @@ void FStreamlineCameraManager::PreRenderViewFamily_RenderThread(FSceneViewFamily
 	}
 }
 
+// Streaming churns the packed indices of FScene most frames, FPersistentPrimitiveIndex survives the compaction
+class FStreamlineLateUpdateScene final : public TStreamlineLateUpdatePrimitives<FPrimitiveSceneInfo>::IScene
+{
+public:
+	explicit FStreamlineLateUpdateScene(FSceneInterface* InScene) : Scene(InScene) {}
+
+	virtual FPrimitiveSceneInfo* GetPrimitive(int32 Index) const override
+	{
+		return Scene->GetPrimitiveSceneInfo(Index);
+	}
+
+	virtual FPrimitiveSceneInfo* GetPrimitiveByPersistentIndex(int32 PersistentIndex) const override
+	{
+#if STREAMLINE_HAS_PERSISTENT_PRIMITIVE_LOOKUP
+		return Scene->GetPrimitiveSceneInfo(FPersistentPrimitiveIndex{ PersistentIndex });
+#else
+		return nullptr;
+#endif
+	}
+
+	virtual int32 GetIndex(FPrimitiveSceneInfo* Primitive) const override
+	{
+		return Primitive->GetIndex();
+	}
+
+	virtual bool HasPersistentIndices() const override
+	{
+		return STREAMLINE_HAS_PERSISTENT_PRIMITIVE_LOOKUP;
+	}
+
+	virtual bool HasProxy(FPrimitiveSceneInfo* Primitive) const override
+	{
+		return Primitive->Proxy != nullptr;
+	}
+
+private:
+	FSceneInterface* Scene;
+};
+
 void FStreamlineCameraManager::LateUpdate_RenderThread(FSceneInterface* Scene, uint64 FrameID, const FMatrix& LateUpdateTransform)
 {
 	check(IsInRenderingThread());
@@ -386,56 +648,28 @@ void FStreamlineCameraManager::LateUpdate_RenderThread(FSceneInterface* Scene, u
 		return;
 	}
 
-	bool bIndicesHaveChanged = false;
+	SCOPE_CYCLE_COUNTER(STAT_StreamlineLateUpdatePrimitives);
 
-	// Apply delta to the cached scene proxies
-	// Also check whether any primitive indices have changed, in case the scene has been modified in the meantime.
-	for (auto& PrimitivePair : LateUpdateData.Primitives)
-	{
-		FPrimitiveSceneInfo* RetrievedSceneInfo = Scene->GetPrimitiveSceneInfo(PrimitivePair.Value);
-		FPrimitiveSceneInfo* CachedSceneInfo = PrimitivePair.Key;
+	const bool bApplyLateUpdateTransform = CVarStreamlineReflexPredictiveRenderingLateUpdateMode.GetValueOnRenderThread() == 1;
+	const FStreamlineLateUpdateScene LateUpdateScene(Scene);
 
-		// If the retrieved scene info is different than our cached scene info then the scene has changed in the meantime
-		// and we need to search through the entire scene to make sure it still exists.
-		if (CachedSceneInfo != RetrievedSceneInfo)
+	// Apply delta to the cached scene proxies, patching the entries of primitives the scene moved in the meantime
+	const TStreamlineLateUpdatePrimitives<FPrimitiveSceneInfo>::FStats Stats = LateUpdateData.Primitives.Update(LateUpdateScene, [&](FPrimitiveSceneInfo* SceneInfo)
+	{
+#if WITH_LATE_UPDATE_MATRIX
+		if (bApplyLateUpdateTransform)
 		{
-			bIndicesHaveChanged = true;
-			break; // No need to continue here, as we are going to brute force the scene primitives below anyway.
+			// TODO: ApplyLateUpdateTransform gets overriden. Needs to be a callback from RendererScene
+			SceneInfo->Proxy->SetLateUpdateTransform(LateUpdateTransform);
 		}
-		else if (CachedSceneInfo->Proxy)
-		{
-#if WITH_LATE_UPDATE_MATRIX
-			if (CVarStreamlineReflexPredictiveRenderingLateUpdateMode.GetValueOnRenderThread() == 1)
-			{
-				// TODO: ApplyLateUpdateTransform gets overriden. Needs to be a callback from RendererScene
-				CachedSceneInfo->Proxy->SetLateUpdateTransform(LateUpdateTransform);
-			}
 #endif
-			PrimitivePair.Value = -1; // Set the cached index to -1 to indicate that this primitive was already processed
-		}
-	}
+	});
 
-	// Indices have changed, so we need to scan the entire scene for primitives that might still exist
-	if (bIndicesHaveChanged)
+	INC_DWORD_STAT_BY(STAT_StreamlineLateUpdatePrimitivesPatched, Stats.NumPatched);
+	INC_DWORD_STAT_BY(STAT_StreamlineLateUpdatePrimitivesRemoved, Stats.NumRemoved);
+	if (Stats.bSceneScanned)
 	{
-		int32 Index = 0;
-		FPrimitiveSceneInfo* RetrievedSceneInfo;
-		RetrievedSceneInfo = Scene->GetPrimitiveSceneInfo(Index++);
-		while (RetrievedSceneInfo)
-		{
-			if (RetrievedSceneInfo->Proxy && LateUpdateData.Primitives.Contains(RetrievedSceneInfo) &&
-				LateUpdateData.Primitives[RetrievedSceneInfo] >= 0)
-			{
-#if WITH_LATE_UPDATE_MATRIX
-				if (CVarStreamlineReflexPredictiveRenderingLateUpdateMode.GetValueOnRenderThread() == 1)
-				{
-					// TODO: ApplyLateUpdateTransform gets overriden. Needs to be a callback from RendererScene
-					RetrievedSceneInfo->Proxy->SetLateUpdateTransform(LateUpdateTransform);
-				}
-#endif
-			}
-			RetrievedSceneInfo = Scene->GetPrimitiveSceneInfo(Index++);
-		}
+		INC_DWORD_STAT(STAT_StreamlineLateUpdateSceneScans);
 	}
 }
 
@@ -613,19 +847,14 @@ void FStreamlineCameraManager::SetCameraData(const FSceneView& InView, uint64 Fr
 			FPlane(predictedRotationMatrix.M[2][0], predictedRotationMatrix.M[2][1], predictedRotationMatrix.M[2][2], 0),
 			FPlane(predictedPos.X, predictedPos.Y, predictedPos.Z, 1.f));
 
-		if (CVarStreamlineReflexClipCorrection.GetValueOnGameThread())
+		if (CVarStreamlineReflexClipCorrection.GetValueOnGameThread() && LateUpdateData.World)
 		{
 			const FVector CameraStart = -CurrentTranslation;
 			const FVector CameraEnd = -LateUpdateData.UpdatedWorldToView.GetOrigin();
 
-			FHitResult Hit;
-			FCollisionShape SphereShape = FCollisionShape::MakeSphere(CVarStreamlineReflexClipRadius.GetValueOnGameThread());
-
-			const bool bHit = LateUpdateData.World->SweepSingleByChannel(Hit, CameraStart, CameraEnd, FQuat::Identity, ECC_Camera, SphereShape, LateUpdateData.CollisionParams);
-			if (bHit)
-			{
-				LateUpdateData.UpdatedWorldToView.SetOrigin(-Hit.Location);
-			}
+			FStreamlineWorldClipCorrectionScene ClipCorrectionScene(LateUpdateData.World, LateUpdateData.CollisionParams);
+			const FVector CorrectedCameraEnd = ClipCorrection.Apply(ClipCorrectionScene, FStreamlineClipCorrectionSettings::FromCVars(), FrameID, CameraStart, CameraEnd);
+			LateUpdateData.UpdatedWorldToView.SetOrigin(-CorrectedCameraEnd);
 		}
 
 		if (InView.IsPerspectiveProjection())
@@ -658,6 +887,214 @@ void FStreamlineCameraManager::SetCameraData(const FSceneView& InView, uint64 Fr
 	ViewPredictionData[0] = FrameData;
 }
 
+FObjectKey FStreamlineWorldClipCorrectionScene::GetSceneKey() const
+{
+	return FObjectKey(World);
+}
+
+static void GetClipCorrectionHit(const FHitResult& HitResult, FStreamlineClipCorrectionHit& OutHit)
+{
+	OutHit.Location = HitResult.Location;
+	OutHit.ImpactPoint = HitResult.ImpactPoint;
+	OutHit.ImpactNormal = HitResult.ImpactNormal;
+}
+
+bool FStreamlineWorldClipCorrectionScene::Sweep(const FVector& Start, const FVector& End, float Radius, FStreamlineClipCorrectionHit& OutHit)
+{
+	FHitResult HitResult;
+	if (!World->SweepSingleByChannel(HitResult, Start, End, FQuat::Identity, ECC_Camera, FCollisionShape::MakeSphere(Radius), CollisionParams))
+	{
+		return false;
+	}
+
+	GetClipCorrectionHit(HitResult, OutHit);
+	return true;
+}
+
+FTraceHandle FStreamlineWorldClipCorrectionScene::AsyncSweep(const FVector& Start, const FVector& End, float Radius)
+{
+	return World->AsyncSweepByChannel(EAsyncTraceType::Single, Start, End, FQuat::Identity, ECC_Camera, FCollisionShape::MakeSphere(Radius), CollisionParams);
+}
+
+bool FStreamlineWorldClipCorrectionScene::QueryAsyncSweep(const FTraceHandle& Handle, bool& bOutHit, FStreamlineClipCorrectionHit& OutHit)
+{
+	// the async trace buffers are only valid for one frame, so anything older is lost
+	FTraceDatum TraceDatum;
+	if (!World->QueryTraceData(Handle, TraceDatum))
+	{
+		return false;
+	}
+
+	const FHitResult* FirstBlockingHit = TraceDatum.OutHits.FindByPredicate([](const FHitResult& HitResult) { return HitResult.bBlockingHit; });
+	bOutHit = FirstBlockingHit != nullptr;
+	if (FirstBlockingHit)
+	{
+		GetClipCorrectionHit(*FirstBlockingHit, OutHit);
+	}
+	return true;
+}
+
+FStreamlineClipCorrectionSettings FStreamlineClipCorrectionSettings::FromCVars()
+{
+	FStreamlineClipCorrectionSettings Settings;
+	Settings.ClipRadius = CVarStreamlineReflexClipRadius.GetValueOnGameThread();
+	Settings.bAsync = CVarStreamlineReflexClipCorrectionAsync.GetValueOnGameThread();
+	Settings.MinDisplacement = CVarStreamlineReflexClipCorrectionMinDisplacement.GetValueOnGameThread();
+	Settings.FreeSpaceMargin = FMath::Max(0.f, CVarStreamlineReflexClipCorrectionFreeSpaceMargin.GetValueOnGameThread());
+	Settings.MaxReuseFrames = FMath::Max(1, CVarStreamlineReflexClipCorrectionMaxReuseFrames.GetValueOnGameThread());
+	return Settings;
+}
+
+FVector FStreamlineClipCorrection::ClampToHitPlane(const FVector& Start, const FVector& End, float Radius, const FStreamlineClipCorrectionHit& Hit)
+{
+	const FVector Displacement = End - Start;
+	const double Approach = -FVector::DotProduct(Displacement, Hit.ImpactNormal);
+	if (Approach <= 0.0)
+	{
+		return End;
+	}
+
+	// distance the sphere center can still cover towards the plane before the sphere touches it
+	const double Clearance = FVector::DotProduct(Start - Hit.ImpactPoint, Hit.ImpactNormal) - Radius;
+	return Start + Displacement * FMath::Clamp(Clearance / Approach, 0.0, 1.0);
+}
+
+void FStreamlineClipCorrection::Reset()
+{
+	PendingSweep = FSweep();
+	LastSweep = FSweep();
+}
+
+// How far along Start to End a point stays within Margin of the segment SegmentStart to SegmentEnd, as a fraction of the displacement.
+// The distance to a segment is convex along a line, so with Start inside and End outside there's exactly one crossing to search for
+static double GetFractionWithinCapsule(const FVector& Start, const FVector& End, const FVector& SegmentStart, const FVector& SegmentEnd, float Margin)
+{
+	if (FMath::PointDistToSegment(Start, SegmentStart, SegmentEnd) > Margin)
+	{
+		return 0.0;
+	}
+	if (FMath::PointDistToSegment(End, SegmentStart, SegmentEnd) <= Margin)
+	{
+		return 1.0;
+	}
+
+	double Inside = 0.0;
+	double Outside = 1.0;
+	for (int32 Iteration = 0; Iteration < 24; ++Iteration)
+	{
+		const double Fraction = 0.5 * (Inside + Outside);
+		if (FMath::PointDistToSegment(FMath::Lerp(Start, End, Fraction), SegmentStart, SegmentEnd) <= Margin)
+		{
+			Inside = Fraction;
+		}
+		else
+		{
+			Outside = Fraction;
+		}
+	}
+	return Inside;
+}
+
+FVector FStreamlineClipCorrection::Apply(IStreamlineClipCorrectionScene& Scene, const FStreamlineClipCorrectionSettings& Settings, uint64 FrameID,
+	const FVector& CameraStart, const FVector& CameraEnd, EStreamlineClipCorrection* OutCorrection)
+{
+	check(IsInGameThread());
+
+	EStreamlineClipCorrection Correction;
+	if (!OutCorrection)
+	{
+		OutCorrection = &Correction;
+	}
+
+	const FVector Displacement = CameraEnd - CameraStart;
+
+	// The predicted camera barely moves, so it can't clip into anything the current camera doesn't already
+	if (Displacement.Size() < Settings.MinDisplacement)
+	{
+		INC_DWORD_STAT(STAT_StreamlineClipSweepsSkipped);
+		*OutCorrection = EStreamlineClipCorrection::Skipped;
+		return CameraEnd;
+	}
+
+	if (!Settings.bAsync)
+	{
+		INC_DWORD_STAT(STAT_StreamlineClipSweepsIssued);
+		Reset();
+
+		FStreamlineClipCorrectionHit Hit;
+		*OutCorrection = EStreamlineClipCorrection::Swept;
+		return Scene.Sweep(CameraStart, CameraEnd, Settings.ClipRadius, Hit) ? Hit.Location : CameraEnd;
+	}
+
+	const FObjectKey SceneKey = Scene.GetSceneKey();
+
+	// Pick up last frame's async result
+	if (PendingSweep.Handle.IsValid())
+	{
+		if (PendingSweep.SceneKey == SceneKey && Scene.QueryAsyncSweep(PendingSweep.Handle, PendingSweep.bHit, PendingSweep.Hit))
+		{
+			LastSweep = PendingSweep;
+			LastSweep.Handle = FTraceHandle();
+			LastSweep.bHasResult = true;
+		}
+		PendingSweep = FSweep();
+	}
+
+	const bool bLastSweepUsable = LastSweep.bHasResult && LastSweep.SceneKey == SceneKey &&
+		(FrameID - LastSweep.FrameID) <= uint64(FMath::Max(1, Settings.MaxReuseFrames));
+	const bool bLastSweepClear = bLastSweepUsable && !LastSweep.bHit;
+	const float Margin = LastSweep.Radius - Settings.ClipRadius;
+
+	// Sweeps go a frame's displacement past the predicted camera, so that with continuous motion next frame's segment is still
+	// contained in the free space this one finds
+	const FVector LookAheadEnd = CameraEnd + Displacement;
+
+	// The last sweep didn't hit anything with an inflated radius. If both ends of the current segment are within the inflation margin of
+	// the last segment, the current sweep is contained in that free space capsule and can't hit anything either
+	const double FractionInFreeSpace = bLastSweepClear && Margin > 0.f ?
+		GetFractionWithinCapsule(CameraStart, CameraEnd, LastSweep.Start, LastSweep.End, Margin) : 0.0;
+
+	// Issue the sweep for this frame, its result gets consumed next frame. Not needed while the free space also covers the look ahead
+	if (FractionInFreeSpace < 1.0 || FMath::PointDistToSegment(LookAheadEnd, LastSweep.Start, LastSweep.End) > Margin)
+	{
+		INC_DWORD_STAT(STAT_StreamlineClipSweepsIssued);
+		PendingSweep = FSweep();
+		PendingSweep.SceneKey = SceneKey;
+		PendingSweep.FrameID = FrameID;
+		PendingSweep.Start = CameraStart;
+		PendingSweep.End = LookAheadEnd;
+		PendingSweep.Radius = Settings.ClipRadius + FMath::Max(0.f, Settings.FreeSpaceMargin);
+		PendingSweep.Handle = Scene.AsyncSweep(CameraStart, LookAheadEnd, PendingSweep.Radius);
+	}
+
+	if (FractionInFreeSpace >= 1.0)
+	{
+		INC_DWORD_STAT(STAT_StreamlineClipSweepsReused);
+		*OutCorrection = EStreamlineClipCorrection::Reused;
+		return CameraEnd;
+	}
+
+	// Until then use the one frame latent result. The last sweep was for another segment and with an inflated radius, so its hit time
+	// doesn't apply to this one. Instead keep the clip radius away from the surface it hit
+	if (bLastSweepUsable && LastSweep.bHit)
+	{
+		*OutCorrection = EStreamlineClipCorrection::ClampedToHit;
+		return ClampToHitPlane(CameraStart, CameraEnd, Settings.ClipRadius, LastSweep.Hit);
+	}
+
+	// The segment leaves the free space the last sweep found, e.g. because the camera sped up. Move as far as that free space goes
+	if (FractionInFreeSpace * Displacement.Size() > Settings.ClipRadius)
+	{
+		*OutCorrection = EStreamlineClipCorrection::ClampedToFreeSpace;
+		return CameraStart + Displacement * FractionInFreeSpace;
+	}
+
+	// Nothing usable known about the space the camera is predicted to move into, so clamp the extrapolation to the clip radius
+	INC_DWORD_STAT(STAT_StreamlineClipSweepsClamped);
+	*OutCorrection = EStreamlineClipCorrection::ClampedToRadius;
+	return CameraStart + Displacement.GetClampedToMaxSize(Settings.ClipRadius);
+}
+
 bool DoesFeatureUseCameraData()
 {
 	return ForceTagStreamlineBuffers() || IsLatewarpActive();
@@ -0,0 +1,211 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineStartupProbes.h"
+#include "StreamlineCorePrivate.h"
+#include "StreamlineAPI.h"
+#include "StreamlineRHI.h"
+
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+
+#include "sl_helpers.h"
+
+static TAutoConsoleVariable<bool> CVarStreamlineParallelFeatureProbes(
+	TEXT("r.Streamline.ParallelFeatureProbes"),
+	true,
+	TEXT("Probe the support of the loaded Streamline features on a task graph worker during startup, instead of one after the other when first queried (default = true)\n")
+	TEXT("The probes run one after the other on a single worker, overlapping with the rest of the engine startup\n"),
+	ECVF_ReadOnly);
+
+namespace
+{
+	struct FStreamlineFeatureProbe
+	{
+		sl::Feature Feature;
+		const TCHAR* LoadCVarName;
+
+		sl::Result Result = sl::Result::eErrorNotInitialized;
+		// written by the probe task, only read on the game thread after joining it
+		bool bProbed = false;
+
+		// time spent inside slIsFeatureSupported and how long the first query blocked on it
+		double ProbeSeconds = 0.0;
+		double WaitSeconds = 0.0;
+		bool bRanOnWorker = false;
+	};
+
+	FStreamlineFeatureProbe GStreamlineFeatureProbes[] =
+	{
+		{ sl::kFeatureReflex, TEXT("r.Streamline.Load.Reflex") },
+		{ sl::kFeatureDLSS_G, TEXT("r.Streamline.Load.DLSSG") },
+		{ sl::kFeatureLatewarp, TEXT("r.Streamline.Load.Latewarp") },
+		{ sl::kFeatureDeepDVC, TEXT("r.Streamline.Load.DeepDVC") },
+	};
+
+	// Streamline doesn't document its API as thread safe, so there is only ever one probe task, probing one feature after the other.
+	// Every query joins it before calling into Streamline on the game thread, so the two never overlap
+	FGraphEventRef GStreamlineFeatureProbeTask;
+
+	double GStreamlineStartupBeginTime = 0.0;
+	double GStreamlineStartupSeconds = 0.0;
+
+	FStreamlineFeatureProbe* FindStreamlineFeatureProbe(sl::Feature Feature)
+	{
+		for (FStreamlineFeatureProbe& Probe : GStreamlineFeatureProbes)
+		{
+			if (Probe.Feature == Feature)
+			{
+				return &Probe;
+			}
+		}
+		return nullptr;
+	}
+
+	void RunStreamlineFeatureProbe(FStreamlineFeatureProbe& Probe)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		Probe.Result = SLisFeatureSupported(Probe.Feature, *GetPlatformStreamlineRHI()->GetAdapterInfo());
+		Probe.ProbeSeconds = FPlatformTime::Seconds() - StartTime;
+		Probe.bProbed = true;
+	}
+
+	bool IsStreamlineFeatureLoaded(const FStreamlineFeatureProbe& Probe)
+	{
+		const IConsoleVariable* LoadCVar = IConsoleManager::Get().FindConsoleVariable(Probe.LoadCVarName);
+		return LoadCVar && LoadCVar->GetBool();
+	}
+
+	// returns how long the game thread blocked on the probe task
+	double JoinStreamlineFeatureProbeTask()
+	{
+		check(IsInGameThread());
+
+		if (!GStreamlineFeatureProbeTask.IsValid())
+		{
+			return 0.0;
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(GStreamlineFeatureProbeTask);
+		GStreamlineFeatureProbeTask = nullptr;
+		return FPlatformTime::Seconds() - StartTime;
+	}
+}
+
+void StartStreamlineFeatureProbes()
+{
+	check(IsInGameThread());
+
+	if (GStreamlineFeatureProbeTask.IsValid() || !CVarStreamlineParallelFeatureProbes.GetValueOnGameThread() || !FApp::CanEverRender() || !IsRHIDeviceNVIDIA() || !IsStreamlineSupported())
+	{
+		return;
+	}
+
+	TArray<FStreamlineFeatureProbe*> Probes;
+	for (FStreamlineFeatureProbe& Probe : GStreamlineFeatureProbes)
+	{
+		if (!Probe.bProbed && IsStreamlineFeatureLoaded(Probe))
+		{
+			Probe.bRanOnWorker = true;
+			Probes.Add(&Probe);
+		}
+	}
+
+	if (Probes.Num())
+	{
+		GStreamlineFeatureProbeTask = FFunctionGraphTask::CreateAndDispatchWhenReady([Probes]()
+		{
+			for (FStreamlineFeatureProbe* Probe : Probes)
+			{
+				RunStreamlineFeatureProbe(*Probe);
+			}
+		}, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
+	}
+}
+
+bool IsStreamlineFeatureLoadEnabled(sl::Feature Feature)
+{
+	const FStreamlineFeatureProbe* Probe = FindStreamlineFeatureProbe(Feature);
+	return !Probe || IsStreamlineFeatureLoaded(*Probe);
+}
+
+sl::Result GetStreamlineFeatureProbeResult(sl::Feature Feature)
+{
+	const double WaitSeconds = JoinStreamlineFeatureProbeTask();
+
+	FStreamlineFeatureProbe* Probe = FindStreamlineFeatureProbe(Feature);
+	if (!Probe)
+	{
+		return SLisFeatureSupported(Feature, *GetPlatformStreamlineRHI()->GetAdapterInfo());
+	}
+
+	if (Probe->bRanOnWorker)
+	{
+		// the first query of a feature probed on the worker is the one that waited for it, if anything did
+		if (WaitSeconds > 0.0)
+		{
+			Probe->WaitSeconds = WaitSeconds;
+		}
+	}
+	else if (!Probe->bProbed)
+	{
+		// not loaded or parallel probing is off, so this is the first use
+		RunStreamlineFeatureProbe(*Probe);
+		Probe->WaitSeconds = Probe->ProbeSeconds;
+	}
+
+	return Probe->Result;
+}
+
+void WaitForStreamlineFeatureProbes()
+{
+	JoinStreamlineFeatureProbeTask();
+}
+
+void BeginStreamlineStartupTiming()
+{
+	GStreamlineStartupBeginTime = FPlatformTime::Seconds();
+}
+
+void EndStreamlineStartupTiming(bool bLog)
+{
+	GStreamlineStartupSeconds += FPlatformTime::Seconds() - GStreamlineStartupBeginTime;
+	if (bLog)
+	{
+		LogStreamlineStartupTiming();
+	}
+}
+
+void LogStreamlineStartupTiming()
+{
+	UE_LOG(LogStreamline, Log, TEXT("Streamline startup blocked the game thread for %.2f ms"), 1000.0 * GStreamlineStartupSeconds);
+
+	for (const FStreamlineFeatureProbe& Probe : GStreamlineFeatureProbes)
+	{
+		if (!GStreamlineFeatureProbeTask.IsValid() && Probe.bProbed)
+		{
+			UE_LOG(LogStreamline, Log, TEXT("  %-20s probe %.2f ms %s, blocked startup for %.2f ms (%s)"), ANSI_TO_TCHAR(sl::getFeatureAsStr(Probe.Feature)),
+				1000.0 * Probe.ProbeSeconds, Probe.bRanOnWorker ? TEXT("on a worker") : TEXT("inline"), 1000.0 * Probe.WaitSeconds, ANSI_TO_TCHAR(sl::getResultAsStr(Probe.Result)));
+		}
+		else
+		{
+			UE_LOG(LogStreamline, Log, TEXT("  %-20s %s"), ANSI_TO_TCHAR(sl::getFeatureAsStr(Probe.Feature)), Probe.bRanOnWorker ? TEXT("probe pending") : TEXT("deferred until first use"));
+		}
+	}
+}
+
+static FAutoConsoleCommand CCmdStreamlineLogStartupTiming(
+	TEXT("r.Streamline.LogStartupTiming"),
+	TEXT("Logs per Streamline feature how long probing its support took at startup and how long that blocked the game thread"),
+	FConsoleCommandDelegate::CreateStatic(&LogStreamlineStartupTiming));
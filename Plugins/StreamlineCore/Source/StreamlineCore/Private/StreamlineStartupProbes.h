@@ -0,0 +1,39 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "sl.h"
+
+// Game thread, in FStreamlineCoreModule::StartupModule. Kicks off slIsFeatureSupported for every feature whose r.Streamline.Load.*
+// is enabled on one task graph worker, so the probes overlap with the rest of the engine startup. Features that aren't loaded get
+// probed lazily by their first query instead.
+// Streamline isn't documented to be thread safe, so the probes run one after the other on that single worker. Until it got joined,
+// nothing else may call into Streamline: feature queries go through GetStreamlineFeatureProbeResult, which joins it first, and the
+// module defers its other Streamline calls until the first frame
+void StartStreamlineFeatureProbes();
+
+// Game thread. Whether r.Streamline.Load.* enables Feature, so queries of features the project doesn't use can be deferred
+bool IsStreamlineFeatureLoadEnabled(sl::Feature Feature);
+
+// Game thread. Returns the slIsFeatureSupported result for Feature, joining the probe task if it's still running,
+// or running the probe right here if the feature wasn't part of it
+sl::Result GetStreamlineFeatureProbeResult(sl::Feature Feature);
+
+// Game thread. Joins the probe task if nobody queried a feature yet, e.g. before shutting down Streamline
+void WaitForStreamlineFeatureProbes();
+
+// Game thread. Accumulates how long the Streamline startup blocked the game thread, in StartupModule and in the part deferred to the
+// first frame. Logs the timing breakdown if bLog, see also r.Streamline.LogStartupTiming
+void BeginStreamlineStartupTiming();
+void EndStreamlineStartupTiming(bool bLog);
+void LogStreamlineStartupTiming();
@@ -0,0 +1,252 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineUICoverage.h"
+#include "StreamlineCorePrivate.h"
+#include "StreamlineDLSSG.h"
+#include "StreamlineLatewarp.h"
+#include "UICoveragePass.h"
+
+#include "HAL/IConsoleManager.h"
+#include "RenderGraphUtils.h"
+#include "RHIGPUReadback.h"
+
+static TAutoConsoleVariable<bool> CVarStreamlineUICoverageEnable(
+	TEXT("r.Streamline.UICoverage.Enable"),
+	false,
+	TEXT("Suspend DLSS-FG and Latewarp while UI covers most of the game viewport, e.g. in pause menus (default = false)\n")
+	TEXT("Unlike r.Streamline.DLSSG.FullScreenMenuDetection this measures the UI alpha in the backbuffer on the plugin side, so the decision is visible in stat StreamlineUICoverage\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarStreamlineUICoverageAlphaThreshold(
+	TEXT("r.Streamline.UICoverage.AlphaThreshold"),
+	0.0f,
+	TEXT("Backbuffer alpha above which a pixel counts as covered by UI (default = 0.0)\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarStreamlineUICoverageSuspendCoverage(
+	TEXT("r.Streamline.UICoverage.SuspendCoverage"),
+	0.8f,
+	TEXT("Fraction of the viewport UI needs to cover before frame generation gets suspended (default = 0.8)\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarStreamlineUICoverageResumeCoverage(
+	TEXT("r.Streamline.UICoverage.ResumeCoverage"),
+	0.6f,
+	TEXT("Fraction of the viewport UI needs to drop below before suspended frame generation resumes (default = 0.6)\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarStreamlineUICoverageMinOpacity(
+	TEXT("r.Streamline.UICoverage.MinOpacity"),
+	0.5f,
+	TEXT("Average alpha the covering UI needs to have to suspend frame generation, so that translucent overlays don't (default = 0.5)\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarStreamlineUICoverageSuspendFrames(
+	TEXT("r.Streamline.UICoverage.SuspendFrames"),
+	10,
+	TEXT("Number of consecutive measurements above the suspend thresholds before frame generation gets suspended (default = 10)\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarStreamlineUICoverageResumeFrames(
+	TEXT("r.Streamline.UICoverage.ResumeFrames"),
+	5,
+	TEXT("Number of consecutive measurements below the resume threshold before frame generation resumes (default = 5)\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarStreamlineUICoverageRetainResources(
+	TEXT("r.Streamline.UICoverage.RetainResources"),
+	1,
+	TEXT("What to do with the DLSS-FG resources while frame generation is suspended because of UI (default = 1)\n")
+	TEXT("0: leave them to the hibernation policy, see r.Streamline.Hibernation.GracePeriod\n")
+	TEXT("1: retain them\n"),
+	ECVF_RenderThreadSafe);
+
+DECLARE_STATS_GROUP(TEXT("Streamline UI Coverage"), STATGROUP_StreamlineUICoverage, STATCAT_Advanced);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("UI Coverage"), STAT_StreamlineUICoverage, STATGROUP_StreamlineUICoverage);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("UI Average Opacity"), STAT_StreamlineUICoverageAverageOpacity, STATGROUP_StreamlineUICoverage);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Frame Generation Suspended"), STAT_StreamlineUICoverageSuspended, STATGROUP_StreamlineUICoverage);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Suspensions"), STAT_StreamlineUICoverageSuspensions, STATGROUP_StreamlineUICoverage);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Skipped Measurements (Readbacks Pending)"), STAT_StreamlineUICoverageSkipped, STATGROUP_StreamlineUICoverage);
+
+bool FStreamlineUICoverageHysteresis::Update(const FStreamlineUICoverageSample& Sample, const FSettings& Settings)
+{
+	const bool bWantsSuspended = bSuspended
+		? (Sample.Coverage >= Settings.ResumeCoverage && Sample.AverageOpacity >= Settings.MinOpacity)
+		: (Sample.Coverage >= Settings.SuspendCoverage && Sample.AverageOpacity >= Settings.MinOpacity);
+
+	if (bWantsSuspended == bSuspended)
+	{
+		NumSamplesAgainstState = 0;
+		return false;
+	}
+
+	const int32 RequiredSamples = FMath::Max(1, bSuspended ? Settings.ResumeFrames : Settings.SuspendFrames);
+	if (++NumSamplesAgainstState < RequiredSamples)
+	{
+		return false;
+	}
+
+	bSuspended = bWantsSuspended;
+	NumSamplesAgainstState = 0;
+	return true;
+}
+
+void FStreamlineUICoverageHysteresis::Reset()
+{
+	bSuspended = false;
+	NumSamplesAgainstState = 0;
+}
+
+static TGlobalResource<FStreamlineUICoverageDetector> GStreamlineUICoverageDetector;
+
+FStreamlineUICoverageDetector& FStreamlineUICoverageDetector::Get()
+{
+	return GStreamlineUICoverageDetector;
+}
+
+FStreamlineUICoverageDetector::~FStreamlineUICoverageDetector() = default;
+
+void FStreamlineUICoverageDetector::ReleaseRHI()
+{
+	for (FPendingReadback& Pending : PendingReadbacks)
+	{
+		Pending.Readback.Reset();
+	}
+	Reset();
+}
+
+void FStreamlineUICoverageDetector::ProcessReadbacks()
+{
+	const FStreamlineUICoverageHysteresis::FSettings Settings =
+	{
+		CVarStreamlineUICoverageSuspendCoverage.GetValueOnRenderThread(),
+		CVarStreamlineUICoverageResumeCoverage.GetValueOnRenderThread(),
+		CVarStreamlineUICoverageMinOpacity.GetValueOnRenderThread(),
+		CVarStreamlineUICoverageSuspendFrames.GetValueOnRenderThread(),
+		CVarStreamlineUICoverageResumeFrames.GetValueOnRenderThread()
+	};
+
+	// readbacks complete in submission order, so stop at the first one that isn't ready yet
+	while (NumPendingReadbacks > 0 && PendingReadbacks[FirstPendingReadback].Readback->IsReady())
+	{
+		FPendingReadback& Pending = PendingReadbacks[FirstPendingReadback];
+
+		const uint32* Counters = static_cast<const uint32*>(Pending.Readback->Lock(UI_COVERAGE_NUM_COUNTERS * sizeof(uint32)));
+		const uint32 CoveredPixels = Counters[UI_COVERAGE_COVERED_PIXELS];
+		const uint32 AlphaSum = Counters[UI_COVERAGE_ALPHA_SUM];
+		Pending.Readback->Unlock();
+
+		FStreamlineUICoverageSample Sample;
+		Sample.Coverage = Pending.NumPixels > 0 ? float(double(CoveredPixels) / double(Pending.NumPixels)) : 0.0f;
+		Sample.AverageOpacity = CoveredPixels > 0 ? float(double(AlphaSum) / (double(CoveredPixels) * UI_COVERAGE_ALPHA_SCALE)) : 0.0f;
+
+		if (Hysteresis.Update(Sample, Settings))
+		{
+			UE_LOG(LogStreamline, Log, TEXT("%s frame generation, UI covers %.1f%% of the viewport with %.2f average opacity"),
+				Hysteresis.IsSuspended() ? TEXT("Suspending") : TEXT("Resuming"), 100.0f * Sample.Coverage, Sample.AverageOpacity);
+			if (Hysteresis.IsSuspended())
+			{
+				INC_DWORD_STAT(STAT_StreamlineUICoverageSuspensions);
+			}
+		}
+
+		SET_FLOAT_STAT(STAT_StreamlineUICoverage, Sample.Coverage);
+		SET_FLOAT_STAT(STAT_StreamlineUICoverageAverageOpacity, Sample.AverageOpacity);
+
+		FirstPendingReadback = (FirstPendingReadback + 1) % MaxPendingReadbacks;
+		--NumPendingReadbacks;
+	}
+
+	SET_DWORD_STAT(STAT_StreamlineUICoverageSuspended, Hysteresis.IsSuspended() ? 1 : 0);
+}
+
+void FStreamlineUICoverageDetector::AddPasses(FRDGBuilder& GraphBuilder, const FTextureRHIRef& InBackBuffer, const FIntRect& InViewRect)
+{
+	check(IsInRenderingThread());
+
+	// multiple windows can present in the same frame, the first one is the game viewport in all cases we care about
+	if (LastFrameCounter == GFrameCounterRenderThread)
+	{
+		return;
+	}
+	LastFrameCounter = GFrameCounterRenderThread;
+
+	ProcessReadbacks();
+
+#if	((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))
+	const FIntPoint BackBufferDimension = InBackBuffer->GetDesc().Extent;
+#else
+	const FIntPoint BackBufferDimension = { int32(InBackBuffer->GetTexture2D()->GetSizeX()), int32(InBackBuffer->GetTexture2D()->GetSizeY()) };
+#endif
+	FIntRect ViewRect = InViewRect;
+	ViewRect.Clip(FIntRect(FIntPoint::ZeroValue, BackBufferDimension));
+	if (ViewRect.IsEmpty())
+	{
+		return;
+	}
+
+	// never wait on the GPU here, rather skip a measurement
+	if (NumPendingReadbacks == MaxPendingReadbacks)
+	{
+		INC_DWORD_STAT(STAT_StreamlineUICoverageSkipped);
+		return;
+	}
+
+	FPendingReadback& Pending = PendingReadbacks[(FirstPendingReadback + NumPendingReadbacks) % MaxPendingReadbacks];
+	if (!Pending.Readback.IsValid())
+	{
+		Pending.Readback = MakeUnique<FRHIGPUBufferReadback>(TEXT("Streamline.UICoverageReadback"));
+	}
+	Pending.NumPixels = uint64(ViewRect.Area());
+
+	RDG_EVENT_SCOPE(GraphBuilder, "Streamline UI Coverage Detection");
+	FRDGBufferRef UICoverageBuffer = AddStreamlineUICoveragePass(GraphBuilder, CVarStreamlineUICoverageAlphaThreshold.GetValueOnRenderThread(), InBackBuffer, ViewRect);
+	AddEnqueueCopyPass(GraphBuilder, Pending.Readback.Get(), UICoverageBuffer, UI_COVERAGE_NUM_COUNTERS * sizeof(uint32));
+	++NumPendingReadbacks;
+}
+
+void FStreamlineUICoverageDetector::Reset()
+{
+	// the readbacks themselves are kept around for reuse, their stale results just get dropped
+	FirstPendingReadback = 0;
+	NumPendingReadbacks = 0;
+	Hysteresis.Reset();
+	SET_DWORD_STAT(STAT_StreamlineUICoverageSuspended, 0);
+}
+
+static bool IsStreamlineUICoverageDetectionEnabled()
+{
+	return CVarStreamlineUICoverageEnable.GetValueOnRenderThread() && (IsDLSSGActive() || IsLatewarpActive());
+}
+
+void AddStreamlineUICoverageDetectionPasses(FRDGBuilder& GraphBuilder, const FTextureRHIRef& InBackBuffer, const FIntRect& InViewRect)
+{
+	FStreamlineUICoverageDetector& Detector = FStreamlineUICoverageDetector::Get();
+
+	if (!IsStreamlineUICoverageDetectionEnabled())
+	{
+		Detector.Reset();
+		return;
+	}
+
+	Detector.AddPasses(GraphBuilder, InBackBuffer, InViewRect);
+}
+
+bool IsStreamlineUICoverageSuspendingFrameGeneration()
+{
+	return IsStreamlineUICoverageDetectionEnabled() && FStreamlineUICoverageDetector::Get().IsSuspended();
+}
+
+bool ShouldStreamlineUICoverageRetainResources()
+{
+	return CVarStreamlineUICoverageRetainResources.GetValueOnRenderThread() != 0;
+}
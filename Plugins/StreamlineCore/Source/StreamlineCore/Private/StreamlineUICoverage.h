@@ -0,0 +1,92 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderGraphBuilder.h"
+#include "RenderResource.h"
+#include "UICoveragePass.h"
+
+class FRHIGPUBufferReadback;
+
+struct FStreamlineUICoverageSample
+{
+	// fraction of the viewport covered by UI, i.e. pixels with a backbuffer alpha above r.Streamline.UICoverage.AlphaThreshold
+	float Coverage = 0.0f;
+	// average alpha of the covered pixels
+	float AverageOpacity = 0.0f;
+};
+
+// The suspend/resume decision, kept free of any RHI state so it can be driven with synthetic samples
+class FStreamlineUICoverageHysteresis
+{
+public:
+	struct FSettings
+	{
+		float SuspendCoverage = 0.8f;
+		float ResumeCoverage = 0.6f;
+		float MinOpacity = 0.5f;
+		int32 SuspendFrames = 10;
+		int32 ResumeFrames = 5;
+	};
+
+	// returns true if the suspension state changed
+	bool Update(const FStreamlineUICoverageSample& Sample, const FSettings& Settings);
+	void Reset();
+
+	bool IsSuspended() const { return bSuspended; }
+
+private:
+	bool bSuspended = false;
+	// consecutive samples that voted for leaving the current state
+	int32 NumSamplesAgainstState = 0;
+};
+
+// Measures how much of the game viewport is covered by opaque UI, using the UI alpha the engine leaves in the backbuffer.
+// The reduction runs on the GPU at present time and gets read back a few frames later, so the decision lags by that much,
+// which the hysteresis frame counts are meant to absorb anyway. A global resource so the readbacks get freed at RHI shutdown
+class FStreamlineUICoverageDetector : public FRenderResource
+{
+public:
+	static FStreamlineUICoverageDetector& Get();
+	virtual ~FStreamlineUICoverageDetector();
+
+	virtual void ReleaseRHI() override;
+
+	// called from the present callbacks, runs at most once per frame
+	void AddPasses(FRDGBuilder& GraphBuilder, const FTextureRHIRef& InBackBuffer, const FIntRect& InViewRect);
+
+	bool IsSuspended() const { return Hysteresis.IsSuspended(); }
+	void Reset();
+
+private:
+	void ProcessReadbacks();
+
+	static constexpr int32 MaxPendingReadbacks = 4;
+
+	struct FPendingReadback
+	{
+		TUniquePtr<FRHIGPUBufferReadback> Readback;
+		uint64 NumPixels = 0;
+	};
+
+	FPendingReadback PendingReadbacks[MaxPendingReadbacks];
+	int32 FirstPendingReadback = 0;
+	int32 NumPendingReadbacks = 0;
+
+	FStreamlineUICoverageHysteresis Hysteresis;
+	uint64 LastFrameCounter = 0;
+};
+
+// render thread
+void AddStreamlineUICoverageDetectionPasses(FRDGBuilder& GraphBuilder, const FTextureRHIRef& InBackBuffer, const FIntRect& InViewRect);
+bool IsStreamlineUICoverageSuspendingFrameGeneration();
+bool ShouldStreamlineUICoverageRetainResources();
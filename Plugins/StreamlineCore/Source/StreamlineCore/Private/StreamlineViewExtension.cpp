@@ -15,8 +15,11 @@
 #include "StreamlineDLSSG.h"
 #include "StreamlineLatewarp.h"
 #include "StreamlineDeepDVC.h"
+#include "StreamlineHibernation.h"
+#include "StreamlineOptionsCache.h"
 #include "StreamlineRHI.h"
 #include "StreamlineAPI.h"
+#include "StreamlineConversions.h"
 
 #include "ClearQuad.h"
 #include "Runtime/Launch/Resources/Version.h"
@@ -122,6 +125,13 @@ static TAutoConsoleVariable<bool> CVarStreamlineClearColorAlpha(
 	TEXT("Clear alpha of scenecolor at the end of the Streamline view extension to allow subsequent UI drawcalls be represented correctly in the alpha channel (default = true)\n"),
 	ECVF_RenderThreadSafe);
 
+static TAutoConsoleVariable<bool> CVarStreamlineBatchViews(
+	TEXT("r.Streamline.BatchViews"),
+	true,
+	TEXT("Submit the Streamline constants and DLSS-FG state of all views of a view family together at the end of the family, with one frame token lookup, instead of one pass per view (default = true)\n")
+	TEXT("Views still get submitted one by one while DeepDVC is active since it evaluates inside the view and needs the constants first\n"),
+	ECVF_RenderThreadSafe);
+
 #if DEBUG_STREAMLINE_VIEW_TRACKING
 static bool bLogStreamlineLogTrackedViews = false;
 static FAutoConsoleVariableRef CVarStreamlineLogTrackedViews(
@@ -148,6 +158,16 @@ bool DoActiveStreamlineFeaturesSupportMultiView()
 	return !IsLatewarpActive();
 }
 
+static bool ShouldBatchStreamlineViews()
+{
+#if ENGINE_MAJOR_VERSION == 4
+	// PostRenderViewFamily_RenderThread doesn't get a graph builder, so there's nowhere to add the batched pass
+	return false;
+#else
+	return CVarStreamlineBatchViews.GetValueOnRenderThread() && !IsDeepDVCActive();
+#endif
+}
+
 int GetViewIndexToTag()
 {
 	if (DoActiveStreamlineFeaturesSupportMultiView())
@@ -509,6 +529,12 @@ void FStreamlineViewExtension::PreRenderViewFamily_RenderThread(FGraphBuilderOrC
 	
 	// we should be done with older frames so remove those frame ids
 	StreamlineCameraManager.PreRenderViewFamily_RenderThread(InViewFamily, GFrameCounterRenderThread);
+
+#if ENGINE_MAJOR_VERSION == 5
+	// in case the previous view family didn't make it to PostRenderViewFamily_RenderThread
+	AddStreamlineBatchedViewsPasses(GraphBuilderOrCmd);
+#endif
+
 	TArray<uint32> StaleViews;
 	TArray<uint32> ActiveViews;
 	FramesWhereStreamlineConstantsWereSet.RemoveAllSwap([&StaleViews, &ActiveViews](TTuple<uint64, uint32>  Item)
@@ -547,7 +573,9 @@ void FStreamlineViewExtension::PreRenderViewFamily_RenderThread(FGraphBuilderOrC
 		{
 			UE_CLOG(DebugViewTracking(), LogStreamline, Log, TEXT("%s %s freeing resources for View Id %u"), ANSI_TO_TCHAR(__FUNCTION__), *CurrentThreadName(), StaleView);
 			StreamlineRHIExtensions->ReleaseStreamlineResourcesForAllFeatures(StaleView);
+			ForgetStreamlineOptionsCacheView(StaleView);
 		});
+		ForgetStreamlineHibernationView(StaleView);
 	}
 }
 
@@ -561,9 +589,40 @@ void FStreamlineViewExtension::PostRenderView_RenderThread(FGraphBuilderOrCmdLis
 	StreamlineCameraManager.PostRenderView_RenderThread(InView, GFrameCounterRenderThread);
 }
 
-void FStreamlineViewExtension::PostRenderViewFamily_RenderThread(FGraphBuilderOrCmdList&, FSceneViewFamily& InViewFamily)
+void FStreamlineViewExtension::PostRenderViewFamily_RenderThread(FGraphBuilderOrCmdList& GraphBuilderOrCmd, FSceneViewFamily& InViewFamily)
+{
+#if ENGINE_MAJOR_VERSION == 5
+	AddStreamlineBatchedViewsPasses(GraphBuilderOrCmd);
+#endif
+}
+
+void FStreamlineViewExtension::AddStreamlineBatchedViewsPasses(FRDGBuilder& GraphBuilder)
 {
+	if (BatchedStreamlineArguments.Num() > 0)
+	{
+		FStreamlineRHI* LocalStreamlineRHIExtensions = StreamlineRHIExtensions;
+		FSLSetStateShaderParameters* PassParameters = GraphBuilder.AllocParameters<FSLSetStateShaderParameters>();
 
+		GraphBuilder.AddPass(
+			RDG_EVENT_NAME("Streamline Constants NumViews=%d", BatchedStreamlineArguments.Num()),
+			PassParameters,
+			ERDGPassFlags::Compute | ERDGPassFlags::Raster | ERDGPassFlags::SkipRenderPass | ERDGPassFlags::NeverCull,
+			[LocalStreamlineRHIExtensions, StreamlineArguments = MoveTemp(BatchedStreamlineArguments)](FRHICommandListImmediate& RHICmdList) mutable
+		{
+			RHICmdList.EnqueueLambda(
+			[LocalStreamlineRHIExtensions, StreamlineArguments = MoveTemp(StreamlineArguments)](FRHICommandListImmediate& Cmd) mutable
+			{
+				LocalStreamlineRHIExtensions->SetStreamlineData(Cmd, StreamlineArguments);
+			});
+		});
+		BatchedStreamlineArguments.Reset();
+	}
+
+	if (BatchedDLSSGStateViews.Num() > 0)
+	{
+		AddStreamlineDLSSGStateRenderPass(GraphBuilder, MoveTemp(BatchedDLSSGStateViews));
+		BatchedDLSSGStateViews.Reset();
+	}
 }
 
 void AddStreamlineUIHintTagPass(
@@ -757,6 +816,7 @@ FScreenPassTexture FStreamlineViewExtension::PostProcessPassAtEnd_RenderThread(F
 	const uint64 FrameID = GFrameCounterRenderThread;
 	const FIntRect ViewRect = ViewInfo.ViewRect;
 	const FIntRect SecondaryViewRect = FIntRect(FIntPoint::ZeroValue, ViewInfo.GetSecondaryViewRectSize());
+	const bool bBatchViews = ShouldBatchStreamlineViews();
 
 	RDG_GPU_STAT_SCOPE(GraphBuilder, Streamline);
 
@@ -868,22 +928,27 @@ FScreenPassTexture FStreamlineViewExtension::PostProcessPassAtEnd_RenderThread(F
 				TexCreate_ShaderResource | TexCreate_UAV | TexCreate_RenderTargetable
 			);
 
-			SLCustomDepth = GraphBuilder.CreateTexture(SLCustomDepthDesc, TEXT("Streamline.CustomDepth"));
-
 			if (bHasCustomDepth)
 			{
+				SLCustomDepth = GraphBuilder.CreateTexture(SLCustomDepthDesc, TEXT("Streamline.CustomDepth"));
+
 				// note we pass in the rect directly since the implicit default of "0  means whole texture" behaves differently in 5.4 than before
 				// and essentially treats the output as 0 sized viewrtect.
 				AddDrawTexturePass(GraphBuilder, ViewInfo, CustomDepth, SLCustomDepth, ViewRect);
 			}
 			else
 			{
+				// nothing writes the mask then, so it only gets cleared when it's created instead of every frame
+				SLCustomDepth = FStreamlinePersistentResources::Get().RegisterTexture(GraphBuilder, TEXT("Streamline.CustomDepth.Cleared"), SLCustomDepthDesc,
+					[](FRDGBuilder& InGraphBuilder, FRDGTextureRef Texture)
+					{
 #if ENGINE_MAJOR_VERSION == 4
-				const float kClearValue[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+						const float kClearValue[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
 #else
-				const float kClearValue = 0.0f;
+						const float kClearValue = 0.0f;
 #endif
-				AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(SLCustomDepth), kClearValue);
+						AddClearUAVPass(InGraphBuilder, InGraphBuilder.CreateUAV(Texture), kClearValue);
+					});
 			}
 
 			PassParameters->NoWarpMask = SLCustomDepth;
@@ -962,21 +1027,30 @@ FScreenPassTexture FStreamlineViewExtension::PostProcessPassAtEnd_RenderThread(F
 		}
 #endif
 
+		// with batching the constants of this view get set together with the other views of the family in PostRenderViewFamily_RenderThread
+		if (bBatchViews)
+		{
+			BatchedStreamlineArguments.Add(StreamlineArguments);
+		}
+
 		GraphBuilder.AddPass(
 		RDG_EVENT_NAME("Streamline Common %dx%d FrameId=%u ViewID=%u", ViewRect.Width(), ViewRect.Height(), StreamlineArguments.FrameId, StreamlineArguments.ViewId),
 			PassParameters,
 			ERDGPassFlags::Raster | ERDGPassFlags::Compute | ERDGPassFlags::Copy
 			| ERDGPassFlags::NeverCull | ERDGPassFlags::NeverMerge | ERDGPassFlags::SkipRenderPass,
 			[LocalStreamlineRHIExtensions, PassParameters, StreamlineArguments, ViewRect, SecondaryViewRect, SceneColor, 
-			bTagMotionVectors, bTagCustomDepth, bTagSceneColorWithoutHUD](FRHICommandListImmediate& RHICmdList) mutable
+			bTagMotionVectors, bTagCustomDepth, bTagSceneColorWithoutHUD, bBatchViews](FRHICommandListImmediate& RHICmdList) mutable
 		{
 
 			// first the constants
-			RHICmdList.EnqueueLambda(
-			[LocalStreamlineRHIExtensions, StreamlineArguments](FRHICommandListImmediate& Cmd) mutable
+			if (!bBatchViews)
 			{
-				LocalStreamlineRHIExtensions->SetStreamlineData(Cmd, StreamlineArguments);
-			});
+				RHICmdList.EnqueueLambda(
+				[LocalStreamlineRHIExtensions, StreamlineArguments](FRHICommandListImmediate& Cmd) mutable
+				{
+					LocalStreamlineRHIExtensions->SetStreamlineData(Cmd, StreamlineArguments);
+				});
+			}
 
 			TArray<FRHIStreamlineResource, TInlineAllocator<4>> TexturesToTagOrUntag;
 			check(PassParameters->Depth);
@@ -1032,7 +1106,14 @@ FScreenPassTexture FStreamlineViewExtension::PostProcessPassAtEnd_RenderThread(F
 	// this is always executed if DLSS-G is supported so we can turn DLSS-G off at the SL side (after we skipped the work above)
 	if (IsStreamlineDLSSGSupported())
 	{
-		AddStreamlineDLSSGStateRenderPass(GraphBuilder, ViewID, SecondaryViewRect);
+		if (bBatchViews)
+		{
+			BatchedDLSSGStateViews.Add({ ViewID, SecondaryViewRect });
+		}
+		else
+		{
+			AddStreamlineDLSSGStateRenderPass(GraphBuilder, ViewID, SecondaryViewRect);
+		}
 	}
 
 	// this is always executed if Latewarp is supported so we can turn it off at the SL side (after we skipped the work above)
@@ -1041,6 +1122,12 @@ FScreenPassTexture FStreamlineViewExtension::PostProcessPassAtEnd_RenderThread(F
 		AddStreamlineLatewarpStateRenderPass(GraphBuilder, ViewID, SecondaryViewRect);
 	}
 
+	// DeepDVC keeps its resources when its state pass stops running, so the hibernation policy decides when to free them
+	if (IsStreamlineDeepDVCSupported())
+	{
+		UpdateStreamlineHibernation(EStreamlineHibernationFeature::DeepDVC, ViewID, IsDeepDVCActive());
+	}
+
 	// DeepDVC render pass
 	if(IsDeepDVCActive())
 	{
@@ -1129,5 +1216,90 @@ FScreenPassTexture FStreamlineViewExtension::PostProcessPassAtEnd_RenderThread(F
 #endif
 	}
 }
+#if !UE_BUILD_SHIPPING && ENGINE_MAJOR_VERSION == 5
+// Times the CPU side (render and RHI thread) of setting the Streamline constants of 1, 2, 4 and 8 views, once with a pass per view and once
+// with a single batched pass. The constants only get converted to their SL representation, not handed to SL, so the live views are unaffected
+static void BenchmarkStreamlineBatchedConstants(const TArray<FString>& Args)
+{
+	const int32 NumIterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+
+	ENQUEUE_RENDER_COMMAND(BenchmarkStreamlineBatchedConstants)(
+		[NumIterations](FRHICommandListImmediate& RHICmdList)
+	{
+		FStreamlineRHI* RHIExtensions = FStreamlineCoreModule::GetStreamlineRHI();
+		// keeps the conversions from getting optimized out
+		float* Sink = new float(0.0f);
+
+		for (const int32 NumViews : { 1, 2, 4, 8 })
+		{
+			TArray<FRHIStreamlineArguments> Views;
+			for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+			{
+				FRHIStreamlineArguments& Arguments = Views.AddZeroed_GetRef();
+				Arguments.FrameId = uint32(GFrameCounterRenderThread);
+				Arguments.ViewId = ViewIndex;
+				Arguments.JitterOffset = FRHIStreamlineArguments::FVector2f(0.25f * ViewIndex, -0.25f);
+			}
+
+			double Seconds[2] = { 0.0, 0.0 };
+			for (int32 bBatched = 0; bBatched < 2; ++bBatched)
+			{
+				const double StartTime = FPlatformTime::Seconds();
+				for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+				{
+					FRDGBuilder GraphBuilder(RHICmdList);
+					const int32 NumPasses = bBatched ? 1 : NumViews;
+					const int32 NumViewsPerPass = bBatched ? NumViews : 1;
+
+					for (int32 PassIndex = 0; PassIndex < NumPasses; ++PassIndex)
+					{
+						TArray<FRHIStreamlineArguments> PassViews(&Views[PassIndex * NumViewsPerPass], NumViewsPerPass);
+						FSLSetStateShaderParameters* PassParameters = GraphBuilder.AllocParameters<FSLSetStateShaderParameters>();
+
+						GraphBuilder.AddPass(
+							RDG_EVENT_NAME("Streamline Benchmark Constants"),
+							PassParameters,
+							ERDGPassFlags::Compute | ERDGPassFlags::Raster | ERDGPassFlags::SkipRenderPass | ERDGPassFlags::NeverCull,
+							[RHIExtensions, Sink, PassViews = MoveTemp(PassViews)](FRHICommandListImmediate& PassCmdList) mutable
+						{
+							PassCmdList.EnqueueLambda(
+							[RHIExtensions, Sink, PassViews = MoveTemp(PassViews)](FRHICommandListImmediate& Cmd)
+							{
+								if (RHIExtensions)
+								{
+									RHIExtensions->GetFrameToken(PassViews[0].FrameId);
+								}
+								for (const FRHIStreamlineArguments& Arguments : PassViews)
+								{
+									const sl::Constants Constants = ToSL(Arguments);
+									*Sink += Constants.jitterOffset.x;
+								}
+							});
+						});
+					}
+
+					GraphBuilder.Execute();
+					RHICmdList.ImmediateFlush(EImmediateFlushType::FlushRHIThread);
+				}
+				Seconds[bBatched] = FPlatformTime::Seconds() - StartTime;
+			}
+
+			UE_LOG(LogStreamline, Log, TEXT("Streamline constants for %d views: %.3f us with a pass per view, %.3f us batched per frame (%d iterations)"),
+				NumViews, 1.0e6 * Seconds[0] / NumIterations, 1.0e6 * Seconds[1] / NumIterations, NumIterations);
+		}
+
+		UE_LOG(LogStreamline, Verbose, TEXT("%f"), *Sink);
+		delete Sink;
+	});
+
+	FlushRenderingCommands();
+}
+
+static FAutoConsoleCommand CCmdStreamlineBenchmarkBatchedConstants(
+	TEXT("r.Streamline.BenchmarkBatchedConstants"),
+	TEXT("Logs the CPU time of setting the Streamline constants of 1, 2, 4 and 8 views with a pass per view and with r.Streamline.BatchViews. Optional argument: number of iterations (default 1000)"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkStreamlineBatchedConstants));
+#endif
+
 #undef LOCTEXT_NAMESPACE
  
\ No newline at end of file
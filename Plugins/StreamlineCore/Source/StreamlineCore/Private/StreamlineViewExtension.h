@@ -138,12 +138,18 @@ public:
 
 private:
 	FScreenPassTexture PostProcessPassAtEnd_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& View, const FPostProcessMaterialInputs& InOutInputs);
+	// submits the constants and DLSS-FG state collected from the views of the current view family, see r.Streamline.BatchViews
+	void AddStreamlineBatchedViewsPasses(FRDGBuilder& GraphBuilder);
 	
 	FStreamlineRHI* StreamlineRHIExtensions;
 	FStreamlineCameraManager StreamlineCameraManager;
 
 	// Frame id, view id
 	TArray< TTuple<uint64, uint32> > FramesWhereStreamlineConstantsWereSet;
+
+	// render thread, filled by PostProcessPassAtEnd_RenderThread and drained by AddStreamlineBatchedViewsPasses
+	TArray<FRHIStreamlineArguments> BatchedStreamlineArguments;
+	TArray<FStreamlineStateBatchView> BatchedDLSSGStateViews;
 	static FDelegateHandle OnPreResizeWindowBackBufferHandle;
 	static FDelegateHandle OnSlateWindowDestroyedHandle;
 };
@@ -0,0 +1,319 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineClipCorrection.h"
+
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// solid behind the plane, Normal points into the free space
+	struct FFakeClipCorrectionWall
+	{
+		FVector Point;
+		FVector Normal;
+	};
+
+	// Walls swept analytically. Async results can only be queried in the frame after the sweep got issued, like the async trace buffers of a world
+	class FFakeClipCorrectionScene final : public IStreamlineClipCorrectionScene
+	{
+	public:
+		TArray<FFakeClipCorrectionWall> Walls;
+		FObjectKey Key;
+		uint32 FrameID = 0;
+		int32 NumSweeps = 0;
+		int32 NumAsyncSweeps = 0;
+
+		virtual FObjectKey GetSceneKey() const override
+		{
+			return Key;
+		}
+
+		virtual bool Sweep(const FVector& Start, const FVector& End, float Radius, FStreamlineClipCorrectionHit& OutHit) override
+		{
+			++NumSweeps;
+			return SweepWalls(Start, End, Radius, OutHit);
+		}
+
+		virtual FTraceHandle AsyncSweep(const FVector& Start, const FVector& End, float Radius) override
+		{
+			++NumAsyncSweeps;
+			const FTraceHandle Handle(FrameID, AsyncSweeps.Num());
+			FAsyncSweep& AsyncSweep = AsyncSweeps.AddDefaulted_GetRef();
+			AsyncSweep.FrameID = FrameID;
+			AsyncSweep.bHit = SweepWalls(Start, End, Radius, AsyncSweep.Hit);
+			return Handle;
+		}
+
+		virtual bool QueryAsyncSweep(const FTraceHandle& Handle, bool& bOutHit, FStreamlineClipCorrectionHit& OutHit) override
+		{
+			const int32 Index = int32(Handle._Data.Index);
+			if (!AsyncSweeps.IsValidIndex(Index) || AsyncSweeps[Index].FrameID + 1 != FrameID)
+			{
+				return false;
+			}
+
+			bOutHit = AsyncSweeps[Index].bHit;
+			OutHit = AsyncSweeps[Index].Hit;
+			return true;
+		}
+
+	private:
+		struct FAsyncSweep
+		{
+			uint32 FrameID = 0;
+			bool bHit = false;
+			FStreamlineClipCorrectionHit Hit;
+		};
+		TArray<FAsyncSweep> AsyncSweeps;
+
+		bool SweepWalls(const FVector& Start, const FVector& End, float Radius, FStreamlineClipCorrectionHit& OutHit) const
+		{
+			double FirstHitTime = 2.0;
+			const FFakeClipCorrectionWall* FirstHitWall = nullptr;
+
+			for (const FFakeClipCorrectionWall& Wall : Walls)
+			{
+				const double StartDistance = FVector::DotProduct(Start - Wall.Point, Wall.Normal);
+				const double EndDistance = FVector::DotProduct(End - Wall.Point, Wall.Normal);
+
+				double HitTime = 2.0;
+				if (StartDistance <= Radius)
+				{
+					// starts in contact
+					HitTime = 0.0;
+				}
+				else if (EndDistance < Radius)
+				{
+					HitTime = (StartDistance - Radius) / (StartDistance - EndDistance);
+				}
+
+				if (HitTime < FirstHitTime)
+				{
+					FirstHitTime = HitTime;
+					FirstHitWall = &Wall;
+				}
+			}
+
+			if (!FirstHitWall)
+			{
+				return false;
+			}
+
+			OutHit.Location = Start + (End - Start) * FirstHitTime;
+			OutHit.ImpactNormal = FirstHitWall->Normal;
+			OutHit.ImpactPoint = OutHit.Location - FirstHitWall->Normal * FVector::DotProduct(OutHit.Location - FirstHitWall->Point, FirstHitWall->Normal);
+			return true;
+		}
+	};
+
+	FStreamlineClipCorrectionSettings MakeClipCorrectionTestSettings(bool bAsync)
+	{
+		FStreamlineClipCorrectionSettings Settings;
+		Settings.ClipRadius = 10.f;
+		Settings.bAsync = bAsync;
+		Settings.MinDisplacement = 0.5f;
+		Settings.FreeSpaceMargin = 10.f;
+		Settings.MaxReuseFrames = 4;
+		return Settings;
+	}
+
+	// a wall at X = 200 with the camera in front of it
+	FFakeClipCorrectionScene MakeClipCorrectionTestScene()
+	{
+		FFakeClipCorrectionScene Scene;
+		Scene.Walls.Add({ FVector(200.0, 0.0, 0.0), FVector(-1.0, 0.0, 0.0) });
+		return Scene;
+	}
+
+	const TCHAR* LexToString(EStreamlineClipCorrection Correction)
+	{
+		switch (Correction)
+		{
+		case EStreamlineClipCorrection::Skipped: return TEXT("Skipped");
+		case EStreamlineClipCorrection::Swept: return TEXT("Swept");
+		case EStreamlineClipCorrection::Reused: return TEXT("Reused");
+		case EStreamlineClipCorrection::ClampedToHit: return TEXT("ClampedToHit");
+		case EStreamlineClipCorrection::ClampedToFreeSpace: return TEXT("ClampedToFreeSpace");
+		case EStreamlineClipCorrection::ClampedToRadius: return TEXT("ClampedToRadius");
+		}
+		return TEXT("Unknown");
+	}
+
+	// runs one frame of the clip correction and checks how it got corrected and where the camera ends up
+	struct FClipCorrectionTestFrame
+	{
+		FAutomationTestBase& Test;
+		FStreamlineClipCorrection& ClipCorrection;
+		FFakeClipCorrectionScene& Scene;
+		const FStreamlineClipCorrectionSettings& Settings;
+
+		void Run(const TCHAR* What, uint32 FrameID, const FVector& Start, const FVector& End, EStreamlineClipCorrection ExpectedCorrection, const FVector& ExpectedEnd)
+		{
+			Scene.FrameID = FrameID;
+			EStreamlineClipCorrection Correction = EStreamlineClipCorrection::Skipped;
+			const FVector CorrectedEnd = ClipCorrection.Apply(Scene, Settings, FrameID, Start, End, &Correction);
+
+			Test.TestEqual(*FString::Printf(TEXT("%s: correction"), What), FString(LexToString(Correction)), FString(LexToString(ExpectedCorrection)));
+			Test.TestEqual(*FString::Printf(TEXT("%s: camera position"), What), CorrectedEnd, ExpectedEnd, 1e-3f);
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineClipCorrectionHitPlaneTest, "Plugins.Streamline.ClipCorrection.ClampToHitPlane",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineClipCorrectionHitPlaneTest::RunTest(const FString& Parameters)
+{
+	FStreamlineClipCorrectionHit Hit;
+	Hit.ImpactPoint = FVector(100.0, 0.0, 0.0);
+	Hit.ImpactNormal = FVector(-1.0, 0.0, 0.0);
+
+	TestEqual(TEXT("Stops the radius away from the plane"),
+		FStreamlineClipCorrection::ClampToHitPlane(FVector(0.0, 0.0, 0.0), FVector(200.0, 0.0, 0.0), 10.f, Hit), FVector(90.0, 0.0, 0.0), 1e-3f);
+	TestEqual(TEXT("Segments that stay clear aren't shortened"),
+		FStreamlineClipCorrection::ClampToHitPlane(FVector(0.0, 0.0, 0.0), FVector(50.0, 0.0, 0.0), 10.f, Hit), FVector(50.0, 0.0, 0.0), 1e-3f);
+	TestEqual(TEXT("Only the part towards the plane is limited"),
+		FStreamlineClipCorrection::ClampToHitPlane(FVector(0.0, 0.0, 0.0), FVector(180.0, 90.0, 0.0), 10.f, Hit), FVector(90.0, 45.0, 0.0), 1e-3f);
+	TestEqual(TEXT("Moving away from the plane isn't limited"),
+		FStreamlineClipCorrection::ClampToHitPlane(FVector(95.0, 0.0, 0.0), FVector(50.0, 0.0, 0.0), 10.f, Hit), FVector(50.0, 0.0, 0.0), 1e-3f);
+	TestEqual(TEXT("Already in contact doesn't move closer"),
+		FStreamlineClipCorrection::ClampToHitPlane(FVector(95.0, 0.0, 0.0), FVector(120.0, 0.0, 0.0), 10.f, Hit), FVector(95.0, 0.0, 0.0), 1e-3f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineClipCorrectionSyncTest, "Plugins.Streamline.ClipCorrection.Sync",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineClipCorrectionSyncTest::RunTest(const FString& Parameters)
+{
+	FFakeClipCorrectionScene Scene = MakeClipCorrectionTestScene();
+	FStreamlineClipCorrection ClipCorrection;
+	const FStreamlineClipCorrectionSettings Settings = MakeClipCorrectionTestSettings(false);
+	FClipCorrectionTestFrame Frame{ *this, ClipCorrection, Scene, Settings };
+
+	Frame.Run(TEXT("Into the wall"), 1, FVector(0.0, 0.0, 0.0), FVector(220.0, 0.0, 0.0), EStreamlineClipCorrection::Swept, FVector(190.0, 0.0, 0.0));
+	Frame.Run(TEXT("Clear of the wall"), 2, FVector(0.0, 0.0, 0.0), FVector(50.0, 0.0, 0.0), EStreamlineClipCorrection::Swept, FVector(50.0, 0.0, 0.0));
+	Frame.Run(TEXT("Below the minimum displacement"), 3, FVector(0.0, 0.0, 0.0), FVector(0.25, 0.0, 0.0), EStreamlineClipCorrection::Skipped, FVector(0.25, 0.0, 0.0));
+
+	TestEqual(TEXT("Sweeps issued"), Scene.NumSweeps, 2);
+	TestEqual(TEXT("No async sweeps"), Scene.NumAsyncSweeps, 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineClipCorrectionAsyncTest, "Plugins.Streamline.ClipCorrection.Async",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineClipCorrectionAsyncTest::RunTest(const FString& Parameters)
+{
+	FFakeClipCorrectionScene Scene = MakeClipCorrectionTestScene();
+	FStreamlineClipCorrection ClipCorrection;
+	const FStreamlineClipCorrectionSettings Settings = MakeClipCorrectionTestSettings(true);
+	FClipCorrectionTestFrame Frame{ *this, ClipCorrection, Scene, Settings };
+
+	// nothing known yet, the result of this sweep only comes in next frame
+	Frame.Run(TEXT("First frame"), 1, FVector(0.0, 0.0, 0.0), FVector(50.0, 0.0, 0.0), EStreamlineClipCorrection::ClampedToRadius, FVector(10.0, 0.0, 0.0));
+	TestEqual(TEXT("First frame issues a sweep"), Scene.NumAsyncSweeps, 1);
+
+	// the last sweep found free space and this segment is within its margin, so is the look ahead past it
+	Frame.Run(TEXT("Contained segment"), 2, FVector(2.0, 0.0, 0.0), FVector(52.0, 0.0, 0.0), EStreamlineClipCorrection::Reused, FVector(52.0, 0.0, 0.0));
+	TestEqual(TEXT("Contained segment doesn't issue a sweep"), Scene.NumAsyncSweeps, 1);
+
+	// the last sweep was clear, but this segment leaves its free space towards the wall. It goes as far as the free space does
+	Frame.Run(TEXT("Segment leaving the free space"), 3, FVector(50.0, 0.0, 0.0), FVector(150.0, 0.0, 0.0), EStreamlineClipCorrection::ClampedToFreeSpace, FVector(110.0, 0.0, 0.0));
+	TestEqual(TEXT("Segment leaving the free space issues a sweep"), Scene.NumAsyncSweeps, 2);
+
+	// last frame's inflated sweep hit the wall part way along a different segment. The camera keeps the clip radius to the wall,
+	// rather than going as far along this segment as the last one got
+	Frame.Run(TEXT("Latent hit"), 4, FVector(100.0, 0.0, 0.0), FVector(196.0, 0.0, 0.0), EStreamlineClipCorrection::ClampedToHit, FVector(190.0, 0.0, 0.0));
+
+	// moving away from the surface the last sweep hit
+	Frame.Run(TEXT("Latent hit, moving away"), 5, FVector(190.0, 0.0, 0.0), FVector(160.0, 0.0, 0.0), EStreamlineClipCorrection::ClampedToHit, FVector(160.0, 0.0, 0.0));
+
+	Frame.Run(TEXT("Below the minimum displacement"), 6, FVector(160.0, 0.0, 0.0), FVector(160.25, 0.0, 0.0), EStreamlineClipCorrection::Skipped, FVector(160.25, 0.0, 0.0));
+
+	TestEqual(TEXT("Sweeps issued"), Scene.NumAsyncSweeps, 4);
+	TestEqual(TEXT("No synchronous sweeps"), Scene.NumSweeps, 0);
+
+	return true;
+}
+
+// Fast continuous motion. Every sweep looks a frame ahead, so only the first frame has nothing to go on
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineClipCorrectionContinuousMotionTest, "Plugins.Streamline.ClipCorrection.ContinuousMotion",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineClipCorrectionContinuousMotionTest::RunTest(const FString& Parameters)
+{
+	FFakeClipCorrectionScene Scene = MakeClipCorrectionTestScene();
+	FStreamlineClipCorrection ClipCorrection;
+	const FStreamlineClipCorrectionSettings Settings = MakeClipCorrectionTestSettings(true);
+	FClipCorrectionTestFrame Frame{ *this, ClipCorrection, Scene, Settings };
+
+	const double Speed = 45.0;
+
+	// along the wall, the predicted camera gets its full 45 cm every frame after the first
+	Frame.Run(TEXT("Along the wall, first frame"), 1, FVector(0.0, 0.0, 0.0), FVector(0.0, Speed, 0.0), EStreamlineClipCorrection::ClampedToRadius, FVector(0.0, 10.0, 0.0));
+	for (uint32 FrameID = 2; FrameID <= 8; ++FrameID)
+	{
+		const FVector Start(0.0, Speed * (FrameID - 1), 0.0);
+		const FVector End(0.0, Speed * FrameID, 0.0);
+		Frame.Run(*FString::Printf(TEXT("Along the wall, frame %u"), FrameID), FrameID, Start, End, EStreamlineClipCorrection::Reused, End);
+	}
+
+	// towards the wall, the look ahead sweeps find it before the predicted camera gets there
+	ClipCorrection.Reset();
+	Frame.Run(TEXT("Towards the wall, first frame"), 11, FVector(0.0, 0.0, 0.0), FVector(45.0, 0.0, 0.0), EStreamlineClipCorrection::ClampedToRadius, FVector(10.0, 0.0, 0.0));
+	Frame.Run(TEXT("Towards the wall, second frame"), 12, FVector(45.0, 0.0, 0.0), FVector(90.0, 0.0, 0.0), EStreamlineClipCorrection::Reused, FVector(90.0, 0.0, 0.0));
+	Frame.Run(TEXT("Towards the wall, third frame"), 13, FVector(90.0, 0.0, 0.0), FVector(135.0, 0.0, 0.0), EStreamlineClipCorrection::Reused, FVector(135.0, 0.0, 0.0));
+	Frame.Run(TEXT("Towards the wall, fourth frame"), 14, FVector(135.0, 0.0, 0.0), FVector(180.0, 0.0, 0.0), EStreamlineClipCorrection::Reused, FVector(180.0, 0.0, 0.0));
+	Frame.Run(TEXT("Towards the wall, at the wall"), 15, FVector(180.0, 0.0, 0.0), FVector(225.0, 0.0, 0.0), EStreamlineClipCorrection::ClampedToHit, FVector(190.0, 0.0, 0.0));
+
+	TestEqual(TEXT("No synchronous sweeps"), Scene.NumSweeps, 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineClipCorrectionStaleTest, "Plugins.Streamline.ClipCorrection.Stale",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineClipCorrectionStaleTest::RunTest(const FString& Parameters)
+{
+	FFakeClipCorrectionScene Scene = MakeClipCorrectionTestScene();
+	FStreamlineClipCorrection ClipCorrection;
+	const FStreamlineClipCorrectionSettings Settings = MakeClipCorrectionTestSettings(true);
+	FClipCorrectionTestFrame Frame{ *this, ClipCorrection, Scene, Settings };
+
+	const FVector Start(0.0, 0.0, 0.0);
+	const FVector End(50.0, 0.0, 0.0);
+	const FVector Clamped(10.0, 0.0, 0.0);
+
+	Frame.Run(TEXT("First frame"), 10, Start, End, EStreamlineClipCorrection::ClampedToRadius, Clamped);
+	Frame.Run(TEXT("Fresh result"), 11, Start, End, EStreamlineClipCorrection::Reused, End);
+	Frame.Run(TEXT("Oldest reusable result"), 14, Start, End, EStreamlineClipCorrection::Reused, End);
+	Frame.Run(TEXT("Result older than MaxReuseFrames"), 15, Start, End, EStreamlineClipCorrection::ClampedToRadius, Clamped);
+
+	// async results that weren't picked up the frame after the sweep are lost
+	Frame.Run(TEXT("Missed result"), 17, Start, End, EStreamlineClipCorrection::ClampedToRadius, Clamped);
+
+	// results of another scene, e.g. after a level change, aren't used
+	Scene.Key = FObjectKey(GetTransientPackage());
+	Frame.Run(TEXT("Other scene"), 18, Start, End, EStreamlineClipCorrection::ClampedToRadius, Clamped);
+	Frame.Run(TEXT("Same scene again"), 19, Start, End, EStreamlineClipCorrection::Reused, End);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
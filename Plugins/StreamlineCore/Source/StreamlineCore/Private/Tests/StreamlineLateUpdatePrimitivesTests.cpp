@@ -0,0 +1,294 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineLateUpdatePrimitives.h"
+
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Templates/UniquePtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	struct FFakeLateUpdatePrimitive
+	{
+		int32 Index = INDEX_NONE;
+		int32 PersistentIndex = INDEX_NONE;
+		bool bInScene = true;
+		bool bHasProxy = true;
+		/** Part of the camera hierarchy, i.e. gathered for the late update */
+		bool bTracked = false;
+		int32 NumApplied = 0;
+	};
+
+	using FFakeLateUpdatePrimitives = TStreamlineLateUpdatePrimitives<FFakeLateUpdatePrimitive>;
+
+	// Packed indices get compacted like FScene does, moving the last primitive into the slot of a removed one. Persistent indices
+	// of removed primitives get handed out again, so a stale persistent index can resolve to another primitive
+	class FFakeLateUpdateScene final : public FFakeLateUpdatePrimitives::IScene
+	{
+	public:
+		bool bHasPersistentIndices = true;
+		mutable int64 NumLookups = 0;
+
+		FFakeLateUpdatePrimitive* AddPrimitive(bool bTracked)
+		{
+			// removed primitives stay allocated until the scene goes away, so the tracker can't get a recycled pointer
+			FFakeLateUpdatePrimitive* Primitive = Allocated.Add_GetRef(MakeUnique<FFakeLateUpdatePrimitive>()).Get();
+			Primitive->bTracked = bTracked;
+			Primitive->Index = Packed.Add(Primitive);
+			if (FreePersistentIndices.Num())
+			{
+				Primitive->PersistentIndex = FreePersistentIndices.Pop();
+				Persistent[Primitive->PersistentIndex] = Primitive;
+			}
+			else
+			{
+				Primitive->PersistentIndex = Persistent.Add(Primitive);
+			}
+			return Primitive;
+		}
+
+		void RemovePrimitive(FFakeLateUpdatePrimitive* Primitive)
+		{
+			check(Primitive->bInScene);
+			const int32 Index = Primitive->Index;
+			Packed.RemoveAtSwap(Index);
+			if (Packed.IsValidIndex(Index))
+			{
+				Packed[Index]->Index = Index;
+			}
+			Persistent[Primitive->PersistentIndex] = nullptr;
+			FreePersistentIndices.Add(Primitive->PersistentIndex);
+			Primitive->bInScene = false;
+		}
+
+		void SwapPrimitives(int32 IndexA, int32 IndexB)
+		{
+			Packed.Swap(IndexA, IndexB);
+			Packed[IndexA]->Index = IndexA;
+			Packed[IndexB]->Index = IndexB;
+		}
+
+		int32 NumPrimitives() const
+		{
+			return Packed.Num();
+		}
+
+		FFakeLateUpdatePrimitive* GetPrimitiveUnchecked(int32 Index) const
+		{
+			return Packed[Index];
+		}
+
+		// the primitives the camera hierarchy resolves to this frame
+		void Gather(FFakeLateUpdatePrimitives& Primitives) const
+		{
+			Primitives.Reset();
+			for (FFakeLateUpdatePrimitive* Primitive : Packed)
+			{
+				if (Primitive->bTracked)
+				{
+					Primitives.Add(Primitive, Primitive->Index, bHasPersistentIndices ? Primitive->PersistentIndex : INDEX_NONE);
+				}
+			}
+		}
+
+		virtual FFakeLateUpdatePrimitive* GetPrimitive(int32 Index) const override
+		{
+			++NumLookups;
+			return Packed.IsValidIndex(Index) ? Packed[Index] : nullptr;
+		}
+
+		virtual FFakeLateUpdatePrimitive* GetPrimitiveByPersistentIndex(int32 PersistentIndex) const override
+		{
+			++NumLookups;
+			return Persistent.IsValidIndex(PersistentIndex) ? Persistent[PersistentIndex] : nullptr;
+		}
+
+		virtual int32 GetIndex(FFakeLateUpdatePrimitive* Primitive) const override
+		{
+			return Primitive->Index;
+		}
+
+		virtual bool HasPersistentIndices() const override
+		{
+			return bHasPersistentIndices;
+		}
+
+		virtual bool HasProxy(FFakeLateUpdatePrimitive* Primitive) const override
+		{
+			return Primitive->bHasProxy;
+		}
+
+	private:
+		TArray<FFakeLateUpdatePrimitive*> Packed;
+		TArray<FFakeLateUpdatePrimitive*> Persistent;
+		TArray<int32> FreePersistentIndices;
+		TArray<TUniquePtr<FFakeLateUpdatePrimitive>> Allocated;
+	};
+
+	FFakeLateUpdatePrimitives::FStats UpdateFakeLateUpdatePrimitives(FFakeLateUpdatePrimitives& Primitives, const FFakeLateUpdateScene& Scene)
+	{
+		return Primitives.Update(Scene, [](FFakeLateUpdatePrimitive* Primitive)
+		{
+			++Primitive->NumApplied;
+		});
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineLateUpdatePrimitivesTest, "Plugins.Streamline.LateUpdatePrimitives.Tracking",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineLateUpdatePrimitivesTest::RunTest(const FString& Parameters)
+{
+	for (const bool bHasPersistentIndices : { true, false })
+	{
+		const TCHAR* Case = bHasPersistentIndices ? TEXT("Persistent indices") : TEXT("Scene scan");
+
+		FFakeLateUpdateScene Scene;
+		Scene.bHasPersistentIndices = bHasPersistentIndices;
+
+		TArray<FFakeLateUpdatePrimitive*> Primitives;
+		for (int32 Index = 0; Index < 8; ++Index)
+		{
+			Primitives.Add(Scene.AddPrimitive(Index == 2 || Index == 3 || Index == 5 || Index == 7));
+		}
+		Primitives[3]->bHasProxy = false;
+
+		FFakeLateUpdatePrimitives Tracked;
+		Scene.Gather(Tracked);
+		TestEqual(*FString::Printf(TEXT("%s: gathered"), Case), Tracked.Num(), 4);
+
+		// between the gather on the game thread and the late update on the render thread: the last primitive moves into the slot of
+		// the first, a tracked one goes away and a new one gets its persistent index
+		Scene.RemovePrimitive(Primitives[0]);
+		Scene.RemovePrimitive(Primitives[5]);
+		Scene.AddPrimitive(false);
+
+		const FFakeLateUpdatePrimitives::FStats Stats = UpdateFakeLateUpdatePrimitives(Tracked, Scene);
+		TestEqual(*FString::Printf(TEXT("%s: unmoved primitive applied"), Case), Primitives[2]->NumApplied, 1);
+		TestEqual(*FString::Printf(TEXT("%s: moved primitive applied"), Case), Primitives[7]->NumApplied, 1);
+		TestEqual(*FString::Printf(TEXT("%s: removed primitive not applied"), Case), Primitives[5]->NumApplied, 0);
+		TestEqual(*FString::Printf(TEXT("%s: primitive without proxy not applied"), Case), Primitives[3]->NumApplied, 0);
+		TestTrue(*FString::Printf(TEXT("%s: scene scanned only without persistent indices"), Case), Stats.bSceneScanned != bHasPersistentIndices);
+		if (bHasPersistentIndices)
+		{
+			TestEqual(*FString::Printf(TEXT("%s: patched"), Case), Stats.NumPatched, 1);
+			TestEqual(*FString::Printf(TEXT("%s: removed"), Case), Stats.NumRemoved, 1);
+			TestEqual(*FString::Printf(TEXT("%s: removed entry dropped"), Case), Tracked.Num(), 3);
+		}
+
+		// another view family of the same frame doesn't apply the late update again
+		UpdateFakeLateUpdatePrimitives(Tracked, Scene);
+		TestEqual(*FString::Printf(TEXT("%s: unmoved primitive applied once"), Case), Primitives[2]->NumApplied, 1);
+		TestEqual(*FString::Printf(TEXT("%s: moved primitive applied once"), Case), Primitives[7]->NumApplied, 1);
+	}
+
+	return true;
+}
+
+// 100k primitives with a couple of thousand in the camera hierarchy, and streaming adding, removing and reordering primitives between
+// every gather and late update. Checks every primitive still in the scene gets the late update exactly once and the removed ones none,
+// and that the tracking only looks up its own entries rather than the whole scene. The timings of the persistent index path and
+// of the scene scan fallback are logged
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineLateUpdatePrimitivesStressTest, "Plugins.Streamline.LateUpdatePrimitives.StreamingChurnStress",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FStreamlineLateUpdatePrimitivesStressTest::RunTest(const FString& Parameters)
+{
+	const int32 NumPrimitives = 100000;
+	const float TrackedFraction = 0.02f;
+	const int32 NumChurnedPerFrame = 1000;
+
+	for (const bool bHasPersistentIndices : { true, false })
+	{
+		const TCHAR* Case = bHasPersistentIndices ? TEXT("Persistent indices") : TEXT("Scene scan");
+		// the scene scan is the slow fallback, fewer frames are enough to time it
+		const int32 NumFrames = bHasPersistentIndices ? 100 : 10;
+
+		FRandomStream Random(0x5EED);
+		FFakeLateUpdateScene Scene;
+		Scene.bHasPersistentIndices = bHasPersistentIndices;
+		for (int32 Index = 0; Index < NumPrimitives; ++Index)
+		{
+			Scene.AddPrimitive(Random.FRand() < TrackedFraction);
+		}
+
+		FFakeLateUpdatePrimitives Tracked;
+		TArray<FFakeLateUpdatePrimitive*> Gathered;
+		double UpdateSeconds = 0.0;
+		int32 NumWrong = 0;
+		int32 NumScans = 0;
+		int64 NumPatched = 0;
+		int64 NumRemoved = 0;
+		int64 MaxLookupsPerEntry = 0;
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Scene.Gather(Tracked);
+			Gathered.Reset();
+			for (int32 Index = 0; Index < Scene.NumPrimitives(); ++Index)
+			{
+				if (Scene.GetPrimitiveUnchecked(Index)->bTracked)
+				{
+					Gathered.Add(Scene.GetPrimitiveUnchecked(Index));
+				}
+			}
+
+			// streaming churn between the gather and the late update
+			for (int32 Churn = 0; Churn < NumChurnedPerFrame; ++Churn)
+			{
+				Scene.RemovePrimitive(Scene.GetPrimitiveUnchecked(Random.RandHelper(Scene.NumPrimitives())));
+				Scene.AddPrimitive(Random.FRand() < TrackedFraction);
+				Scene.SwapPrimitives(Random.RandHelper(Scene.NumPrimitives()), Random.RandHelper(Scene.NumPrimitives()));
+			}
+
+			const int32 NumEntries = Tracked.Num();
+			Scene.NumLookups = 0;
+			const double StartSeconds = FPlatformTime::Seconds();
+			const FFakeLateUpdatePrimitives::FStats Stats = UpdateFakeLateUpdatePrimitives(Tracked, Scene);
+			UpdateSeconds += FPlatformTime::Seconds() - StartSeconds;
+
+			NumScans += Stats.bSceneScanned ? 1 : 0;
+			NumPatched += Stats.NumPatched;
+			NumRemoved += Stats.NumRemoved;
+			MaxLookupsPerEntry = FMath::Max(MaxLookupsPerEntry, NumEntries ? FMath::DivideAndRoundUp(Scene.NumLookups, int64(NumEntries)) : 0);
+
+			for (FFakeLateUpdatePrimitive* Primitive : Gathered)
+			{
+				NumWrong += Primitive->NumApplied != (Primitive->bInScene ? 1 : 0) ? 1 : 0;
+				Primitive->NumApplied = 0;
+			}
+		}
+
+		TestEqual(*FString::Printf(TEXT("%s: primitives with a wrong number of late updates"), Case), NumWrong, 0);
+		if (bHasPersistentIndices)
+		{
+			TestEqual(*FString::Printf(TEXT("%s: scene scans"), Case), NumScans, 0);
+			TestTrue(*FString::Printf(TEXT("%s: at most two lookups per entry (%lld)"), Case, MaxLookupsPerEntry), MaxLookupsPerEntry <= 2);
+			TestTrue(*FString::Printf(TEXT("%s: churn moved tracked primitives"), Case), NumPatched > 0);
+			TestTrue(*FString::Printf(TEXT("%s: churn removed tracked primitives"), Case), NumRemoved > 0);
+		}
+		else
+		{
+			TestEqual(*FString::Printf(TEXT("%s: scene scans"), Case), NumScans, NumFrames);
+		}
+
+		AddInfo(FString::Printf(TEXT("%s: %.3f ms per late update, %d primitives, %d churned per frame, %lld patched, %lld removed over %d frames"),
+			Case, UpdateSeconds * 1000.0 / NumFrames, NumPrimitives, NumChurnedPerFrame, NumPatched, NumRemoved, NumFrames));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
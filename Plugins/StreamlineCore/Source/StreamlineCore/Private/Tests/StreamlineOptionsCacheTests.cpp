@@ -0,0 +1,186 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineOptionsCache.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// stands in for an SL options struct: Next is a chaining pointer that doesn't take part in the comparison
+	struct FFakeStreamlineOptions
+	{
+		int32 Mode = 0;
+		float Intensity = 0.0f;
+		const void* Next = nullptr;
+	};
+
+	bool AreFakeStreamlineOptionsEquivalent(const FFakeStreamlineOptions& Opt1, const FFakeStreamlineOptions& Opt2)
+	{
+		return (Opt1.Mode == Opt2.Mode) && (Opt1.Intensity == Opt2.Intensity);
+	}
+
+	// counts the sl{Feature}SetOptions calls that would reach Streamline
+	struct FFakeStreamlineSetOptions
+	{
+		TStreamlineOptionsCache<FFakeStreamlineOptions>& Cache;
+		TMap<uint32, int32> NumCallsPerView;
+
+		void operator()(uint32 ViewID, const FFakeStreamlineOptions& Options)
+		{
+			if (Cache.ShouldSubmit(ViewID, Options))
+			{
+				++NumCallsPerView.FindOrAdd(ViewID);
+			}
+		}
+
+		int32 GetNumCalls(uint32 ViewID) const
+		{
+			return NumCallsPerView.FindRef(ViewID);
+		}
+	};
+
+	// view ids far away from the ones of real views, since those get forgotten on the RHI thread at any time
+	constexpr uint32 TestViewA = 0xfff00001;
+	constexpr uint32 TestViewB = 0xfff00002;
+
+	// forces r.Streamline.FilterRedundantSetOptionsCalls for the lifetime of the scope
+	struct FScopedFilterRedundantSetOptionsCalls
+	{
+		IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.Streamline.FilterRedundantSetOptionsCalls"));
+		bool bPreviousValue = CVar ? CVar->GetBool() : true;
+
+		explicit FScopedFilterRedundantSetOptionsCalls(bool bFilter)
+		{
+			if (CVar)
+			{
+				CVar->Set(bFilter, ECVF_SetByCode);
+			}
+		}
+
+		~FScopedFilterRedundantSetOptionsCalls()
+		{
+			if (CVar)
+			{
+				CVar->Set(bPreviousValue, ECVF_SetByCode);
+			}
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineOptionsCacheElisionTest, "Plugins.Streamline.OptionsCache.Elision",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineOptionsCacheElisionTest::RunTest(const FString& Parameters)
+{
+	FScopedFilterRedundantSetOptionsCalls FilterCalls(true);
+	if (!StreamlineFilterRedundantSetOptionsCalls())
+	{
+		AddWarning(TEXT("Redundant SetOptions calls aren't filtered due to -slnofilter, skipping"));
+		return true;
+	}
+
+	TStreamlineOptionsCache<FFakeStreamlineOptions> Cache(TEXT("Test"), &AreFakeStreamlineOptionsEquivalent);
+	FFakeStreamlineSetOptions SetOptions{ Cache };
+
+	FFakeStreamlineOptions Options;
+	Options.Mode = 1;
+	Options.Intensity = 0.5f;
+
+	SetOptions(TestViewA, Options);
+	TestEqual(TEXT("First options of a view are forwarded"), SetOptions.GetNumCalls(TestViewA), 1);
+
+	SetOptions(TestViewA, Options);
+	SetOptions(TestViewA, Options);
+	TestEqual(TEXT("Unchanged options are elided"), SetOptions.GetNumCalls(TestViewA), 1);
+
+	int32 Dummy = 0;
+	Options.Next = &Dummy;
+	SetOptions(TestViewA, Options);
+	TestEqual(TEXT("Fields outside the comparison don't matter"), SetOptions.GetNumCalls(TestViewA), 1);
+
+	Options.Intensity = 0.75f;
+	SetOptions(TestViewA, Options);
+	TestEqual(TEXT("Changed options are forwarded"), SetOptions.GetNumCalls(TestViewA), 2);
+
+	SetOptions(TestViewB, Options);
+	TestEqual(TEXT("Views are cached independently"), SetOptions.GetNumCalls(TestViewB), 1);
+	SetOptions(TestViewB, Options);
+	TestEqual(TEXT("Second view elides unchanged options"), SetOptions.GetNumCalls(TestViewB), 1);
+
+	TestEqual(TEXT("Forwarded calls are counted"), Cache.GetNumForwarded(), uint64(3));
+	TestEqual(TEXT("Elided calls are counted"), Cache.GetNumElided(), uint64(4));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineOptionsCacheForgetViewTest, "Plugins.Streamline.OptionsCache.ForgetView",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineOptionsCacheForgetViewTest::RunTest(const FString& Parameters)
+{
+	FScopedFilterRedundantSetOptionsCalls FilterCalls(true);
+	if (!StreamlineFilterRedundantSetOptionsCalls())
+	{
+		AddWarning(TEXT("Redundant SetOptions calls aren't filtered due to -slnofilter, skipping"));
+		return true;
+	}
+
+	TStreamlineOptionsCache<FFakeStreamlineOptions> PerViewCache(TEXT("TestPerView"), &AreFakeStreamlineOptionsEquivalent);
+	TStreamlineOptionsCache<FFakeStreamlineOptions> GlobalCache(TEXT("TestGlobal"), &AreFakeStreamlineOptionsEquivalent, EStreamlineOptionsCacheScope::Global);
+	FFakeStreamlineSetOptions PerViewSetOptions{ PerViewCache };
+	FFakeStreamlineSetOptions GlobalSetOptions{ GlobalCache };
+
+	const FFakeStreamlineOptions Options;
+	PerViewSetOptions(TestViewA, Options);
+	PerViewSetOptions(TestViewB, Options);
+	GlobalSetOptions(TestViewA, Options);
+
+	ForgetStreamlineOptionsCacheView(TestViewA);
+
+	PerViewSetOptions(TestViewA, Options);
+	PerViewSetOptions(TestViewB, Options);
+	GlobalSetOptions(TestViewA, Options);
+	TestEqual(TEXT("Forgotten view forwards its options again"), PerViewSetOptions.GetNumCalls(TestViewA), 2);
+	TestEqual(TEXT("Other views are unaffected"), PerViewSetOptions.GetNumCalls(TestViewB), 1);
+	TestEqual(TEXT("Global caches ignore stale views"), GlobalSetOptions.GetNumCalls(TestViewA), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineOptionsCacheNoFilterTest, "Plugins.Streamline.OptionsCache.NoFilter",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineOptionsCacheNoFilterTest::RunTest(const FString& Parameters)
+{
+	FScopedFilterRedundantSetOptionsCalls FilterCalls(false);
+	if (StreamlineFilterRedundantSetOptionsCalls())
+	{
+		AddWarning(TEXT("Redundant SetOptions calls are always filtered in this configuration, skipping"));
+		return true;
+	}
+
+	TStreamlineOptionsCache<FFakeStreamlineOptions> Cache(TEXT("Test"), &AreFakeStreamlineOptionsEquivalent);
+	FFakeStreamlineSetOptions SetOptions{ Cache };
+
+	const FFakeStreamlineOptions Options;
+	SetOptions(TestViewA, Options);
+	SetOptions(TestViewA, Options);
+	SetOptions(TestViewA, Options);
+	TestEqual(TEXT("Every call is forwarded without filtering"), SetOptions.GetNumCalls(TestViewA), 3);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,136 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineUICoverage.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	FStreamlineUICoverageHysteresis::FSettings MakeUICoverageTestSettings()
+	{
+		FStreamlineUICoverageHysteresis::FSettings Settings;
+		Settings.SuspendCoverage = 0.8f;
+		Settings.ResumeCoverage = 0.6f;
+		Settings.MinOpacity = 0.5f;
+		Settings.SuspendFrames = 3;
+		Settings.ResumeFrames = 2;
+		return Settings;
+	}
+
+	FStreamlineUICoverageSample MakeUICoverageSample(float Coverage, float AverageOpacity)
+	{
+		FStreamlineUICoverageSample Sample;
+		Sample.Coverage = Coverage;
+		Sample.AverageOpacity = AverageOpacity;
+		return Sample;
+	}
+
+	// feeds the same sample NumFrames times and checks that the suspension state only changes on the last one, if at all
+	struct FUICoverageTestFrames
+	{
+		FAutomationTestBase& Test;
+		FStreamlineUICoverageHysteresis& Hysteresis;
+		const FStreamlineUICoverageHysteresis::FSettings& Settings;
+
+		void Run(const TCHAR* What, const FStreamlineUICoverageSample& Sample, int32 NumFrames, bool bExpectedSuspended)
+		{
+			const bool bWasSuspended = Hysteresis.IsSuspended();
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				const bool bChanged = Hysteresis.Update(Sample, Settings);
+				const bool bExpectedChange = (Frame == NumFrames - 1) && (bExpectedSuspended != bWasSuspended);
+				Test.TestEqual(*FString::Printf(TEXT("%s: state change in frame %d"), What, Frame + 1), bChanged, bExpectedChange);
+			}
+			Test.TestEqual(*FString::Printf(TEXT("%s: suspended"), What), Hysteresis.IsSuspended(), bExpectedSuspended);
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineUICoverageThresholdsTest, "Plugins.Streamline.UICoverage.Thresholds",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineUICoverageThresholdsTest::RunTest(const FString& Parameters)
+{
+	FStreamlineUICoverageHysteresis Hysteresis;
+	const FStreamlineUICoverageHysteresis::FSettings Settings = MakeUICoverageTestSettings();
+	FUICoverageTestFrames Frames{ *this, Hysteresis, Settings };
+
+	Frames.Run(TEXT("Below the suspend coverage"), MakeUICoverageSample(0.79f, 1.0f), 10, false);
+	Frames.Run(TEXT("At the suspend coverage"), MakeUICoverageSample(0.8f, 1.0f), Settings.SuspendFrames, true);
+	Frames.Run(TEXT("Between resume and suspend coverage"), MakeUICoverageSample(0.7f, 1.0f), 10, true);
+	Frames.Run(TEXT("At the resume coverage"), MakeUICoverageSample(0.6f, 1.0f), 10, true);
+	Frames.Run(TEXT("Below the resume coverage"), MakeUICoverageSample(0.59f, 1.0f), Settings.ResumeFrames, false);
+	Frames.Run(TEXT("Between resume and suspend coverage after resuming"), MakeUICoverageSample(0.7f, 1.0f), 10, false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineUICoverageOpacityTest, "Plugins.Streamline.UICoverage.Opacity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineUICoverageOpacityTest::RunTest(const FString& Parameters)
+{
+	FStreamlineUICoverageHysteresis Hysteresis;
+	const FStreamlineUICoverageHysteresis::FSettings Settings = MakeUICoverageTestSettings();
+	FUICoverageTestFrames Frames{ *this, Hysteresis, Settings };
+
+	Frames.Run(TEXT("Full coverage with translucent UI"), MakeUICoverageSample(1.0f, 0.49f), 10, false);
+	Frames.Run(TEXT("Full coverage at the minimum opacity"), MakeUICoverageSample(1.0f, 0.5f), Settings.SuspendFrames, true);
+	Frames.Run(TEXT("UI fading out while still covering the viewport"), MakeUICoverageSample(1.0f, 0.49f), Settings.ResumeFrames, false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineUICoverageFrameCountsTest, "Plugins.Streamline.UICoverage.FrameCounts",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineUICoverageFrameCountsTest::RunTest(const FString& Parameters)
+{
+	FStreamlineUICoverageHysteresis Hysteresis;
+	const FStreamlineUICoverageHysteresis::FSettings Settings = MakeUICoverageTestSettings();
+	FUICoverageTestFrames Frames{ *this, Hysteresis, Settings };
+
+	const FStreamlineUICoverageSample Covered = MakeUICoverageSample(0.9f, 1.0f);
+	const FStreamlineUICoverageSample Uncovered = MakeUICoverageSample(0.1f, 1.0f);
+
+	// a single sample against the state restarts the count
+	Frames.Run(TEXT("One frame short of suspending"), Covered, Settings.SuspendFrames - 1, false);
+	Frames.Run(TEXT("Interrupted by an uncovered frame"), Uncovered, 1, false);
+	Frames.Run(TEXT("Counting again from the start"), Covered, Settings.SuspendFrames - 1, false);
+	Frames.Run(TEXT("Last frame needed to suspend"), Covered, 1, true);
+
+	Frames.Run(TEXT("One frame short of resuming"), Uncovered, Settings.ResumeFrames - 1, true);
+	Frames.Run(TEXT("Interrupted by a covered frame"), Covered, 1, true);
+	Frames.Run(TEXT("Resuming"), Uncovered, Settings.ResumeFrames, false);
+
+	// frame counts below one still need one sample
+	FStreamlineUICoverageHysteresis::FSettings ImmediateSettings = Settings;
+	ImmediateSettings.SuspendFrames = 0;
+	ImmediateSettings.ResumeFrames = 0;
+	FUICoverageTestFrames ImmediateFrames{ *this, Hysteresis, ImmediateSettings };
+	ImmediateFrames.Run(TEXT("Immediate suspend"), Covered, 1, true);
+	ImmediateFrames.Run(TEXT("Immediate resume"), Uncovered, 1, false);
+
+	// Reset drops both the state and a pending count
+	Frames.Run(TEXT("Pending suspend before reset"), Covered, Settings.SuspendFrames - 1, false);
+	Hysteresis.Reset();
+	Frames.Run(TEXT("Pending count dropped by reset"), Covered, Settings.SuspendFrames - 1, false);
+	Frames.Run(TEXT("Suspend after reset"), Covered, 1, true);
+	Hysteresis.Reset();
+	TestFalse(TEXT("Reset resumes"), Hysteresis.IsSuspended());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
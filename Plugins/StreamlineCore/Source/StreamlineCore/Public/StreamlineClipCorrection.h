@@ -0,0 +1,122 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CollisionQueryParams.h"
+#include "WorldCollision.h"
+#include "UObject/ObjectKey.h"
+
+class UWorld;
+
+/** Blocking hit of a clip correction sweep */
+struct FStreamlineClipCorrectionHit
+{
+	/** Sphere center where the sweep stopped, only meaningful for the radius the sweep used */
+	FVector Location = FVector::ZeroVector;
+	/** Contact point and surface normal, independent of the sweep radius so they can clamp segments other than the one swept */
+	FVector ImpactPoint = FVector::ZeroVector;
+	FVector ImpactNormal = FVector::UpVector;
+};
+
+/** Collision queries of the clip correction, so the logic can also run against a synthetic scene */
+class IStreamlineClipCorrectionScene
+{
+public:
+	virtual ~IStreamlineClipCorrectionScene() = default;
+
+	/** Identifies the scene, sweep results of one scene aren't used for another */
+	virtual FObjectKey GetSceneKey() const = 0;
+	/** Sphere sweep from Start to End, returns whether it hit something */
+	virtual bool Sweep(const FVector& Start, const FVector& End, float Radius, FStreamlineClipCorrectionHit& OutHit) = 0;
+	/** Issues a sphere sweep whose result gets queried in a later frame */
+	virtual FTraceHandle AsyncSweep(const FVector& Start, const FVector& End, float Radius) = 0;
+	/** Returns false if the result of the sweep isn't available, e.g. because it got issued more than a frame ago */
+	virtual bool QueryAsyncSweep(const FTraceHandle& Handle, bool& bOutHit, FStreamlineClipCorrectionHit& OutHit) = 0;
+};
+
+/** Sweeps against the ECC_Camera collision of a world */
+class FStreamlineWorldClipCorrectionScene final : public IStreamlineClipCorrectionScene
+{
+public:
+	FStreamlineWorldClipCorrectionScene(UWorld* InWorld, const FCollisionQueryParams& InCollisionParams) : World(InWorld), CollisionParams(InCollisionParams) {}
+
+	virtual FObjectKey GetSceneKey() const override;
+	virtual bool Sweep(const FVector& Start, const FVector& End, float Radius, FStreamlineClipCorrectionHit& OutHit) override;
+	virtual FTraceHandle AsyncSweep(const FVector& Start, const FVector& End, float Radius) override;
+	virtual bool QueryAsyncSweep(const FTraceHandle& Handle, bool& bOutHit, FStreamlineClipCorrectionHit& OutHit) override;
+
+private:
+	UWorld* World;
+	const FCollisionQueryParams& CollisionParams;
+};
+
+/** See the r.Streamline.Reflex.ClipRadius and r.Streamline.Reflex.ClipCorrection.* console variables */
+struct FStreamlineClipCorrectionSettings
+{
+	float ClipRadius = 10.f;
+	bool bAsync = true;
+	float MinDisplacement = 0.5f;
+	float FreeSpaceMargin = 10.f;
+	int32 MaxReuseFrames = 4;
+
+	static FStreamlineClipCorrectionSettings FromCVars();
+};
+
+enum class EStreamlineClipCorrection : uint8
+{
+	/** Displacement below MinDisplacement */
+	Skipped,
+	/** Synchronous sweep */
+	Swept,
+	/** Contained in the free space of the last sweep */
+	Reused,
+	/** Clamped against the surface the last sweep hit */
+	ClampedToHit,
+	/** Left the free space of the last sweep, clamped to where it ends */
+	ClampedToFreeSpace,
+	/** Nothing usable known about the space ahead, clamped to the clip radius */
+	ClampedToRadius,
+};
+
+/** Keeps the predicted camera from moving into geometry, using the result of last frame's async sweep for this frame. Game thread only */
+class FStreamlineClipCorrection
+{
+public:
+	/** Returns how far the camera can be moved from CameraStart towards CameraEnd */
+	FVector Apply(IStreamlineClipCorrectionScene& Scene, const FStreamlineClipCorrectionSettings& Settings, uint64 FrameID,
+		const FVector& CameraStart, const FVector& CameraEnd, EStreamlineClipCorrection* OutCorrection = nullptr);
+
+	void Reset();
+
+	/** Moves a sphere of Radius from Start towards End until it touches the plane of Hit. Moving away from the plane is not limited */
+	static FVector ClampToHitPlane(const FVector& Start, const FVector& End, float Radius, const FStreamlineClipCorrectionHit& Hit);
+
+private:
+	/** Kept around so the next frame can pick up the async result or reuse it as a free space bound */
+	struct FSweep
+	{
+		FTraceHandle Handle;
+		FObjectKey SceneKey;
+		uint64 FrameID = 0;
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		/** Larger than the clip radius so later sweeps can be contained in it */
+		float Radius = 0.f;
+		/** Whether bHit/Hit hold a result */
+		bool bHasResult = false;
+		bool bHit = false;
+		FStreamlineClipCorrectionHit Hit;
+	};
+
+	FSweep PendingSweep;
+	FSweep LastSweep;
+};
@@ -74,6 +74,13 @@ public:
 
 	static FStreamlineRHI* GetStreamlineRHI();
 private:
+	/** The part of the startup that calls into Streamline, on the first frame so it doesn't overlap with the feature probes */
+	void FinishStartup();
 
 	TSharedPtr< FStreamlineViewExtension, ESPMode::ThreadSafe> StreamlineViewExtension;
+
+	FDelegateHandle OnBeginFrameHandle;
+	bool bStartupFinished = false;
+	bool bDLSSGHooksRegistered = false;
+	bool bLatewarpHooksRegistered = false;
 };
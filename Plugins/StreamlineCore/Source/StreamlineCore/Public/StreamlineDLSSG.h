@@ -24,13 +24,54 @@ extern STREAMLINECORE_API bool IsStreamlineDLSSGSupported();
 extern STREAMLINECORE_API int32 GetStreamlineDLSSGNumFramesToGenerate();
 extern STREAMLINECORE_API void GetStreamlineDLSSGMinMaxGeneratedFrames(int32& MinGeneratedFrames, int32& MaxGeneratedFrames);
 
+// VRAM budget manager hooks, game thread
+// r.Streamline.DLSSG.VRAMEstimate, without it DLSS-FG has no footprint and isn't budgeted
+bool IsStreamlineDLSSGVRAMEstimateEnabled();
+uint64 GetStreamlineDLSSGVRAMEstimateBytes();
+bool CanReduceStreamlineDLSSGFramesToGenerateForBudget();
+bool ReduceStreamlineDLSSGFramesToGenerateForBudget();
+void RestoreStreamlineDLSSGFramesToGenerateForBudget();
+
 extern STREAMLINECORE_API void GetStreamlineDLSSGFrameTiming(float& FrameRateInHertz, int32& FramesPresented);
 
+// Pacing of the last r.Streamline.DLSSG.Pacing.HistorySize rendered frames, from the intervals between their presents.
+// Streamline doesn't report when the generated frames got presented, so their pacing isn't covered, only their share of the presented frames
+struct FStreamlineDLSSGPacingStats
+{
+	int32 NumRenderedFrames = 0;
+	// rendered and generated
+	int32 NumPresentedFrames = 0;
+	// (NumPresentedFrames - NumRenderedFrames) / NumPresentedFrames
+	float GeneratedToPresentedRatio = 0.0f;
+
+	float AverageFrameIntervalMs = 0.0f;
+	float FrameIntervalVarianceMs2 = 0.0f;
+	float FrameIntervalStdDevMs = 0.0f;
+	float MaxFrameIntervalMs = 0.0f;
+
+	float AverageRenderedFPS = 0.0f;
+	// rendered frame rate at the 99th and 99.9th percentile frame interval
+	float OnePercentLowRenderedFPS = 0.0f;
+	float PointOnePercentLowRenderedFPS = 0.0f;
+
+	// frame interval histogram, bucket i counts intervals in [i * width, (i + 1) * width), the last bucket also everything above
+	float HistogramBucketWidthMs = 0.0f;
+	TArray<int32> FrameIntervalHistogram;
+};
+
+extern STREAMLINECORE_API void GetStreamlineDLSSGPacingStats(FStreamlineDLSSGPacingStats& OutStats, bool bWithHistogram = false);
+extern STREAMLINECORE_API void ResetStreamlineDLSSGPacingStats();
+// writes one row per recorded rendered frame. An empty filename picks one in the profiling directory. Returns the filename that got written, empty on failure
+extern STREAMLINECORE_API FString DumpStreamlineDLSSGPacingToCSV(const FString& Filename = FString());
+
 
 class FRHICommandListImmediate;
 struct FRHIStreamlineArguments;
 class FSceneViewFamily;
 class FRDGBuilder;
+struct FStreamlineStateBatchView;
 void AddStreamlineDLSSGStateRenderPass(FRDGBuilder& GraphBuilder, uint32 ViewID, const FIntRect& SecondaryViewRect);
+// sets the DLSS-FG options of all views of a view family in a single pass
+void AddStreamlineDLSSGStateRenderPass(FRDGBuilder& GraphBuilder, TArray<FStreamlineStateBatchView>&& Views);
 void BeginRenderViewFamilyDLSSG(FSceneViewFamily& InViewFamily);
 void GetDLSSGStatusFromStreamline(bool bQueryOncePerAppLifetimeValues = false);
\ No newline at end of file
@@ -20,6 +20,11 @@ bool IsDeepDVCActive();
 extern STREAMLINECORE_API Streamline::EStreamlineFeatureSupport QueryStreamlineDeepDVCSupport();
 extern STREAMLINECORE_API bool IsStreamlineDeepDVCSupported();
 
+// VRAM budget manager hooks, game thread
+uint64 GetStreamlineDeepDVCVRAMEstimateBytes();
+bool IsStreamlineDeepDVCSuspendedByBudget();
+void SetStreamlineDeepDVCSuspendedByBudget(bool bSuspended);
+
 
 
 class FRHICommandListImmediate;
@@ -0,0 +1,61 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Features whose resources the hibernation policy manages after they get turned off
+enum class EStreamlineHibernationFeature : uint8
+{
+	DLSSG,
+	Latewarp,
+	DeepDVC,
+	Num
+};
+
+struct FStreamlineHibernationSettings
+{
+	// how long resources are kept after the feature got turned off. < 0 keeps them until the feature gets turned on again, 0 (the default) leaves them to the feature as without the policy
+	float GracePeriodSeconds = 0.0f;
+	// release hibernating resources early when VRAM gets tight or the engine asks to trim memory
+	bool bReleaseOnMemoryPressure = true;
+};
+
+struct FStreamlineHibernationStats
+{
+	// feature got turned on again while its resources were still around
+	int32 HitchesAvoided = 0;
+	// feature got turned on again after its resources had been released
+	int32 Reallocations = 0;
+	int32 GracePeriodReleases = 0;
+	int32 MemoryPressureReleases = 0;
+	int32 Prewarms = 0;
+	// number of views whose resources are currently kept while the feature is off
+	int32 NumHibernatingViews = 0;
+};
+
+// game thread
+extern STREAMLINECORE_API void SetStreamlineHibernationSettings(EStreamlineHibernationFeature Feature, const FStreamlineHibernationSettings& Settings);
+// go back to the r.Streamline.Hibernation.* defaults
+extern STREAMLINECORE_API void ResetStreamlineHibernationSettings(EStreamlineHibernationFeature Feature);
+extern STREAMLINECORE_API FStreamlineHibernationSettings GetStreamlineHibernationSettings(EStreamlineHibernationFeature Feature);
+extern STREAMLINECORE_API FStreamlineHibernationStats GetStreamlineHibernationStats(EStreamlineHibernationFeature Feature);
+// allocates released resources ahead of a known re-enable (e.g. from a level sequence event right before a cut that turns the feature on) and restarts the grace period
+extern STREAMLINECORE_API void PrewarmStreamlineHibernatingFeature(EStreamlineHibernationFeature Feature);
+
+// render thread, called every frame for every view the feature could run on. Returns whether resources should be kept while the feature is off
+bool UpdateStreamlineHibernation(EStreamlineHibernationFeature Feature, uint32 ViewID, bool bIsEnabled, bool bForceRetain = false);
+void ForgetStreamlineHibernationView(uint32 ViewID);
+// releases all hibernating resources on the next update, as if the engine had broadcast a memory trim
+void RequestStreamlineHibernationMemoryTrim();
+
+void RegisterStreamlineHibernationHooks();
+void UnregisterStreamlineHibernationHooks();
@@ -0,0 +1,158 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Primitives the late update transform gets applied to. The packed scene index of a primitive changes whenever the scene compacts,
+ * which streaming does most frames, so entries also remember the persistent index to find their primitive again without scanning
+ * the whole scene. Templated on the primitive so the tracking can also run against a synthetic scene
+ */
+template<typename PrimitiveType>
+class TStreamlineLateUpdatePrimitives
+{
+public:
+	/** Scene lookups of the tracking */
+	class IScene
+	{
+	public:
+		virtual ~IScene() = default;
+
+		/** Primitive at a packed scene index, nullptr past the last one */
+		virtual PrimitiveType* GetPrimitive(int32 Index) const = 0;
+		/** Primitive at a persistent index, nullptr if it isn't in the scene anymore. Only called if HasPersistentIndices */
+		virtual PrimitiveType* GetPrimitiveByPersistentIndex(int32 PersistentIndex) const = 0;
+		/** Current packed index of a primitive that is in the scene */
+		virtual int32 GetIndex(PrimitiveType* Primitive) const = 0;
+		/** Without persistent indices, a changed index falls back to scanning the whole scene */
+		virtual bool HasPersistentIndices() const = 0;
+		/** Whether the primitive has a scene proxy the late update can be applied to */
+		virtual bool HasProxy(PrimitiveType* Primitive) const = 0;
+	};
+
+	/** What one Update did, for the Streamline Camera stats */
+	struct FStats
+	{
+		int32 NumPatched = 0;
+		int32 NumRemoved = 0;
+		bool bSceneScanned = false;
+	};
+
+	void Reset()
+	{
+		Primitives.Reset();
+	}
+
+	void Reserve(int32 Number)
+	{
+		Primitives.Reserve(Number);
+	}
+
+	int32 Num() const
+	{
+		return Primitives.Num();
+	}
+
+	void Add(PrimitiveType* Primitive, int32 Index, int32 PersistentIndex)
+	{
+		FPrimitive Entry;
+		Entry.Index = Index;
+		Entry.PersistentIndex = PersistentIndex;
+		Primitives.Emplace(Primitive, Entry);
+	}
+
+	/**
+	 * Calls Apply(Primitive) for every tracked primitive that is still in the scene and has a proxy, once per gather even if this gets
+	 * called for several view families. Entries whose index changed get patched in place, the ones of removed primitives are dropped
+	 */
+	template<typename ApplyType>
+	FStats Update(const IScene& Scene, ApplyType&& Apply)
+	{
+		FStats Stats;
+		bool bIndicesHaveChanged = false;
+
+		for (auto PrimitiveIt = Primitives.CreateIterator(); PrimitiveIt; ++PrimitiveIt)
+		{
+			PrimitiveType* CachedPrimitive = PrimitiveIt.Key();
+			FPrimitive& Primitive = PrimitiveIt.Value();
+
+			if (Primitive.bProcessed)
+			{
+				continue;
+			}
+
+			PrimitiveType* RetrievedPrimitive = Scene.GetPrimitive(Primitive.Index);
+
+			// If the retrieved primitive is different than our cached one then the scene has changed in the meantime.
+			// Rather than scanning the whole scene we look the primitive up again by its persistent index and only patch this entry
+			if (CachedPrimitive != RetrievedPrimitive)
+			{
+				if (!Scene.HasPersistentIndices())
+				{
+					bIndicesHaveChanged = true;
+					break; // No need to continue here, as we are going to brute force the scene primitives below anyway.
+				}
+
+				RetrievedPrimitive = Primitive.PersistentIndex != INDEX_NONE ? Scene.GetPrimitiveByPersistentIndex(Primitive.PersistentIndex) : nullptr;
+				if (CachedPrimitive != RetrievedPrimitive)
+				{
+					// The primitive got removed from the scene, don't touch the stale pointer
+					PrimitiveIt.RemoveCurrent();
+					++Stats.NumRemoved;
+					continue;
+				}
+
+				Primitive.Index = Scene.GetIndex(CachedPrimitive);
+				++Stats.NumPatched;
+			}
+
+			if (Scene.HasProxy(CachedPrimitive))
+			{
+				Apply(CachedPrimitive);
+				Primitive.bProcessed = true;
+			}
+		}
+
+		// Indices have changed and we can't look primitives up by persistent index, so we need to scan the entire scene for primitives that might still exist
+		if (bIndicesHaveChanged)
+		{
+			Stats.bSceneScanned = true;
+
+			int32 Index = 0;
+			for (PrimitiveType* RetrievedPrimitive = Scene.GetPrimitive(Index); RetrievedPrimitive; RetrievedPrimitive = Scene.GetPrimitive(++Index))
+			{
+				FPrimitive* Primitive = Scene.HasProxy(RetrievedPrimitive) ? Primitives.Find(RetrievedPrimitive) : nullptr;
+				if (Primitive && !Primitive->bProcessed)
+				{
+					Primitive->Index = Index;
+					Apply(RetrievedPrimitive);
+					Primitive->bProcessed = true;
+				}
+			}
+		}
+
+		return Stats;
+	}
+
+private:
+	struct FPrimitive
+	{
+		/** Packed scene index at the time the primitive was gathered, patched in place when the scene compacts */
+		int32 Index = INDEX_NONE;
+		/** Stable across scene index churn, used to find the primitive again without scanning the whole scene */
+		int32 PersistentIndex = INDEX_NONE;
+		/** Set once the late update transform has been applied this frame */
+		bool bProcessed = false;
+	};
+
+	TMap<PrimitiveType*, FPrimitive> Primitives;
+};
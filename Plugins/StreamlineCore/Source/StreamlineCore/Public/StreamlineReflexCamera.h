@@ -15,6 +15,10 @@
 #include "Misc/CoreMisc.h"
 #include "Tickable.h"
 #include "CollisionQueryParams.h"
+#include "WorldCollision.h"
+#include "UObject/ObjectKey.h"
+#include "StreamlineClipCorrection.h"
+#include "StreamlineLateUpdatePrimitives.h"
 #include "Windows/WindowsApplication.h"
 #include "Performance/MaxTickRateHandlerModule.h"
 #include "Performance/LatencyMarkerModule.h"
@@ -27,13 +31,17 @@ class FStreamlineCameraManager
 {
 public:
 	FStreamlineCameraManager() : PrevRenderedWorldToView(FMatrix::Identity), PrevRenderedViewToClip(FMatrix::Identity) {}
+	~FStreamlineCameraManager();
 	void SetCameraData(const FSceneView& InView, uint64 FrameID);
 	void LateUpdate_GameThread(const APlayerController* Player, uint64 FrameID);
 	void PreRenderViewFamily_RenderThread(FSceneViewFamily& InViewFamily, uint64 FrameID);
 	void PreRenderView_RenderThread(FSceneView& InView, uint64 FrameID);
 	void PostRenderView_RenderThread(FSceneView& InView, uint64 FrameID);
 private:
-	void CacheSceneInfo(int64 FrameID, USceneComponent* Component, FCollisionQueryParams& CollisionParams);
+	struct FLateUpdateComponentCache;
+
+	void CacheSceneInfo(FLateUpdateComponentCache& Cache, USceneComponent* Component);
+	void RebuildLateUpdateComponentCache(FLateUpdateComponentCache& Cache, USceneComponent* ParentComponent);
 	void GatherLateUpdatePrimitives(int64 FrameID, USceneComponent* ParentComponent, FCollisionQueryParams& CollisionParams);
 	void LateUpdate_RenderThread(FSceneInterface* Scene, uint64 FrameID, const FMatrix& LateUpdateTransform);
 
@@ -42,7 +50,7 @@ private:
 		/** Frame ID for tracking */
 		int64 FrameID;
 		/** Primitives that need late update before rendering */
-		TMap<FPrimitiveSceneInfo*, int32> Primitives;
+		TStreamlineLateUpdatePrimitives<FPrimitiveSceneInfo> Primitives;
 		/** Collision parameters for late update clip prevention */
 		FCollisionQueryParams CollisionParams;
 		UWorld* World;
@@ -50,6 +58,19 @@ private:
 		FMatrix UpdatedWorldToView, UpdatedViewToClip;
 	};
 
+	/** Flattened attachment hierarchy of a camera owner, so we don't need to walk and cast the whole hierarchy every frame */
+	struct FLateUpdateComponentCache
+	{
+		/** Scene components of the hierarchy, used to detect attach/detach by hashing their attach children */
+		TArray<TWeakObjectPtr<USceneComponent>> SceneComponents;
+		/** Primitive components of the hierarchy, their scene proxies are resolved per frame since render state can get recreated */
+		TArray<TWeakObjectPtr<UPrimitiveComponent>> PrimitiveComponents;
+		/** Hash over the attach children of all scene components at the time of the last rebuild */
+		uint32 HierarchyHash = 0;
+		/** Value of the global component registration counter at the time of the last rebuild */
+		uint32 RegistrationGeneration = 0;
+	};
+
 	struct FViewPredictionData
 	{
 		int64 FrameID;
@@ -65,6 +86,13 @@ private:
 	FLateUpdateState UpdateStates[FramesInFlight];
 
 	FViewPredictionData ViewPredictionData[2];
+
+	FStreamlineClipCorrection ClipCorrection;
+
+	/** Late update component caches, keyed by the root component of the camera owner */
+	TMap<TObjectKey<USceneComponent>, FLateUpdateComponentCache> LateUpdateComponentCaches;
 };
 
 bool DoesFeatureUseCameraData();
+// removes the engine delegates the camera managers registered, at module shutdown
+void UnregisterStreamlineReflexCameraHooks();
@@ -32,6 +32,7 @@ THIRD_PARTY_INCLUDES_END
 #include "StreamlineAPI.h"
 #include "StreamlineConversions.h"
 #include "StreamlineRHI.h"
+#include "StreamlineTrace.h"
 
 #include "sl.h"
 #include "sl_dlss_g.h"
@@ -185,6 +186,7 @@ public:
 
 	virtual void TagTextures(FRHICommandList& CmdList, uint32 InViewID, const sl::FrameToken& FrameToken, const TArrayView<const FRHIStreamlineResource> InResources) final
 	{
+		TRACE_STREAMLINE_TAG(uint32(FrameToken), InViewID, InResources);
 
 #if ENGINE_PROVIDES_ID3D11DYNAMICRHI
 		void* NativeCmdBuffer = D3D11RHI->RHIGetDeviceContext();
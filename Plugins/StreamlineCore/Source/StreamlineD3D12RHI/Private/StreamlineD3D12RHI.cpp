@@ -61,6 +61,7 @@ struct FShaderCodePackedResourceCounts;
 #include "StreamlineAPI.h"
 #include "StreamlineConversions.h"
 #include "StreamlineRHI.h"
+#include "StreamlineTrace.h"
 #include "sl.h"
 #include "sl_dlss_g.h"
 
@@ -358,6 +359,8 @@ public:
 			return;
 		}
 
+		TRACE_STREAMLINE_TAG(uint32(FrameToken), InViewID, InResources);
+
 #if ENGINE_PROVIDES_UE_5_6_ID3D12DYNAMICRHI_METHODS
 		for (const FRHIStreamlineResource& Resource : InResources)
 		{
@@ -0,0 +1,69 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "CoreMinimal.h"
+#include "Features/IModularFeatures.h"
+#include "Modules/ModuleManager.h"
+#include "TraceServices/ModuleService.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+#include "StreamlineTimingViewExtender.h"
+#include "StreamlineTraceAnalyzer.h"
+#include "StreamlineTraceProvider.h"
+
+class FStreamlineTraceModule : public TraceServices::IModule
+{
+public:
+	virtual void GetModuleInfo(TraceServices::FModuleInfo& OutModuleInfo) override
+	{
+		OutModuleInfo.Name = TEXT("StreamlineTrace");
+		OutModuleInfo.DisplayName = TEXT("Streamline");
+	}
+
+	virtual void OnAnalysisBegin(TraceServices::IAnalysisSession& InSession) override
+	{
+		TSharedPtr<FStreamlineTraceProvider> Provider = MakeShared<FStreamlineTraceProvider>(InSession);
+		InSession.AddProvider(FStreamlineTraceProvider::ProviderName, Provider);
+		InSession.AddAnalyzer(new FStreamlineTraceAnalyzer(InSession, *Provider));
+	}
+
+	virtual void GetLoggers(TArray<const TCHAR*>& OutLoggers) override
+	{
+		OutLoggers.Add(TEXT("Streamline"));
+		OutLoggers.Add(TEXT("NGX"));
+	}
+
+	virtual void GenerateReports(const TraceServices::IAnalysisSession& Session, const TCHAR* CmdLine, const TCHAR* OutputDirectory) override
+	{
+	}
+};
+
+class FStreamlineInsightsModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override
+	{
+		IModularFeatures::Get().RegisterModularFeature(TraceServices::ModuleFeatureName, &TraceModule);
+		IModularFeatures::Get().RegisterModularFeature(StreamlineInsightsTiming::TimingViewExtenderFeatureName, &TimingViewExtender);
+	}
+
+	virtual void ShutdownModule() override
+	{
+		IModularFeatures::Get().UnregisterModularFeature(StreamlineInsightsTiming::TimingViewExtenderFeatureName, &TimingViewExtender);
+		IModularFeatures::Get().UnregisterModularFeature(TraceServices::ModuleFeatureName, &TraceModule);
+	}
+
+private:
+	FStreamlineTraceModule TraceModule;
+	FStreamlineTimingViewExtender TimingViewExtender;
+};
+
+IMPLEMENT_MODULE(FStreamlineInsightsModule, StreamlineInsights)
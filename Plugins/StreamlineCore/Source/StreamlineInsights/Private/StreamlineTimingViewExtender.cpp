@@ -0,0 +1,127 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineTimingViewExtender.h"
+
+#include "Insights/ITimingViewSession.h"
+#include "Insights/ViewModels/TimingTrackViewport.h"
+#include "Insights/ViewModels/ITimingViewDrawHelper.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+INSIGHTS_IMPLEMENT_RTTI(FStreamlineTimingTrack)
+
+static const TCHAR* GetStreamlineTrackName(EStreamlineTraceTrack Track)
+{
+	switch (Track)
+	{
+	case EStreamlineTraceTrack::ReflexMarkers:    return TEXT("Streamline Reflex Markers");
+	case EStreamlineTraceTrack::FrameTokens:      return TEXT("Streamline Frame Tokens");
+	case EStreamlineTraceTrack::TagsAndConstants: return TEXT("Streamline Constants / Tags");
+	case EStreamlineTraceTrack::Evaluate:         return TEXT("Streamline Evaluate");
+	case EStreamlineTraceTrack::Present:          return TEXT("Streamline Present (DLSS-FG / Latewarp)");
+	case EStreamlineTraceTrack::DLSSFeatures:     return TEXT("DLSS Features");
+	default:                                      return TEXT("Streamline");
+	}
+}
+
+static uint32 GetStreamlineEventColor(const FStreamlineTraceEvent& Event)
+{
+	// ARGB, roughly NVIDIA green for the features, distinct hues for the bookkeeping calls
+	switch (Event.Type)
+	{
+	case EStreamlineTraceEventType::FrameToken:   return 0xFF808080;
+	case EStreamlineTraceEventType::ReflexMarker: return 0xFF4A90D9;
+	case EStreamlineTraceEventType::Tag:          return 0xFFD9A84A;
+	case EStreamlineTraceEventType::Constants:    return 0xFFB07CD9;
+	case EStreamlineTraceEventType::Evaluate:     return 0xFF76B900;
+	case EStreamlineTraceEventType::Present:      return 0xFF5A8F00;
+	case EStreamlineTraceEventType::DLSSFeature:  return Event.EndTime < 0.0 ? 0xFF76B900 : 0xFF3D6000;
+	default:                                      return 0xFFFFFFFF;
+	}
+}
+
+FStreamlineTimingTrack::FStreamlineTimingTrack(const TraceServices::IAnalysisSession& InSession, const FStreamlineTraceProvider& InProvider, EStreamlineTraceTrack InTrack, const FString& InName)
+	: FTimingEventsTrack(InName)
+	, Session(InSession)
+	, Provider(InProvider)
+	, Track(InTrack)
+{
+}
+
+void FStreamlineTimingTrack::BuildDrawState(ITimingEventsTrackDrawStateBuilder& Builder, const ITimingTrackUpdateContext& Context)
+{
+	const FTimingTrackViewport& Viewport = Context.GetViewport();
+
+	TraceServices::FAnalysisSessionReadScope SessionReadScope(Session);
+
+	Provider.EnumerateEvents(Track, Viewport.GetStartTime(), Viewport.GetEndTime(), [this, &Builder](const FStreamlineTraceEvent& Event, double EndTime)
+	{
+		Builder.AddEvent(Event.StartTime, EndTime, Event.Depth, GetStreamlineEventColor(Event),
+			[this, &Event](float) { return Provider.GetEventName(Event); });
+	});
+}
+
+void FStreamlineTimingViewExtender::OnBeginSession(StreamlineInsightsTiming::ITimingViewSession& InSession)
+{
+	PerSessionDataMap.Add(&InSession);
+}
+
+void FStreamlineTimingViewExtender::OnEndSession(StreamlineInsightsTiming::ITimingViewSession& InSession)
+{
+	if (FPerSessionData* PerSessionData = PerSessionDataMap.Find(&InSession))
+	{
+		for (TSharedPtr<FStreamlineTimingTrack>& Track : PerSessionData->Tracks)
+		{
+			if (Track.IsValid())
+			{
+				InSession.RemoveScrollableTrack(Track);
+			}
+		}
+	}
+	PerSessionDataMap.Remove(&InSession);
+}
+
+void FStreamlineTimingViewExtender::Tick(StreamlineInsightsTiming::ITimingViewSession& InSession, const TraceServices::IAnalysisSession& InAnalysisSession)
+{
+	FPerSessionData* PerSessionData = PerSessionDataMap.Find(&InSession);
+	if (!PerSessionData)
+	{
+		return;
+	}
+
+	TraceServices::FAnalysisSessionReadScope SessionReadScope(InAnalysisSession);
+
+	const FStreamlineTraceProvider* Provider = InAnalysisSession.ReadProvider<FStreamlineTraceProvider>(FStreamlineTraceProvider::ProviderName);
+	if (!Provider || Provider->GetChangeNumber() == PerSessionData->LastChangeNumber)
+	{
+		return;
+	}
+	PerSessionData->LastChangeNumber = Provider->GetChangeNumber();
+
+	for (uint32 TrackIndex = 0; TrackIndex < uint32(EStreamlineTraceTrack::Num); ++TrackIndex)
+	{
+		const EStreamlineTraceTrack TrackType = EStreamlineTraceTrack(TrackIndex);
+		TSharedPtr<FStreamlineTimingTrack>& Track = PerSessionData->Tracks[TrackIndex];
+
+		// only show tracks for what the traced application actually used, e.g. no DLSS features track without the DLSS plugin
+		if (!Track.IsValid() && Provider->HasEvents(TrackType))
+		{
+			Track = MakeShared<FStreamlineTimingTrack>(InAnalysisSession, *Provider, TrackType, GetStreamlineTrackName(TrackType));
+			InSession.AddScrollableTrack(Track);
+		}
+
+		if (Track.IsValid())
+		{
+			// live sessions keep adding events, so the cached draw state needs to be rebuilt
+			Track->SetDirtyFlag();
+		}
+	}
+}
@@ -0,0 +1,57 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Insights/ITimingViewExtender.h"
+#include "Insights/ViewModels/TimingEventsTrack.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+#include "StreamlineTraceProvider.h"
+
+#if (ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 5)
+namespace StreamlineInsightsTiming = UE::Insights::Timing;
+#else
+namespace StreamlineInsightsTiming = Insights;
+#endif
+
+class FStreamlineTimingTrack : public FTimingEventsTrack
+{
+	INSIGHTS_DECLARE_RTTI(FStreamlineTimingTrack, FTimingEventsTrack)
+
+public:
+	FStreamlineTimingTrack(const TraceServices::IAnalysisSession& InSession, const FStreamlineTraceProvider& InProvider, EStreamlineTraceTrack InTrack, const FString& InName);
+
+	virtual void BuildDrawState(ITimingEventsTrackDrawStateBuilder& Builder, const ITimingTrackUpdateContext& Context) override;
+
+private:
+	const TraceServices::IAnalysisSession& Session;
+	const FStreamlineTraceProvider& Provider;
+	EStreamlineTraceTrack Track;
+};
+
+// Adds one Streamline track per EStreamlineTraceTrack to the timing view, next to the CPU and GPU tracks, once the trace has such events
+class FStreamlineTimingViewExtender : public StreamlineInsightsTiming::ITimingViewExtender
+{
+public:
+	virtual void OnBeginSession(StreamlineInsightsTiming::ITimingViewSession& InSession) override;
+	virtual void OnEndSession(StreamlineInsightsTiming::ITimingViewSession& InSession) override;
+	virtual void Tick(StreamlineInsightsTiming::ITimingViewSession& InSession, const TraceServices::IAnalysisSession& InAnalysisSession) override;
+
+private:
+	struct FPerSessionData
+	{
+		TSharedPtr<FStreamlineTimingTrack> Tracks[uint32(EStreamlineTraceTrack::Num)];
+		uint32 LastChangeNumber = 0;
+	};
+
+	TMap<StreamlineInsightsTiming::ITimingViewSession*, FPerSessionData> PerSessionDataMap;
+};
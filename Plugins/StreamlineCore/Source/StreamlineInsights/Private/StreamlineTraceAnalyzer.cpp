@@ -0,0 +1,125 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineTraceAnalyzer.h"
+#include "StreamlineTraceProvider.h"
+
+#include "TraceServices/Model/AnalysisSession.h"
+
+// matches EStreamlineTraceScope in StreamlineTrace.h
+enum class EStreamlineTraceScopeType : uint8
+{
+	Evaluate,
+	Present,
+};
+
+FStreamlineTraceAnalyzer::FStreamlineTraceAnalyzer(TraceServices::IAnalysisSession& InSession, FStreamlineTraceProvider& InProvider)
+	: Session(InSession)
+	, Provider(InProvider)
+{
+}
+
+void FStreamlineTraceAnalyzer::OnAnalysisBegin(const FOnAnalysisContext& Context)
+{
+	FInterfaceBuilder& Builder = Context.InterfaceBuilder;
+
+	Builder.RouteEvent(RouteId_FrameToken, "Streamline", "FrameToken");
+	Builder.RouteEvent(RouteId_ReflexMarker, "Streamline", "ReflexMarker");
+	Builder.RouteEvent(RouteId_Tag, "Streamline", "Tag");
+	Builder.RouteEvent(RouteId_Constants, "Streamline", "Constants");
+	Builder.RouteEvent(RouteId_Scope, "Streamline", "Scope");
+	Builder.RouteEvent(RouteId_NGXFeatureCreate, "NGX", "FeatureCreate");
+	Builder.RouteEvent(RouteId_NGXFeatureEvict, "NGX", "FeatureEvict");
+}
+
+bool FStreamlineTraceAnalyzer::OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context)
+{
+	TraceServices::FAnalysisSessionEditScope _(Session);
+
+	const FEventData& EventData = Context.EventData;
+
+	switch (RouteId)
+	{
+	case RouteId_FrameToken:
+	{
+		FStreamlineTraceEvent Event;
+		Event.StartTime = Event.EndTime = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+		Event.Frame = EventData.GetValue<uint64>("FrameCounter");
+		Event.Payload = EventData.GetValue<uint32>("FrameIndex");
+		Event.Type = EStreamlineTraceEventType::FrameToken;
+		Provider.AddEvent(EStreamlineTraceTrack::FrameTokens, Event);
+		Session.UpdateDurationSeconds(Event.EndTime);
+		break;
+	}
+	case RouteId_ReflexMarker:
+	{
+		FStreamlineTraceEvent Event;
+		Event.StartTime = Event.EndTime = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+		Event.Frame = EventData.GetValue<uint32>("FrameIndex");
+		Event.Payload = EventData.GetValue<uint32>("Marker");
+		Event.Type = EStreamlineTraceEventType::ReflexMarker;
+		Provider.AddEvent(EStreamlineTraceTrack::ReflexMarkers, Event);
+		Session.UpdateDurationSeconds(Event.EndTime);
+		break;
+	}
+	case RouteId_Tag:
+	case RouteId_Constants:
+	{
+		const bool bIsTag = RouteId == RouteId_Tag;
+		FStreamlineTraceEvent Event;
+		Event.StartTime = Event.EndTime = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+		Event.Frame = EventData.GetValue<uint32>("FrameIndex");
+		Event.ViewId = EventData.GetValue<uint32>("ViewId");
+		Event.Payload = bIsTag ? EventData.GetValue<uint32>("ResourceMask") : 0;
+		// constants and tags of a view share the track, one row each
+		Event.Depth = bIsTag ? 1 : 0;
+		Event.Type = bIsTag ? EStreamlineTraceEventType::Tag : EStreamlineTraceEventType::Constants;
+		Provider.AddEvent(EStreamlineTraceTrack::TagsAndConstants, Event);
+		Session.UpdateDurationSeconds(Event.EndTime);
+		break;
+	}
+	case RouteId_Scope:
+	{
+		const bool bIsPresent = EventData.GetValue<uint8>("Type") == uint8(EStreamlineTraceScopeType::Present);
+		FStreamlineTraceEvent Event;
+		Event.StartTime = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("StartCycle"));
+		Event.EndTime = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("EndCycle"));
+		Event.Frame = EventData.GetValue<uint64>("Frame");
+		Event.Payload = EventData.GetValue<uint32>("Feature");
+		Event.ViewId = EventData.GetValue<uint32>("ViewId");
+		Event.Type = bIsPresent ? EStreamlineTraceEventType::Present : EStreamlineTraceEventType::Evaluate;
+		Provider.AddEvent(bIsPresent ? EStreamlineTraceTrack::Present : EStreamlineTraceTrack::Evaluate, Event);
+		Session.UpdateDurationSeconds(Event.EndTime);
+		break;
+	}
+	case RouteId_NGXFeatureCreate:
+	{
+		const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+		FStreamlineTraceDLSSFeatureDesc Desc;
+		Desc.SrcSize = FIntPoint(EventData.GetValue<int32>("SrcWidth"), EventData.GetValue<int32>("SrcHeight"));
+		Desc.DestSize = FIntPoint(EventData.GetValue<int32>("DestWidth"), EventData.GetValue<int32>("DestHeight"));
+		Desc.PerfQuality = EventData.GetValue<int32>("PerfQuality");
+		Desc.DenoiserMode = EventData.GetValue<uint8>("DenoiserMode");
+		Provider.BeginDLSSFeature(EventData.GetValue<uint64>("FeatureId"), Time, EventData.GetValue<uint32>("FrameCounter"), Desc);
+		Session.UpdateDurationSeconds(Time);
+		break;
+	}
+	case RouteId_NGXFeatureEvict:
+	{
+		const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+		Provider.EndDLSSFeature(EventData.GetValue<uint64>("FeatureId"), Time);
+		Session.UpdateDurationSeconds(Time);
+		break;
+	}
+	}
+
+	return true;
+}
@@ -0,0 +1,42 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Analyzer.h"
+
+namespace TraceServices { class IAnalysisSession; }
+class FStreamlineTraceProvider;
+
+// Consumes the "Streamline" (StreamlineTrace.cpp) and "NGX" (NGXRHI.cpp) trace loggers
+class FStreamlineTraceAnalyzer : public UE::Trace::IAnalyzer
+{
+public:
+	FStreamlineTraceAnalyzer(TraceServices::IAnalysisSession& InSession, FStreamlineTraceProvider& InProvider);
+
+	virtual void OnAnalysisBegin(const FOnAnalysisContext& Context) override;
+	virtual bool OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context) override;
+
+private:
+	enum : uint16
+	{
+		RouteId_FrameToken,
+		RouteId_ReflexMarker,
+		RouteId_Tag,
+		RouteId_Constants,
+		RouteId_Scope,
+		RouteId_NGXFeatureCreate,
+		RouteId_NGXFeatureEvict,
+	};
+
+	TraceServices::IAnalysisSession& Session;
+	FStreamlineTraceProvider& Provider;
+};
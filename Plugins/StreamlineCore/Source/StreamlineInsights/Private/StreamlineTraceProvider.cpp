@@ -0,0 +1,156 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineTraceProvider.h"
+
+#include "sl.h"
+#include "sl_helpers.h"
+
+const FName FStreamlineTraceProvider::ProviderName(TEXT("StreamlineTraceProvider"));
+
+// matches EStreamlineResource in StreamlineRHI.h, which this module intentionally doesn't depend on
+static const TCHAR* const GStreamlineResourceNames[] =
+{
+	TEXT("Depth"),
+	TEXT("MotionVectors"),
+	TEXT("NoWarpMask"),
+	TEXT("HUDLessColor"),
+	TEXT("UIColorAndAlpha"),
+	TEXT("Backbuffer"),
+	TEXT("ScalingOutputColor"),
+};
+
+FStreamlineTraceProvider::FStreamlineTraceProvider(TraceServices::IAnalysisSession& InSession)
+	: Session(InSession)
+{
+}
+
+void FStreamlineTraceProvider::AddEvent(EStreamlineTraceTrack Track, const FStreamlineTraceEvent& Event)
+{
+	Session.WriteAccessCheck();
+
+	FTrackData& Data = Tracks[uint32(Track)];
+
+	// events from the game, render and RHI threads can arrive slightly out of order, so keep the array sorted
+	if (Data.Events.Num() == 0 || Data.Events.Last().StartTime <= Event.StartTime)
+	{
+		Data.Events.Add(Event);
+	}
+	else
+	{
+		const int32 InsertIndex = Algo::UpperBoundBy(Data.Events, Event.StartTime, [](const FStreamlineTraceEvent& Existing) { return Existing.StartTime; });
+		Data.Events.Insert(Event, InsertIndex);
+	}
+
+	Data.MaxDuration = FMath::Max(Data.MaxDuration, Event.EndTime - Event.StartTime);
+	Data.MaxDepth = FMath::Max(Data.MaxDepth, Event.Depth);
+	++ChangeNumber;
+}
+
+void FStreamlineTraceProvider::BeginDLSSFeature(uint64 FeatureId, double Time, uint64 Frame, const FStreamlineTraceDLSSFeatureDesc& Desc)
+{
+	Session.WriteAccessCheck();
+
+	// the feature id is the address of the NGX feature object, which can get reused after the previous one got evicted
+	EndDLSSFeature(FeatureId, Time);
+
+	// features that are alive at the same time get stacked on separate rows
+	int32 Depth = UsedDLSSFeatureDepths.Find(false);
+	if (Depth == INDEX_NONE)
+	{
+		Depth = UsedDLSSFeatureDepths.Add(true);
+	}
+	else
+	{
+		UsedDLSSFeatureDepths[Depth] = true;
+	}
+
+	FStreamlineTraceEvent Event;
+	Event.StartTime = Time;
+	Event.EndTime = -1.0;
+	Event.Frame = Frame;
+	Event.Payload = DLSSFeatureDescs.Add(Desc);
+	Event.Depth = Depth;
+	Event.Type = EStreamlineTraceEventType::DLSSFeature;
+
+	// NGX creates and evicts features on the RHI thread only, so these arrive in order and the indices in OpenDLSSFeatures stay stable
+	FTrackData& Data = Tracks[uint32(EStreamlineTraceTrack::DLSSFeatures)];
+	OpenDLSSFeatures.Add(FeatureId, Data.Events.Add(Event));
+	Data.MaxDepth = FMath::Max(Data.MaxDepth, Event.Depth);
+	++ChangeNumber;
+}
+
+void FStreamlineTraceProvider::EndDLSSFeature(uint64 FeatureId, double Time)
+{
+	Session.WriteAccessCheck();
+
+	int32 EventIndex = INDEX_NONE;
+	if (!OpenDLSSFeatures.RemoveAndCopyValue(FeatureId, EventIndex))
+	{
+		return;
+	}
+
+	FTrackData& Data = Tracks[uint32(EStreamlineTraceTrack::DLSSFeatures)];
+	FStreamlineTraceEvent& Event = Data.Events[EventIndex];
+	Event.EndTime = Time;
+	UsedDLSSFeatureDepths[Event.Depth] = false;
+	Data.MaxDuration = FMath::Max(Data.MaxDuration, Event.EndTime - Event.StartTime);
+	++ChangeNumber;
+}
+
+FString FStreamlineTraceProvider::GetEventName(const FStreamlineTraceEvent& Event) const
+{
+	switch (Event.Type)
+	{
+	case EStreamlineTraceEventType::FrameToken:
+		return FString::Printf(TEXT("FrameToken %u (frame %llu)"), Event.Payload, Event.Frame);
+
+	case EStreamlineTraceEventType::ReflexMarker:
+		return FString::Printf(TEXT("%s (token %u)"), ANSI_TO_TCHAR(sl::getPCLMarkerAsStr(sl::PCLMarker(Event.Payload))), uint32(Event.Frame));
+
+	case EStreamlineTraceEventType::Tag:
+	{
+		TArray<const TCHAR*> Resources;
+		for (int32 ResourceIndex = 0; ResourceIndex < UE_ARRAY_COUNT(GStreamlineResourceNames); ++ResourceIndex)
+		{
+			if (Event.Payload & (1u << ResourceIndex))
+			{
+				Resources.Add(GStreamlineResourceNames[ResourceIndex]);
+			}
+		}
+		return FString::Printf(TEXT("Tag view %u token %u: %s"), Event.ViewId, uint32(Event.Frame), *FString::Join(Resources, TEXT(", ")));
+	}
+
+	case EStreamlineTraceEventType::Constants:
+		return FString::Printf(TEXT("Constants view %u token %u"), Event.ViewId, uint32(Event.Frame));
+
+	case EStreamlineTraceEventType::Evaluate:
+		return FString::Printf(TEXT("Evaluate %s view %u token %u"), ANSI_TO_TCHAR(sl::getFeatureAsStr(sl::Feature(Event.Payload))), Event.ViewId, uint32(Event.Frame));
+
+	case EStreamlineTraceEventType::Present:
+		return FString::Printf(TEXT("%s present (frame %llu)"), ANSI_TO_TCHAR(sl::getFeatureAsStr(sl::Feature(Event.Payload))), Event.Frame);
+
+	case EStreamlineTraceEventType::DLSSFeature:
+	{
+		if (!DLSSFeatureDescs.IsValidIndex(Event.Payload))
+		{
+			return TEXT("DLSS feature");
+		}
+		const FStreamlineTraceDLSSFeatureDesc& Desc = DLSSFeatureDescs[Event.Payload];
+		return FString::Printf(TEXT("DLSS feature %dx%d -> %dx%d PerfQuality=%d Denoiser=%u%s"),
+			Desc.SrcSize.X, Desc.SrcSize.Y, Desc.DestSize.X, Desc.DestSize.Y, Desc.PerfQuality, Desc.DenoiserMode,
+			Event.EndTime < 0.0 ? TEXT(" (alive)") : TEXT(""));
+	}
+
+	default:
+		return TEXT("Unknown");
+	}
+}
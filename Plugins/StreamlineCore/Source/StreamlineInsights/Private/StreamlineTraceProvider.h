@@ -0,0 +1,120 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Algo/BinarySearch.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+enum class EStreamlineTraceTrack : uint8
+{
+	ReflexMarkers,
+	FrameTokens,
+	TagsAndConstants,
+	Evaluate,
+	Present,
+	DLSSFeatures,
+	Num
+};
+
+enum class EStreamlineTraceEventType : uint8
+{
+	FrameToken,
+	ReflexMarker,
+	Tag,
+	Constants,
+	Evaluate,
+	Present,
+	DLSSFeature,
+};
+
+struct FStreamlineTraceEvent
+{
+	double StartTime = 0.0;
+	// point events have EndTime == StartTime. DLSS features that are still alive have EndTime < 0
+	double EndTime = 0.0;
+	uint64 Frame = 0;
+	// sl::Feature, sl::PCLMarker or EStreamlineResource bit mask, depending on Type
+	uint32 Payload = 0;
+	uint32 ViewId = 0;
+	uint32 Depth = 0;
+	EStreamlineTraceEventType Type = EStreamlineTraceEventType::FrameToken;
+};
+
+struct FStreamlineTraceDLSSFeatureDesc
+{
+	FIntPoint SrcSize = FIntPoint::ZeroValue;
+	FIntPoint DestSize = FIntPoint::ZeroValue;
+	int32 PerfQuality = -1;
+	uint8 DenoiserMode = 0;
+};
+
+class FStreamlineTraceProvider : public TraceServices::IProvider
+{
+public:
+	static const FName ProviderName;
+
+	explicit FStreamlineTraceProvider(TraceServices::IAnalysisSession& InSession);
+
+	// writers, called by FStreamlineTraceAnalyzer with the session edit scope held
+	void AddEvent(EStreamlineTraceTrack Track, const FStreamlineTraceEvent& Event);
+	void BeginDLSSFeature(uint64 FeatureId, double Time, uint64 Frame, const FStreamlineTraceDLSSFeatureDesc& Desc);
+	void EndDLSSFeature(uint64 FeatureId, double Time);
+
+	// readers, called with the session read scope held
+	template <typename CallbackType>
+	void EnumerateEvents(EStreamlineTraceTrack Track, double StartTime, double EndTime, CallbackType&& Callback) const
+	{
+		const FTrackData& Data = Tracks[uint32(Track)];
+
+		// events are sorted by StartTime, so skip everything that started before the longest event could still be visible.
+		// DLSS features are few and can stay alive for the whole session, so those always get scanned from the start
+		const double FirstStartTime = (Track == EStreamlineTraceTrack::DLSSFeatures) ? -DBL_MAX : StartTime - Data.MaxDuration;
+		int32 Index = Algo::LowerBoundBy(Data.Events, FirstStartTime, [](const FStreamlineTraceEvent& Event) { return Event.StartTime; });
+
+		for (; Index < Data.Events.Num() && Data.Events[Index].StartTime <= EndTime; ++Index)
+		{
+			const FStreamlineTraceEvent& Event = Data.Events[Index];
+			const double EventEndTime = Event.EndTime < 0.0 ? Session.GetDurationSeconds() : Event.EndTime;
+			if (EventEndTime >= StartTime)
+			{
+				Callback(Event, EventEndTime);
+			}
+		}
+	}
+
+	FString GetEventName(const FStreamlineTraceEvent& Event) const;
+	bool HasEvents(EStreamlineTraceTrack Track) const { return Tracks[uint32(Track)].Events.Num() > 0; }
+	uint32 GetMaxDepth(EStreamlineTraceTrack Track) const { return Tracks[uint32(Track)].MaxDepth; }
+
+	// bumped whenever any track changes, so the timing view can mark its tracks dirty during live sessions
+	uint32 GetChangeNumber() const { return ChangeNumber; }
+
+private:
+	struct FTrackData
+	{
+		TArray<FStreamlineTraceEvent> Events;
+		double MaxDuration = 0.0;
+		uint32 MaxDepth = 0;
+	};
+
+	TraceServices::IAnalysisSession& Session;
+	FTrackData Tracks[uint32(EStreamlineTraceTrack::Num)];
+
+	// alive DLSS features, FeatureId -> index into the DLSSFeatures track
+	TMap<uint64, int32> OpenDLSSFeatures;
+	// one bit per depth row currently occupied by an alive DLSS feature
+	TBitArray<> UsedDLSSFeatureDepths;
+	// FStreamlineTraceEvent::Payload of DLSSFeatures events indexes into this
+	TArray<FStreamlineTraceDLSSFeatureDesc> DLSSFeatureDescs;
+
+	uint32 ChangeNumber = 0;
+};
@@ -0,0 +1,34 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+using UnrealBuildTool;
+using System.IO;
+
+public class StreamlineInsights : ModuleRules
+{
+	public StreamlineInsights(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"SlateCore",
+				"TraceAnalysis",
+				"TraceServices",
+				"TraceInsights",
+
+				// only for the sl_helpers.h feature and marker names
+				"Streamline",
+			}
+			);
+	}
+}
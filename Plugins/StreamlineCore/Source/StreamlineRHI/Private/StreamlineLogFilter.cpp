@@ -0,0 +1,341 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineLogFilter.h"
+#include "StreamlineRHIPrivate.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/FileHelper.h"
+
+namespace
+{
+	const TCHAR* StreamlineLogFilterIniSection = TEXT("/Script/StreamlineRHI.StreamlineLogFilter");
+
+	bool ParseLogFilterAction(const FString& ActionString, EStreamlineLogFilterAction& OutAction)
+	{
+		static const TPair<const TCHAR*, EStreamlineLogFilterAction> Actions[] =
+		{
+			{ TEXT("Keep"), EStreamlineLogFilterAction::Keep },
+			{ TEXT("Info"), EStreamlineLogFilterAction::Info },
+			{ TEXT("Warn"), EStreamlineLogFilterAction::Warn },
+			{ TEXT("Error"), EStreamlineLogFilterAction::Error },
+			{ TEXT("Suppress"), EStreamlineLogFilterAction::Suppress },
+		};
+
+		for (const TPair<const TCHAR*, EStreamlineLogFilterAction>& Action : Actions)
+		{
+			if (ActionString.Equals(Action.Key, ESearchCase::IgnoreCase))
+			{
+				OutAction = Action.Value;
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+FStreamlineLogFilter& FStreamlineLogFilter::Get()
+{
+	static FStreamlineLogFilter Filter;
+	return Filter;
+}
+
+void FStreamlineLogFilter::ResetRules()
+{
+	Rules.Reset();
+	RulesByBigram.Reset();
+	FMemory::Memzero(BigramMask);
+}
+
+void FStreamlineLogFilter::AddRule(const ANSICHAR* Pattern, const ANSICHAR* AlsoContains, EStreamlineLogFilterAction Action, int32 MaxMessagesPerInterval, float IntervalSeconds)
+{
+	const int32 PatternLength = FCStringAnsi::Strlen(Pattern);
+	if (PatternLength < 2)
+	{
+		UE_LOG(LogStreamlineRHI, Warning, TEXT("Ignoring Streamline log filter rule '%s', patterns need at least two characters"), ANSI_TO_TCHAR(Pattern));
+		return;
+	}
+
+	FRule& Rule = Rules.AddDefaulted_GetRef();
+	Rule.Pattern.Append(Pattern, PatternLength + 1);
+	if (AlsoContains && *AlsoContains)
+	{
+		Rule.AlsoContains.Append(AlsoContains, FCStringAnsi::Strlen(AlsoContains) + 1);
+	}
+	Rule.Action = Action;
+	Rule.MaxMessagesPerInterval = FMath::Max(0, MaxMessagesPerInterval);
+	Rule.IntervalSeconds = FMath::Max(0.001f, IntervalSeconds);
+
+	const uint16 Bigram = GetBigram(Pattern);
+	RulesByBigram.FindOrAdd(Bigram).Add(Rules.Num() - 1);
+	BigramMask[Bigram / 64] |= uint64(1) << (Bigram % 64);
+}
+
+void FStreamlineLogFilter::LoadRules()
+{
+	ResetRules();
+
+	check(GConfig);
+	bool bUseDefaultRules = true;
+	GConfig->GetBool(StreamlineLogFilterIniSection, TEXT("bUseDefaultRules"), bUseDefaultRules, GEngineIni);
+
+	// rules are tried in order, so the ones from the ini come first to be able to override the defaults
+	TArray<FString> RuleStrings;
+	GConfig->GetArray(StreamlineLogFilterIniSection, TEXT("Rules"), RuleStrings, GEngineIni);
+	for (const FString& RuleString : RuleStrings)
+	{
+		FString Pattern;
+		FString AlsoContains;
+		FString ActionString;
+		int32 MaxMessagesPerInterval = 0;
+		float IntervalSeconds = 1.0f;
+
+		EStreamlineLogFilterAction Action = EStreamlineLogFilterAction::Keep;
+		if (!FParse::Value(*RuleString, TEXT("Pattern="), Pattern) || (FParse::Value(*RuleString, TEXT("Action="), ActionString) && !ParseLogFilterAction(ActionString, Action)))
+		{
+			UE_LOG(LogStreamlineRHI, Warning, TEXT("Ignoring malformed Streamline log filter rule %s"), *RuleString);
+			continue;
+		}
+		FParse::Value(*RuleString, TEXT("AlsoContains="), AlsoContains);
+		FParse::Value(*RuleString, TEXT("MaxMessagesPerInterval="), MaxMessagesPerInterval);
+		FParse::Value(*RuleString, TEXT("IntervalSeconds="), IntervalSeconds);
+
+		AddRule(TCHAR_TO_UTF8(*Pattern), TCHAR_TO_UTF8(*AlsoContains), Action, MaxMessagesPerInterval, IntervalSeconds);
+	}
+
+	if (bUseDefaultRules)
+	{
+		// nuisance message that appears periodically when the FG feature isn't loaded
+		AddRule("[operator ()] 'kFeatureDLSS_G' is missing", nullptr, EStreamlineLogFilterAction::Suppress);
+		// TODO REMOVE
+		AddRule("[streamline][error]commoninterface.h", "same frame is NOT allowed!", EStreamlineLogFilterAction::Warn);
+		// downgrading warning causing automation tests to fail
+		AddRule("A redundant call or a race condition", nullptr, EStreamlineLogFilterAction::Info);
+	}
+
+	UE_LOG(LogStreamlineRHI, Log, TEXT("Streamline log filter uses %d rules (%d from %s)"), Rules.Num(), RuleStrings.Num(), StreamlineLogFilterIniSection);
+}
+
+int32 FStreamlineLogFilter::FindRule(const char* Message) const
+{
+	int32 BestRule = INDEX_NONE;
+
+	for (const char* Text = Message; Text[0] && Text[1]; ++Text)
+	{
+		const uint16 Bigram = GetBigram(Text);
+		if (!(BigramMask[Bigram / 64] & (uint64(1) << (Bigram % 64))))
+		{
+			continue;
+		}
+
+		for (int32 RuleIndex : RulesByBigram.FindChecked(Bigram))
+		{
+			if (BestRule != INDEX_NONE && RuleIndex >= BestRule)
+			{
+				continue;
+			}
+
+			const FRule& Rule = Rules[RuleIndex];
+			if (FCStringAnsi::Strncmp(Text, Rule.Pattern.GetData(), Rule.Pattern.Num() - 1) == 0
+				&& (Rule.AlsoContains.Num() == 0 || FCStringAnsi::Strstr(Message, Rule.AlsoContains.GetData())))
+			{
+				BestRule = RuleIndex;
+			}
+		}
+
+		// nothing can beat the first rule
+		if (BestRule == 0)
+		{
+			break;
+		}
+	}
+
+	return BestRule;
+}
+
+FString FStreamlineLogFilter::GetSuppressedSummary(const FRule& Rule, double Seconds)
+{
+	return FString::Printf(TEXT("Suppressed %d Streamline messages matching '%s' in the last %.1f seconds"), Rule.NumSuppressed, UTF8_TO_TCHAR(Rule.Pattern.GetData()), Seconds);
+}
+
+bool FStreamlineLogFilter::ApplyRateLimit(FRule& Rule, FString& OutSuppressedSummary)
+{
+	FScopeLock Lock(&RateLimitSection);
+
+	const double Now = FPlatformTime::Seconds();
+	if (Rule.IntervalStartTime < 0.0 || Now - Rule.IntervalStartTime >= Rule.IntervalSeconds)
+	{
+		if (Rule.NumSuppressed > 0)
+		{
+			OutSuppressedSummary = GetSuppressedSummary(Rule, Now - Rule.IntervalStartTime);
+		}
+		Rule.IntervalStartTime = Now;
+		Rule.NumInInterval = 0;
+		Rule.NumSuppressed = 0;
+	}
+
+	if (Rule.NumInInterval >= Rule.MaxMessagesPerInterval)
+	{
+		++Rule.NumSuppressed;
+		return false;
+	}
+
+	++Rule.NumInInterval;
+	return true;
+}
+
+bool FStreamlineLogFilter::Filter(const char* Message, sl::LogType& InOutVerbosity, FString& OutSuppressedSummary)
+{
+	const int32 RuleIndex = Rules.Num() > 0 ? FindRule(Message) : INDEX_NONE;
+	if (RuleIndex == INDEX_NONE)
+	{
+		return true;
+	}
+
+	FRule& Rule = Rules[RuleIndex];
+	switch (Rule.Action)
+	{
+		case EStreamlineLogFilterAction::Suppress:
+			return false;
+		case EStreamlineLogFilterAction::Info:
+			InOutVerbosity = sl::LogType::eInfo;
+			break;
+		case EStreamlineLogFilterAction::Warn:
+			InOutVerbosity = sl::LogType::eWarn;
+			break;
+		case EStreamlineLogFilterAction::Error:
+			InOutVerbosity = sl::LogType::eError;
+			break;
+		default:
+		case EStreamlineLogFilterAction::Keep:
+			break;
+	}
+
+	return Rule.MaxMessagesPerInterval == 0 || ApplyRateLimit(Rule, OutSuppressedSummary);
+}
+
+void FStreamlineLogFilter::FlushSuppressedSummaries(TArray<FString>& OutSummaries)
+{
+	FScopeLock Lock(&RateLimitSection);
+
+	const double Now = FPlatformTime::Seconds();
+	for (FRule& Rule : Rules)
+	{
+		if (Rule.NumSuppressed > 0)
+		{
+			OutSummaries.Add(GetSuppressedSummary(Rule, Now - Rule.IntervalStartTime));
+			Rule.NumSuppressed = 0;
+		}
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+// the filtering StreamlineLogSink did before the rule table, kept to compare against
+static bool LegacyStreamlineLogFilter(const char* InSLMessage, sl::LogType& InOutVerbosity, FString& OutMessage)
+{
+	FString Message(FString(UTF8_TO_TCHAR(InSLMessage)).TrimEnd());
+
+	if (Message.Contains(TEXT("[operator ()] 'kFeatureDLSS_G' is missing")))
+	{
+		return false;
+	}
+	if (Message.Contains(TEXT("[streamline][error]commoninterface.h")) && Message.Contains(TEXT("same frame is NOT allowed!")))
+	{
+		InOutVerbosity = sl::LogType::eWarn;
+	}
+	if (Message.Contains(TEXT("A redundant call or a race condition")))
+	{
+		InOutVerbosity = sl::LogType::eInfo;
+	}
+
+	OutMessage = MoveTemp(Message);
+	return true;
+}
+
+// Replays a log stream through the old and the new filtering, without the UE_LOG output itself, which is the same for both.
+// The stream is either a file with one Streamline message per line (e.g. LogStreamlineAPI lines from a game log) or a synthetic one
+static void BenchmarkStreamlineLogSink(const TArray<FString>& Args)
+{
+	TArray<FString> Lines;
+	if (Args.Num() > 0 && !FFileHelper::LoadFileToStringArray(Lines, *Args[0]))
+	{
+		UE_LOG(LogStreamlineRHI, Warning, TEXT("Failed to load the Streamline log stream %s"), *Args[0]);
+		return;
+	}
+
+	if (Lines.Num() == 0)
+	{
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			switch (Index % 10)
+			{
+				case 0: Lines.Add(TEXT("[streamline][info]sl.dlss_g/dlssgentry.cpp:1234[operator ()] 'kFeatureDLSS_G' is missing")); break;
+				case 1: Lines.Add(TEXT("[streamline][warn]commoninterface.h:321[setConstants] A redundant call or a race condition detected")); break;
+				default: Lines.Add(FString::Printf(TEXT("[streamline][info]sl.common/commonentry.cpp:%d[evaluateFeature] frame %d viewport %d evaluated"), 100 + Index % 7, Index, Index % 4)); break;
+			}
+		}
+	}
+
+	// the game log prefixes each line with a timestamp and the category
+	TArray<TArray<ANSICHAR>> Messages;
+	Messages.Reserve(Lines.Num());
+	for (FString& Line : Lines)
+	{
+		const int32 CategoryIndex = Line.Find(TEXT("LogStreamlineAPI: "));
+		if (CategoryIndex != INDEX_NONE)
+		{
+			Line.RightChopInline(CategoryIndex + FCString::Strlen(TEXT("LogStreamlineAPI: ")));
+		}
+		FTCHARToUTF8 Converter(*Line);
+		Messages.Emplace_GetRef().Append(Converter.Get(), Converter.Length() + 1);
+	}
+
+	const int32 NumIterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 100;
+	FStreamlineLogFilter& Filter = FStreamlineLogFilter::Get();
+	int32 NumKept[2] = { 0, 0 };
+	double Seconds[2] = { 0.0, 0.0 };
+
+	for (int32 bNewSink = 0; bNewSink < 2; ++bNewSink)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			for (const TArray<ANSICHAR>& Message : Messages)
+			{
+				sl::LogType Verbosity = sl::LogType::eInfo;
+				FString Output;
+				FString SuppressedSummary;
+
+				const bool bKeep = bNewSink ? Filter.Filter(Message.GetData(), Verbosity, SuppressedSummary) : LegacyStreamlineLogFilter(Message.GetData(), Verbosity, Output);
+				if (bKeep && bNewSink)
+				{
+					// the new sink converts only what gets logged
+					Output = FString(UTF8_TO_TCHAR(Message.GetData())).TrimEnd();
+				}
+				NumKept[bNewSink] += bKeep ? 1 : 0;
+			}
+		}
+		Seconds[bNewSink] = FPlatformTime::Seconds() - StartTime;
+	}
+
+	const int32 NumMessages = Messages.Num() * NumIterations;
+	UE_LOG(LogStreamlineRHI, Log, TEXT("Streamline log sink over %d messages: %.3f us per message with substring checks (%d kept), %.3f us with the rule table (%d kept)"),
+		NumMessages, 1.0e6 * Seconds[0] / NumMessages, NumKept[0], 1.0e6 * Seconds[1] / NumMessages, NumKept[1]);
+}
+
+static FAutoConsoleCommand CCmdStreamlineBenchmarkLogSink(
+	TEXT("r.Streamline.BenchmarkLogSink"),
+	TEXT("Replays a Streamline log stream through the old substring based and the new rule table based log filtering and logs the CPU time per message. ")
+	TEXT("Optional arguments: file with one message per line (default: synthetic stream), number of iterations (default 100)"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkStreamlineLogSink));
+#endif
@@ -0,0 +1,85 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+#include "sl.h"
+
+enum class EStreamlineLogFilterAction : uint8
+{
+	// log with the severity Streamline reported
+	Keep,
+	Info,
+	Warn,
+	Error,
+	Suppress,
+};
+
+// Decides per Streamline log message whether to drop it, remap its severity or rate limit it, based on a table of rules that
+// gets built once before slInit. The rules come from the built in defaults plus [/Script/StreamlineRHI.StreamlineLogFilter] in the engine ini:
+//
+//	[/Script/StreamlineRHI.StreamlineLogFilter]
+//	bUseDefaultRules=True
+//	+Rules=(Pattern="some message",AlsoContains="optional second substring",Action=Warn,MaxMessagesPerInterval=10,IntervalSeconds=5)
+//
+// Messages are matched against the raw UTF-8 text. Rules are indexed by the first two bytes of their pattern, so a message gets scanned once
+// no matter how many rules there are, and messages without a candidate rule don't get converted or copied
+class FStreamlineLogFilter
+{
+public:
+	static FStreamlineLogFilter& Get();
+
+	// replaces the current rules. Not thread safe, call before Streamline starts logging
+	void LoadRules();
+	void AddRule(const ANSICHAR* Pattern, const ANSICHAR* AlsoContains, EStreamlineLogFilterAction Action, int32 MaxMessagesPerInterval = 0, float IntervalSeconds = 1.0f);
+	void ResetRules();
+
+	// any thread. Returns false when the message should be dropped, otherwise InOutVerbosity has been remapped as needed.
+	// OutSuppressedSummary gets set when a rate limit interval ended with dropped messages, to be logged before the message itself
+	bool Filter(const char* Message, sl::LogType& InOutVerbosity, FString& OutSuppressedSummary);
+
+	// any thread, reports the messages dropped by rate limits so far, e.g. when shutting down
+	void FlushSuppressedSummaries(TArray<FString>& OutSummaries);
+
+private:
+	struct FRule
+	{
+		TArray<ANSICHAR> Pattern;
+		TArray<ANSICHAR> AlsoContains;
+		EStreamlineLogFilterAction Action = EStreamlineLogFilterAction::Keep;
+		int32 MaxMessagesPerInterval = 0;
+		double IntervalSeconds = 1.0;
+
+		// rate limit state, guarded by RateLimitSection
+		double IntervalStartTime = -1.0;
+		int32 NumInInterval = 0;
+		int32 NumSuppressed = 0;
+	};
+
+	static uint16 GetBigram(const ANSICHAR* Text)
+	{
+		return uint16(uint8(Text[0])) | (uint16(uint8(Text[1])) << 8);
+	}
+
+	int32 FindRule(const char* Message) const;
+	bool ApplyRateLimit(FRule& Rule, FString& OutSuppressedSummary);
+	static FString GetSuppressedSummary(const FRule& Rule, double Seconds);
+
+	TArray<FRule> Rules;
+
+	// rule indices keyed by the first two bytes of the pattern, plus a bit per key as a cheap reject before the map lookup
+	TMap<uint16, TArray<int32, TInlineAllocator<2>>> RulesByBigram;
+	uint64 BigramMask[65536 / 64] = {};
+
+	FCriticalSection RateLimitSection;
+};
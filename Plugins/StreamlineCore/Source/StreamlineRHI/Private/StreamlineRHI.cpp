@@ -12,8 +12,11 @@
 #include "StreamlineRHI.h"
 #include "StreamlineAPI.h"
 #include "StreamlineConversions.h"
+#include "StreamlineLogFilter.h"
 #include "StreamlineRHIPrivate.h"
 #include "StreamlineSettings.h"
+#include "StreamlineTrace.h"
+#include "StreamlineVRAMBudget.h"
 
 #if WITH_EDITOR
 #include "Editor.h"
@@ -59,38 +62,36 @@ DEFINE_LOG_CATEGORY_STATIC(LogStreamlineAPI, Log, All);
 static void StreamlineLogSink(sl::LogType InSLVerbosity, const char* InSLMessage)
 {
 #if !NO_LOGGING
-	FString Message(FString(UTF8_TO_TCHAR(InSLMessage)).TrimEnd());
-
 	static_assert(uint32_t(sl::LogType::eCount)  == 3U, "sl::LogType enum value mismatch. Dear NVIDIA Streamline plugin developer, please update this code!" ) ;
 
-	if (Message.Contains(TEXT("[operator ()] 'kFeatureDLSS_G' is missing")))
-	{
-		// nuisance message that appears periodically when the FG feature isn't loaded
-		return;
-	}
-	// TODO REMOVE
-	if (Message.Contains(TEXT("[streamline][error]commoninterface.h")) && Message.Contains(TEXT("same frame is NOT allowed!")))
+	// suppression, severity remapping and rate limiting, see FStreamlineLogFilter and [/Script/StreamlineRHI.StreamlineLogFilter]
+	FString SuppressedSummary;
+	const bool bKeep = FStreamlineLogFilter::Get().Filter(InSLMessage, InSLVerbosity, SuppressedSummary);
+
+	if (!SuppressedSummary.IsEmpty())
 	{
-		InSLVerbosity = sl::LogType::eWarn;
+		UE_LOG(LogStreamlineAPI, Log, TEXT("%s"), *SuppressedSummary);
 	}
 
-	// downgrading warning causing automation tests to fail
-	if (Message.Contains(TEXT("A redundant call or a race condition")))
+	if (!bKeep)
 	{
-		InSLVerbosity = sl::LogType::eInfo;
+		return;
 	}
 
+	// UE_LOG only evaluates its arguments when the category isn't suppressed, so this only converts messages that actually get logged
+	auto ToMessage = [InSLMessage]() { return FString(UTF8_TO_TCHAR(InSLMessage)).TrimEnd(); };
+
 	switch (InSLVerbosity)
 	{
 		default:
 		case sl::LogType::eInfo:
-			UE_LOG(LogStreamlineAPI, Log, TEXT("[Info]: %s"), *Message);
+			UE_LOG(LogStreamlineAPI, Log, TEXT("[Info]: %s"), *ToMessage());
 			break;
 		case sl::LogType::eWarn:
-			UE_LOG(LogStreamlineAPI, Warning, TEXT("[Warn]: %s"), *Message);
+			UE_LOG(LogStreamlineAPI, Warning, TEXT("[Warn]: %s"), *ToMessage());
 			break;
 		case sl::LogType::eError:
-			UE_LOG(LogStreamlineAPI, Error, TEXT("[Error]: %s"),*Message);
+			UE_LOG(LogStreamlineAPI, Error, TEXT("[Error]: %s"), *ToMessage());
 			break;
 	}
 #endif
@@ -161,6 +162,7 @@ sl::FrameToken* FSLFrameTokenProvider::GetTokenForFrame(uint64 FrameCounter)
 	// this should be safe, we can create multiple tokens to track the same frame
 	LastFrameCounter = FrameCounter32;
 	SLgetNewFrameToken(FrameToken, &LastFrameCounter);
+	TRACE_STREAMLINE_FRAME_TOKEN(FrameCounter, FrameToken ? uint32(*FrameToken) : FrameCounter32);
 
 	return FrameToken;
 }
@@ -282,6 +284,26 @@ void FStreamlineRHI::ReleaseStreamlineResourcesForAllFeatures(uint32 ViewID)
 	}
 }
 
+void FStreamlineRHI::ReleaseStreamlineResources(sl::Feature Feature, uint32 ViewID)
+{
+	if (LoadedFeatures.Contains(Feature))
+	{
+		SLFreeResources(Feature, ViewID);
+	}
+}
+
+void FStreamlineRHI::AllocateStreamlineResources(FRHICommandList& CmdList, sl::Feature Feature, uint32 ViewID, FRHITexture* DeviceTexture)
+{
+	if (!LoadedFeatures.Contains(Feature))
+	{
+		return;
+	}
+
+	sl::CommandBuffer* NativeCommandBuffer = GetCommandBuffer(CmdList, DeviceTexture);
+	SLAllocateResources(NativeCommandBuffer, Feature, sl::ViewportHandle(ViewID));
+	PostStreamlineFeatureEvaluation(CmdList, DeviceTexture);
+}
+
 void FStreamlineRHI::PostPlatformRHICreateInit()
 {
 	UE_LOG(LogStreamlineRHI, Log, TEXT("%s Enter"), ANSI_TO_TCHAR(__FUNCTION__));
@@ -353,40 +375,29 @@ bool FStreamlineRHI::IsStreamlineAvailable() const
 
 void FStreamlineRHI::SetStreamlineData(FRHICommandList& CmdList, const FRHIStreamlineArguments& InArguments)
 {
-	check(!IsRunningRHIInSeparateThread() || IsInRHIThread());
-	sl::Constants StreamlineConstants = {};
-
-	StreamlineConstants.reset = ToSL(InArguments.bReset);
-	StreamlineConstants.jitterOffset = ToSL(InArguments.JitterOffset);
-
-	StreamlineConstants.depthInverted = ToSL(InArguments.bIsDepthInverted);
-
-	StreamlineConstants.mvecScale = ToSL(InArguments.MotionVectorScale);
-	StreamlineConstants.motionVectorsDilated = ToSL(InArguments.bAreMotionVectorsDilated);
-	StreamlineConstants.cameraMotionIncluded = sl::eTrue;
-	StreamlineConstants.motionVectors3D = sl::eFalse;
+	SetStreamlineData(CmdList, MakeArrayView(&InArguments, 1));
+}
 
-	StreamlineConstants.orthographicProjection = ToSL(InArguments.bIsOrthographicProjection);
-	StreamlineConstants.cameraViewToClip = ToSL(InArguments.CameraViewToClip, InArguments.bIsOrthographicProjection);
-	StreamlineConstants.clipToCameraView = ToSL(InArguments.ClipToCameraView);
-	StreamlineConstants.clipToLensClip = ToSL(InArguments.ClipToLenseClip);
-	StreamlineConstants.clipToPrevClip = ToSL(InArguments.ClipToPrevClip);
-	StreamlineConstants.prevClipToClip = ToSL(InArguments.PrevClipToClip);
-	
-	StreamlineConstants.cameraPos = ToSL(InArguments.CameraOrigin);
-	StreamlineConstants.cameraUp = ToSL(InArguments.CameraUp);
-	StreamlineConstants.cameraRight = ToSL(InArguments.CameraRight);
-	StreamlineConstants.cameraFwd = ToSL(InArguments.CameraForward);
-	
-	StreamlineConstants.cameraNear = InArguments.CameraNear;
-	StreamlineConstants.cameraFar = InArguments.CameraFar;
-	StreamlineConstants.cameraFOV = FMath::DegreesToRadians(InArguments.CameraFOV);
-	StreamlineConstants.cameraAspectRatio = InArguments.CameraAspectRatio;
+void FStreamlineRHI::SetStreamlineData(FRHICommandList& CmdList, TConstArrayView<FRHIStreamlineArguments> InArguments)
+{
+	check(!IsRunningRHIInSeparateThread() || IsInRHIThread());
 
-	StreamlineConstants.cameraPinholeOffset = ToSL(InArguments.CameraPinholeOffset);
+	// all views of a family share the frame, so this is typically a single token lookup for the whole batch
+	uint64 FrameId = 0;
+	const sl::FrameToken* FrameToken = nullptr;
 
-	SLsetConstants(StreamlineConstants, *GetFrameToken(InArguments.FrameId), sl::ViewportHandle(InArguments.ViewId));
+	for (const FRHIStreamlineArguments& Arguments : InArguments)
+	{
+		if (!FrameToken || Arguments.FrameId != FrameId)
+		{
+			FrameId = Arguments.FrameId;
+			FrameToken = GetFrameToken(FrameId);
+		}
 
+		const sl::Constants StreamlineConstants = ToSL(Arguments);
+		TRACE_STREAMLINE_CONSTANTS(uint32(*FrameToken), Arguments.ViewId);
+		SLsetConstants(StreamlineConstants, *FrameToken, sl::ViewportHandle(Arguments.ViewId));
+	}
 }
 
 sl::FrameToken* FStreamlineRHI::GetFrameToken(uint64 FrameCounter)
@@ -409,6 +420,7 @@ void FStreamlineRHI::StreamlineEvaluateDeepDVC(FRHICommandList& CmdList, const F
 	sl::ViewportHandle SLView(ViewID);
 
 	const sl::BaseStructure* SLInputs[] = { &SLView };
+	TRACE_STREAMLINE_EVALUATE_SCOPE(SLFeature, uint32(*FrameToken), ViewID);
 	SLevaluateFeature(SLFeature, *FrameToken, SLInputs, UE_ARRAY_COUNT(SLInputs), NativeCommandBuffer);
 	PostStreamlineFeatureEvaluation(CmdList, InputOutput.Texture);
 }
@@ -858,6 +870,7 @@ void FStreamlineRHIModule::InitializeStreamline()
 	Preferences.allocateCallback = nullptr;
 	Preferences.releaseCallback = nullptr;
 #if !NO_LOGGING
+	FStreamlineLogFilter::Get().LoadRules();
 	Preferences.logMessageCallback = StreamlineLogSink;
 #else
 	Preferences.logMessageCallback = nullptr;
@@ -1066,18 +1079,21 @@ STREAMLINERHI_API bool StreamlineFilterRedundantSetOptionsCalls()
 #if (UE_BUILD_TEST || UE_BUILD_SHIPPING)
 	return true;
 #else
-	if (FParse::Param(FCommandLine::Get(), TEXT("slfilter")))
-	{
-		return true;
-	}
-	else if (FParse::Param(FCommandLine::Get(), TEXT("slnofilter")))
-	{
-		return false;
-	}
-	else
+	// this gets called for every sl{Feature}SetOptions call, so only parse the command line once
+	static const TOptional<bool> CommandLineOverride = []() -> TOptional<bool>
 	{
-		return CVarStreamlineFilterRedundantSetOptionsCalls.GetValueOnAnyThread();
-	}
+		if (FParse::Param(FCommandLine::Get(), TEXT("slfilter")))
+		{
+			return true;
+		}
+		else if (FParse::Param(FCommandLine::Get(), TEXT("slnofilter")))
+		{
+			return false;
+		}
+		return TOptional<bool>();
+	}();
+
+	return CommandLineOverride.Get(CVarStreamlineFilterRedundantSetOptionsCalls.GetValueOnAnyThread());
 #endif
 }
 
@@ -1090,6 +1106,15 @@ STREAMLINERHI_API void FStreamlineRHIModule::ShutdownStreamline()
 		UE_LOG(LogStreamlineRHI, Error, TEXT("Failed to shut down Streamline (%s)"), ANSI_TO_TCHAR(sl::getResultAsStr(Result)));
 	}
 	bIsStreamlineInitialized = false;
+
+#if !NO_LOGGING
+	TArray<FString> SuppressedSummaries;
+	FStreamlineLogFilter::Get().FlushSuppressedSummaries(SuppressedSummaries);
+	for (const FString& SuppressedSummary : SuppressedSummaries)
+	{
+		UE_LOG(LogStreamlineAPI, Log, TEXT("%s"), *SuppressedSummary);
+	}
+#endif
 }
 
 
@@ -1152,6 +1177,7 @@ void FStreamlineRHIModule::StartupModule()
 	}
 
 	PlatformCreateStreamlineRHI();
+	RegisterStreamlineVRAMBudgetManager();
 	UE_LOG(LogStreamlineRHI, Log, TEXT("%s Leave"), ANSI_TO_TCHAR(__FUNCTION__));
 }
 
@@ -1164,6 +1190,7 @@ void FStreamlineRHIModule::ShutdownModule()
 	}
 
 	UE_LOG(LogStreamlineRHI, Log, TEXT("%s Enter"), ANSI_TO_TCHAR(__FUNCTION__));
+	UnregisterStreamlineVRAMBudgetManager();
 	GStreamlineRHI.Reset();
 	// TODO STREAMLINE sort out proper shutdown order between the SL interposer and the RHIs
 	// don't shut down streamline so the D3D12RHI destructors don't crash
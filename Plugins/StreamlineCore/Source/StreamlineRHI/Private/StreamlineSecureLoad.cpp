@@ -10,6 +10,9 @@
 */
 
 #include "StreamlineRHIPrivate.h"
+#include "StreamlineSignatureCache.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 
 #define _UNICODE 1
@@ -33,9 +36,11 @@ THIRD_PARTY_INCLUDES_START
 #endif
 
 #include <windows.h>
+#include <bcrypt.h>
 #include <Softpub.h>
 #include <wincrypt.h>
 #include <wintrust.h>
+#include <dpapi.h>
 #include <inttypes.h>
 #pragma pop_macro("NTDDI_VERSION")
 
@@ -125,6 +130,28 @@ typedef BOOL(WINAPI* PfnCryptDecodeObjectEx)(
 	);
 static PfnCryptDecodeObjectEx pfnCryptDecodeObjectEx = NULL;
 
+typedef BOOL(WINAPI* PfnCryptProtectData)(
+	IN DATA_BLOB* pDataIn,
+	IN LPCWSTR szDataDescr,
+	IN DATA_BLOB* pOptionalEntropy,
+	IN PVOID pvReserved,
+	IN CRYPTPROTECT_PROMPTSTRUCT* pPromptStruct,
+	IN DWORD dwFlags,
+	OUT DATA_BLOB* pDataOut
+	);
+static PfnCryptProtectData pfnCryptProtectData = NULL;
+
+typedef BOOL(WINAPI* PfnCryptUnprotectData)(
+	IN DATA_BLOB* pDataIn,
+	OUT LPWSTR* ppszDataDescr,
+	IN DATA_BLOB* pOptionalEntropy,
+	IN PVOID pvReserved,
+	IN CRYPTPROTECT_PROMPTSTRUCT* pPromptStruct,
+	IN DWORD dwFlags,
+	OUT DATA_BLOB* pDataOut
+	);
+static PfnCryptUnprotectData pfnCryptUnprotectData = NULL;
+
 typedef LONG(WINAPI* PfnWinVerifyTrust)(
 	IN HWND   hwnd,
 	IN GUID* pgActionID,
@@ -329,7 +356,7 @@ bool isSignedByNVIDIA(const wchar_t* pathToFile)
 }
 
 //! See https://docs.microsoft.com/en-us/windows/win32/seccrypto/example-c-program--verifying-the-signature-of-a-pe-file
-bool slVerifyEmbeddedSignature(const FString& InPathToBinary)
+static bool VerifyEmbeddedSignatureUncached(const FString& InPathToBinary)
 {
 	FString PathToBinary = InPathToBinary;
 
@@ -472,7 +499,178 @@ bool slVerifyEmbeddedSignature(const FString& InPathToBinary)
 	return valid;
 }
 
+class FStreamlineWindowsSignatureVerifier : public IStreamlineSignatureVerifier
+{
+public:
+	virtual bool VerifyEmbeddedSignature(const FString& PathToBinary) override
+	{
+		return VerifyEmbeddedSignatureUncached(PathToBinary);
+	}
+};
+
+typedef NTSTATUS(WINAPI* PfnBCryptOpenAlgorithmProvider)(BCRYPT_ALG_HANDLE* phAlgorithm, LPCWSTR pszAlgId, LPCWSTR pszImplementation, ULONG dwFlags);
+typedef NTSTATUS(WINAPI* PfnBCryptHash)(BCRYPT_ALG_HANDLE hAlgorithm, PUCHAR pbSecret, ULONG cbSecret, PUCHAR pbInput, ULONG cbInput, PUCHAR pbOutput, ULONG cbOutput);
+typedef NTSTATUS(WINAPI* PfnBCryptGenRandom)(BCRYPT_ALG_HANDLE hAlgorithm, PUCHAR pbBuffer, ULONG cbBuffer, ULONG dwFlags);
 
+struct FBCrypt
+{
+	PfnBCryptHash Hash = nullptr;
+	PfnBCryptGenRandom GenRandom = nullptr;
+	BCRYPT_ALG_HANDLE SHA256 = nullptr;
+	BCRYPT_ALG_HANDLE HMACSHA256 = nullptr;
+
+	static const FBCrypt& Get()
+	{
+		static const FBCrypt BCrypt = []()
+		{
+			FBCrypt Result;
+
+			// We only support Win10+ so we can search for module in system32 directly. Stays loaded for the lifetime of the process
+			HMODULE hModBCrypt = LoadLibraryExW(L"bcrypt.dll", NULL, LOAD_LIBRARY_SEARCH_SYSTEM32);
+			PfnBCryptOpenAlgorithmProvider OpenAlgorithmProvider = hModBCrypt ? (PfnBCryptOpenAlgorithmProvider)GetProcAddress(hModBCrypt, "BCryptOpenAlgorithmProvider") : nullptr;
+			if (!OpenAlgorithmProvider)
+			{
+				UE_LOG(LogStreamlineRHI, Log, TEXT("Unable to obtain bcrypt.dll functionality - the Streamline signature cache is disabled."));
+				return Result;
+			}
+
+			Result.Hash = (PfnBCryptHash)GetProcAddress(hModBCrypt, "BCryptHash");
+			Result.GenRandom = (PfnBCryptGenRandom)GetProcAddress(hModBCrypt, "BCryptGenRandom");
+			if (!BCRYPT_SUCCESS(OpenAlgorithmProvider(&Result.SHA256, BCRYPT_SHA256_ALGORITHM, nullptr, 0)))
+			{
+				Result.SHA256 = nullptr;
+			}
+			if (!BCRYPT_SUCCESS(OpenAlgorithmProvider(&Result.HMACSHA256, BCRYPT_SHA256_ALGORITHM, nullptr, BCRYPT_ALG_HANDLE_HMAC_FLAG)))
+			{
+				Result.HMACSHA256 = nullptr;
+			}
+			return Result;
+		}();
+		return BCrypt;
+	}
+};
+
+// The HMAC key of the signature cache is random and only ever stored encrypted with DPAPI under the current Windows user, so a cache entry for a
+// tampered binary can't be forged by writing files alone, e.g. by whoever drops the binary. Returns an empty key when DPAPI isn't available,
+// which disables the cache
+static TArray<uint8> LoadOrCreateSignatureCacheKey(const FString& KeyFilename)
+{
+	if (!pfnCryptProtectData)
+	{
+		// We only support Win10+ so we can search for module in system32 directly
+		auto hModCrypt32 = LoadLibraryExW(L"crypt32.dll", NULL, LOAD_LIBRARY_SEARCH_SYSTEM32);
+		if (!hModCrypt32 ||
+			!GetProc(hModCrypt32, "CryptProtectData", pfnCryptProtectData) ||
+			!GetProc(hModCrypt32, "CryptUnprotectData", pfnCryptUnprotectData))
+		{
+			UE_LOG(LogStreamlineRHI, Log, TEXT("Unable to obtain crypt32.dll DPAPI functionality - the Streamline signature cache is disabled."));
+			return TArray<uint8>();
+		}
+	}
+
+	// binds the protected key to its purpose, so other DPAPI blobs of the user can't be substituted
+	static char EntropyString[] = "StreamlineSignatureCacheKey";
+	DATA_BLOB Entropy;
+	Entropy.pbData = reinterpret_cast<BYTE*>(EntropyString);
+	Entropy.cbData = sizeof(EntropyString);
+
+	constexpr int32 KeySize = 32;
+	TArray<uint8> ProtectedKey;
+	if (FFileHelper::LoadFileToArray(ProtectedKey, *KeyFilename, FILEREAD_Silent))
+	{
+		DATA_BLOB ProtectedBlob;
+		ProtectedBlob.pbData = ProtectedKey.GetData();
+		ProtectedBlob.cbData = ProtectedKey.Num();
+		DATA_BLOB KeyBlob = {};
+		if (pfnCryptUnprotectData(&ProtectedBlob, NULL, &Entropy, NULL, NULL, CRYPTPROTECT_UI_FORBIDDEN, &KeyBlob))
+		{
+			TArray<uint8> Key(KeyBlob.pbData, KeyBlob.cbData);
+			SecureZeroMemory(KeyBlob.pbData, KeyBlob.cbData);
+			LocalFree(KeyBlob.pbData);
+			if (Key.Num() == KeySize)
+			{
+				return Key;
+			}
+		}
+		UE_LOG(LogStreamlineRHI, Log, TEXT("Unable to decrypt the Streamline signature cache key %s, creating a new one."), *KeyFilename);
+	}
+
+	// a new key invalidates any existing cache file since its HMAC won't match anymore
+	TArray<uint8> Key;
+	Key.SetNumZeroed(KeySize);
+	const FBCrypt& BCrypt = FBCrypt::Get();
+	if (!BCrypt.GenRandom || !BCRYPT_SUCCESS(BCrypt.GenRandom(nullptr, Key.GetData(), ULONG(Key.Num()), BCRYPT_USE_SYSTEM_PREFERRED_RNG)))
+	{
+		return TArray<uint8>();
+	}
+
+	DATA_BLOB KeyBlob;
+	KeyBlob.pbData = Key.GetData();
+	KeyBlob.cbData = Key.Num();
+	DATA_BLOB ProtectedBlob = {};
+	if (!pfnCryptProtectData(&KeyBlob, L"Streamline signature cache key", &Entropy, NULL, NULL, CRYPTPROTECT_UI_FORBIDDEN, &ProtectedBlob))
+	{
+		UE_LOG(LogStreamlineRHI, Log, TEXT("Unable to encrypt the Streamline signature cache key - the Streamline signature cache is disabled."));
+		return TArray<uint8>();
+	}
+
+	ProtectedKey = TArray<uint8>(ProtectedBlob.pbData, ProtectedBlob.cbData);
+	LocalFree(ProtectedBlob.pbData);
+	if (!FFileHelper::SaveArrayToFile(ProtectedKey, *KeyFilename))
+	{
+		UE_LOG(LogStreamlineRHI, Log, TEXT("Unable to write the Streamline signature cache key %s - the Streamline signature cache is disabled."), *KeyFilename);
+		return TArray<uint8>();
+	}
+
+	return Key;
+}
+
+// SHA-256 and HMAC-SHA256 come from the Windows CNG, the HMAC key is kept with DPAPI
+class FStreamlineWindowsSignatureCacheCrypto : public IStreamlineSignatureCacheCrypto
+{
+public:
+	explicit FStreamlineWindowsSignatureCacheCrypto(const FString& InKeyFilename)
+		: KeyFilename(InKeyFilename)
+	{
+	}
+
+	virtual bool HashSHA256(TConstArrayView<uint8> Data, FStreamlineSHA256& OutHash) override
+	{
+		const FBCrypt& BCrypt = FBCrypt::Get();
+		return BCrypt.Hash && BCrypt.SHA256
+			&& BCRYPT_SUCCESS(BCrypt.Hash(BCrypt.SHA256, nullptr, 0, const_cast<uint8*>(Data.GetData()), ULONG(Data.Num()), OutHash.Hash, sizeof(OutHash.Hash)));
+	}
+
+	virtual bool HMACSHA256(TConstArrayView<uint8> Key, TConstArrayView<uint8> Data, FStreamlineSHA256& OutHMAC) override
+	{
+		const FBCrypt& BCrypt = FBCrypt::Get();
+		return BCrypt.Hash && BCrypt.HMACSHA256 && Key.Num() > 0
+			&& BCRYPT_SUCCESS(BCrypt.Hash(BCrypt.HMACSHA256, const_cast<uint8*>(Key.GetData()), ULONG(Key.Num()), const_cast<uint8*>(Data.GetData()), ULONG(Data.Num()), OutHMAC.Hash, sizeof(OutHMAC.Hash)));
+	}
+
+	virtual TArray<uint8> LoadOrCreateKey() override
+	{
+		return LoadOrCreateSignatureCacheKey(KeyFilename);
+	}
+
+private:
+	FString KeyFilename;
+};
+
+bool slVerifyEmbeddedSignature(const FString& InPathToBinary)
+{
+	static FStreamlineWindowsSignatureVerifier Verifier;
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("slnosignaturecache")))
+	{
+		return Verifier.VerifyEmbeddedSignature(InPathToBinary);
+	}
+
+	static const FString CacheDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Streamline"));
+	static FStreamlineWindowsSignatureCacheCrypto Crypto(FPaths::Combine(CacheDir, TEXT("SignatureCache.key")));
+	static FStreamlineSignatureCache Cache(Verifier, Crypto, FPaths::Combine(CacheDir, TEXT("SignatureCache.bin")));
+	return Cache.Verify(InPathToBinary);
+}
 
 
 #include "Windows/HideWindowsPlatformTypes.h"
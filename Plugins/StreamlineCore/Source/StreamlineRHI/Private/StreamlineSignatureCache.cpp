@@ -0,0 +1,196 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineSignatureCache.h"
+#include "StreamlineRHIPrivate.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	constexpr uint32 SignatureCacheMagic = 0x534c5343; // "SLSC"
+	// 2: SHA-256 content hashes and HMAC-SHA256
+	constexpr uint32 SignatureCacheVersion = 2;
+}
+
+FStreamlineSignatureCache::FStreamlineSignatureCache(IStreamlineSignatureVerifier& InVerifier, IStreamlineSignatureCacheCrypto& InCrypto, const FString& InCacheFilename)
+	: Verifier(InVerifier)
+	, Crypto(InCrypto)
+	, CacheFilename(InCacheFilename)
+{
+}
+
+bool FStreamlineSignatureCache::HashFileContent(const FString& PathToBinary, FStreamlineSHA256& OutHash)
+{
+	TArray<uint8> Content;
+	if (!FFileHelper::LoadFileToArray(Content, *PathToBinary, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	return Crypto.HashSHA256(Content, OutHash);
+}
+
+void FStreamlineSignatureCache::Load()
+{
+	bLoaded = true;
+	Entries.Reset();
+	HMACKey = Crypto.LoadOrCreateKey();
+	if (HMACKey.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *CacheFilename, FILEREAD_Silent))
+	{
+		return;
+	}
+
+	// the HMAC over everything before it is stored at the end of the file
+	constexpr int32 HMACSize = sizeof(FStreamlineSHA256::Hash);
+	FStreamlineSHA256 ExpectedHMAC;
+	if (Data.Num() < HMACSize)
+	{
+		UE_LOG(LogStreamlineRHI, Log, TEXT("Discarding truncated Streamline signature cache %s"), *CacheFilename);
+		return;
+	}
+	if (!Crypto.HMACSHA256(HMACKey, MakeArrayView(Data.GetData(), Data.Num() - HMACSize), ExpectedHMAC)
+		|| FMemory::Memcmp(ExpectedHMAC.Hash, &Data[Data.Num() - HMACSize], HMACSize) != 0)
+	{
+		UE_LOG(LogStreamlineRHI, Log, TEXT("Discarding Streamline signature cache %s since its HMAC doesn't match"), *CacheFilename);
+		return;
+	}
+
+	FMemoryReader Reader(Data);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 NumEntries = 0;
+	Reader << Magic << Version << NumEntries;
+	if (Magic != SignatureCacheMagic || Version != SignatureCacheVersion || NumEntries < 0)
+	{
+		return;
+	}
+
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries && !Reader.IsError(); ++EntryIndex)
+	{
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Reader << Entry.Path << Entry.Size << Entry.LastWriteTicks << Entry.ContentHash;
+	}
+
+	if (Reader.IsError())
+	{
+		Entries.Reset();
+	}
+}
+
+void FStreamlineSignatureCache::Save()
+{
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+
+	uint32 Magic = SignatureCacheMagic;
+	uint32 Version = SignatureCacheVersion;
+	int32 NumEntries = Entries.Num();
+	Writer << Magic << Version << NumEntries;
+	for (FEntry& Entry : Entries)
+	{
+		Writer << Entry.Path << Entry.Size << Entry.LastWriteTicks << Entry.ContentHash;
+	}
+
+	FStreamlineSHA256 HMAC;
+	if (!Crypto.HMACSHA256(HMACKey, Data, HMAC))
+	{
+		return;
+	}
+	Data.Append(HMAC.Hash, sizeof(HMAC.Hash));
+
+	if (!FFileHelper::SaveArrayToFile(Data, *CacheFilename))
+	{
+		UE_LOG(LogStreamlineRHI, Log, TEXT("Unable to write the Streamline signature cache %s"), *CacheFilename);
+	}
+}
+
+bool FStreamlineSignatureCache::Verify(const FString& InPathToBinary, bool* bOutCacheHit)
+{
+	if (bOutCacheHit)
+	{
+		*bOutCacheHit = false;
+	}
+
+	if (!bLoaded)
+	{
+		Load();
+	}
+
+	if (HMACKey.IsEmpty())
+	{
+		return Verifier.VerifyEmbeddedSignature(InPathToBinary);
+	}
+
+	const FString PathToBinary = FPaths::ConvertRelativePathToFull(InPathToBinary);
+	const FFileStatData StatData = IFileManager::Get().GetStatData(*PathToBinary);
+	FStreamlineSHA256 ContentHash;
+
+	// without the content hash there is nothing to key the result on, so just do the full validation
+	if (!StatData.bIsValid || !HashFileContent(PathToBinary, ContentHash))
+	{
+		return Verifier.VerifyEmbeddedSignature(PathToBinary);
+	}
+
+	const int64 LastWriteTicks = StatData.ModificationTime.GetTicks();
+	const int32 EntryIndex = Entries.IndexOfByPredicate([&PathToBinary](const FEntry& Entry) { return Entry.Path.Equals(PathToBinary, ESearchCase::IgnoreCase); });
+
+	if (EntryIndex != INDEX_NONE)
+	{
+		const FEntry& Entry = Entries[EntryIndex];
+		if (Entry.Size == StatData.FileSize && Entry.LastWriteTicks == LastWriteTicks && Entry.ContentHash == ContentHash)
+		{
+			UE_LOG(LogStreamlineRHI, Log, TEXT("File '%s' is unchanged since its signature was last verified, skipping the full validation."), *PathToBinary);
+			if (bOutCacheHit)
+			{
+				*bOutCacheHit = true;
+			}
+			return true;
+		}
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const bool bValid = Verifier.VerifyEmbeddedSignature(PathToBinary);
+	UE_LOG(LogStreamlineRHI, Log, TEXT("Full signature validation of '%s' took %.1f ms"), *PathToBinary, 1000.0 * (FPlatformTime::Seconds() - StartTime));
+
+	// stale entries for this path go away either way, so a binary that stopped verifying is never served from the cache
+	if (EntryIndex != INDEX_NONE)
+	{
+		Entries.RemoveAt(EntryIndex);
+	}
+
+	if (bValid)
+	{
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Path = PathToBinary;
+		Entry.Size = StatData.FileSize;
+		Entry.LastWriteTicks = LastWriteTicks;
+		Entry.ContentHash = ContentHash;
+	}
+
+	if (bValid || EntryIndex != INDEX_NONE)
+	{
+		Save();
+	}
+
+	return bValid;
+}
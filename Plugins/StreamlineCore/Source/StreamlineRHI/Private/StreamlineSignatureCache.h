@@ -0,0 +1,87 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+// SHA-256 digest
+struct FStreamlineSHA256
+{
+	uint8 Hash[32] = {};
+
+	bool operator==(const FStreamlineSHA256& Other) const
+	{
+		return FMemory::Memcmp(Hash, Other.Hash, sizeof(Hash)) == 0;
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FStreamlineSHA256& Digest)
+	{
+		Ar.Serialize(Digest.Hash, sizeof(Digest.Hash));
+		return Ar;
+	}
+};
+
+// Does the full validation of the signature embedded in a binary. The Windows implementation lives in StreamlineSecureLoad.cpp,
+// anything else (e.g. the fake in StreamlineSignatureCacheTests.cpp) can implement this too
+class IStreamlineSignatureVerifier
+{
+public:
+	virtual ~IStreamlineSignatureVerifier() = default;
+	virtual bool VerifyEmbeddedSignature(const FString& PathToBinary) = 0;
+};
+
+// Hashing and the storage of the secret HMAC key of the cache. The Windows implementation (CNG and DPAPI) lives in StreamlineSecureLoad.cpp
+// next to the verifier, so the cache itself doesn't depend on any platform API
+class IStreamlineSignatureCacheCrypto
+{
+public:
+	virtual ~IStreamlineSignatureCacheCrypto() = default;
+	// these return false when the platform can't hash, in which case nothing gets cached
+	virtual bool HashSHA256(TConstArrayView<uint8> Data, FStreamlineSHA256& OutHash) = 0;
+	virtual bool HMACSHA256(TConstArrayView<uint8> Key, TConstArrayView<uint8> Data, FStreamlineSHA256& OutHMAC) = 0;
+	// an empty key disables the cache, every binary then gets the full validation
+	virtual TArray<uint8> LoadOrCreateKey() = 0;
+};
+
+// Remembers binaries that passed full signature validation, keyed by path, size, last write time and a SHA-256 over the whole file content,
+// so unchanged binaries skip the certificate chain validation on later launches while any change to the file still forces it.
+// Only successful validations are cached. The cache file is authenticated with an HMAC-SHA256 under a secret key, so entries can't be
+// forged or edited without that key, and a cache that fails the check gets discarded as a whole
+class FStreamlineSignatureCache
+{
+public:
+	FStreamlineSignatureCache(IStreamlineSignatureVerifier& InVerifier, IStreamlineSignatureCacheCrypto& InCrypto, const FString& InCacheFilename);
+
+	// returns whether the binary is correctly signed, either from the cache or by running the verifier
+	bool Verify(const FString& PathToBinary, bool* bOutCacheHit = nullptr);
+
+	int32 GetNumEntries() const { return Entries.Num(); }
+
+private:
+	struct FEntry
+	{
+		FString Path;
+		int64 Size = 0;
+		int64 LastWriteTicks = 0;
+		FStreamlineSHA256 ContentHash;
+	};
+
+	void Load();
+	void Save();
+	bool HashFileContent(const FString& PathToBinary, FStreamlineSHA256& OutHash);
+
+	IStreamlineSignatureVerifier& Verifier;
+	IStreamlineSignatureCacheCrypto& Crypto;
+	FString CacheFilename;
+	TArray<uint8> HMACKey;
+	TArray<FEntry> Entries;
+	bool bLoaded = false;
+};
@@ -0,0 +1,131 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineTrace.h"
+
+#if STREAMLINE_TRACE_ENABLED
+
+#include "StreamlineRHI.h"
+#include "HAL/PlatformTime.h"
+
+UE_TRACE_CHANNEL_DEFINE(StreamlineChannel)
+
+UE_TRACE_EVENT_BEGIN(Streamline, FrameToken)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, FrameCounter)
+	UE_TRACE_EVENT_FIELD(uint32, FrameIndex)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Streamline, ReflexMarker)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, FrameCounter)
+	UE_TRACE_EVENT_FIELD(uint32, FrameIndex)
+	UE_TRACE_EVENT_FIELD(uint32, Marker)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Streamline, Tag)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, FrameIndex)
+	UE_TRACE_EVENT_FIELD(uint32, ViewId)
+	UE_TRACE_EVENT_FIELD(uint32, ResourceMask)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Streamline, Constants)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, FrameIndex)
+	UE_TRACE_EVENT_FIELD(uint32, ViewId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Streamline, Scope)
+	UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+	UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+	UE_TRACE_EVENT_FIELD(uint64, Frame)
+	UE_TRACE_EVENT_FIELD(uint32, Feature)
+	UE_TRACE_EVENT_FIELD(uint32, ViewId)
+	UE_TRACE_EVENT_FIELD(uint8, Type)
+UE_TRACE_EVENT_END()
+
+void FStreamlineTrace::OutputFrameToken(uint64 FrameCounter, uint32 FrameIndex)
+{
+	UE_TRACE_LOG(Streamline, FrameToken, StreamlineChannel)
+		<< FrameToken.Cycle(FPlatformTime::Cycles64())
+		<< FrameToken.FrameCounter(FrameCounter)
+		<< FrameToken.FrameIndex(FrameIndex);
+}
+
+void FStreamlineTrace::OutputReflexMarker(uint64 FrameCounter, uint32 FrameIndex, uint32 Marker)
+{
+	UE_TRACE_LOG(Streamline, ReflexMarker, StreamlineChannel)
+		<< ReflexMarker.Cycle(FPlatformTime::Cycles64())
+		<< ReflexMarker.FrameCounter(FrameCounter)
+		<< ReflexMarker.FrameIndex(FrameIndex)
+		<< ReflexMarker.Marker(Marker);
+}
+
+void FStreamlineTrace::OutputTag(uint32 FrameIndex, uint32 ViewId, const TArrayView<const FRHIStreamlineResource> Resources)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(StreamlineChannel))
+	{
+		return;
+	}
+
+	static_assert(uint32(EStreamlineResource::Last) < 32, "EStreamlineResource doesn't fit into the Tag trace event ResourceMask anymore");
+	uint32 ResourceMask = 0;
+	for (const FRHIStreamlineResource& Resource : Resources)
+	{
+		ResourceMask |= 1u << uint32(Resource.StreamlineTag);
+	}
+
+	UE_TRACE_LOG(Streamline, Tag, StreamlineChannel)
+		<< Tag.Cycle(FPlatformTime::Cycles64())
+		<< Tag.FrameIndex(FrameIndex)
+		<< Tag.ViewId(ViewId)
+		<< Tag.ResourceMask(ResourceMask);
+}
+
+void FStreamlineTrace::OutputConstants(uint32 FrameIndex, uint32 ViewId)
+{
+	UE_TRACE_LOG(Streamline, Constants, StreamlineChannel)
+		<< Constants.Cycle(FPlatformTime::Cycles64())
+		<< Constants.FrameIndex(FrameIndex)
+		<< Constants.ViewId(ViewId);
+}
+
+FStreamlineTrace::FScope::FScope(EStreamlineTraceScope InType, uint32 InFeature, uint64 InFrame, uint32 InViewId)
+	: Frame(InFrame)
+	, Feature(InFeature)
+	, ViewId(InViewId)
+	, Type(InType)
+	, bEnabled(UE_TRACE_CHANNELEXPR_IS_ENABLED(StreamlineChannel))
+{
+	if (bEnabled)
+	{
+		StartCycle = FPlatformTime::Cycles64();
+	}
+}
+
+FStreamlineTrace::FScope::~FScope()
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	UE_TRACE_LOG(Streamline, Scope, StreamlineChannel)
+		<< Scope.StartCycle(StartCycle)
+		<< Scope.EndCycle(FPlatformTime::Cycles64())
+		<< Scope.Frame(Frame)
+		<< Scope.Feature(Feature)
+		<< Scope.ViewId(ViewId)
+		<< Scope.Type(uint8(Type));
+}
+
+#endif
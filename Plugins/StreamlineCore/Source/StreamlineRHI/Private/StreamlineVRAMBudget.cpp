@@ -0,0 +1,319 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineVRAMBudget.h"
+#include "StreamlineRHIPrivate.h"
+
+#include "Features/IModularFeatures.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+
+static TAutoConsoleVariable<int32> CVarStreamlineVRAMBudgetMiB(
+	TEXT("r.Streamline.VRAMBudget.MiB"),
+	0,
+	TEXT("Total amount of video memory in MiB that DLSS-SR/RR, DLSS-FG and DeepDVC together are allowed to use (default = 0)\n")
+	TEXT("0: no budget, footprints are only tracked and reported\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarStreamlineVRAMBudgetPolicy(
+	TEXT("r.Streamline.VRAMBudget.Policy"),
+	1,
+	TEXT("What to do when the NVIDIA rendering features exceed r.Streamline.VRAMBudget.MiB (default = 1)\n")
+	TEXT("0: warn only\n")
+	TEXT("1: reduce footprints one step at a time, in this order: evict idle DLSS features, lower the DLSS-FG frame count, disable DeepDVC\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamlineVRAMBudgetWarnFraction(
+	TEXT("r.Streamline.VRAMBudget.WarnFraction"),
+	0.9f,
+	TEXT("Fraction of the budget above which a warning gets logged before the budget is actually exceeded (default = 0.9)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamlineVRAMBudgetRestoreFraction(
+	TEXT("r.Streamline.VRAMBudget.RestoreFraction"),
+	0.75f,
+	TEXT("A reduction gets undone once the total footprint, including what the reduction is expected to give back, stays below this fraction of the budget (default = 0.75)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamlineVRAMBudgetUpdateInterval(
+	TEXT("r.Streamline.VRAMBudget.UpdateInterval"),
+	0.5f,
+	TEXT("Seconds between budget updates. At most one reduction or restore happens per update, so features get a chance to release memory before the next step (default = 0.5)\n"),
+	ECVF_Default);
+
+DECLARE_STATS_GROUP(TEXT("Streamline VRAM Budget"), STATGROUP_StreamlineVRAMBudget, STATCAT_Advanced);
+DECLARE_MEMORY_STAT(TEXT("Total Footprint"), STAT_StreamlineVRAMBudgetTotal, STATGROUP_StreamlineVRAMBudget);
+DECLARE_MEMORY_STAT(TEXT("Budget"), STAT_StreamlineVRAMBudgetBudget, STATGROUP_StreamlineVRAMBudget);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Reductions"), STAT_StreamlineVRAMBudgetActiveReductions, STATGROUP_StreamlineVRAMBudget);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Reductions"), STAT_StreamlineVRAMBudgetReductions, STATGROUP_StreamlineVRAMBudget);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Restores"), STAT_StreamlineVRAMBudgetRestores, STATGROUP_StreamlineVRAMBudget);
+
+namespace
+{
+
+const TCHAR* GetReductionName(ENVRenderingFeatureMemoryReduction Reduction)
+{
+	switch (Reduction)
+	{
+	case ENVRenderingFeatureMemoryReduction::None:			return TEXT("None");
+	case ENVRenderingFeatureMemoryReduction::EvictIdle:		return TEXT("EvictIdle");
+	case ENVRenderingFeatureMemoryReduction::ReduceQuality:	return TEXT("ReduceQuality");
+	case ENVRenderingFeatureMemoryReduction::Disable:		return TEXT("Disable");
+	default:												return TEXT("Unknown");
+	}
+}
+
+double ToMiB(uint64 Bytes)
+{
+	return double(Bytes) / (1024.0 * 1024.0);
+}
+
+// Gathers the footprints of all INVRenderingFeatureMemoryReporter implementations once per update interval and,
+// when a budget is set, steps through the cheapest reductions until the total fits again. Game thread only
+class FStreamlineVRAMBudgetManager
+{
+public:
+	static FStreamlineVRAMBudgetManager& Get()
+	{
+		static FStreamlineVRAMBudgetManager Manager;
+		return Manager;
+	}
+
+	void Register()
+	{
+		if (!EndFrameHandle.IsValid())
+		{
+			EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FStreamlineVRAMBudgetManager::Tick);
+		}
+	}
+
+	void Unregister()
+	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		EndFrameHandle.Reset();
+	}
+
+	const FStreamlineVRAMBudgetStatus& GetStatus()
+	{
+		// callers might ask before the first tick or after a long time without rendering
+		if (LastUpdateTime < 0.0)
+		{
+			GatherFootprints();
+		}
+		return Status;
+	}
+
+	void SetBudgetOverride(uint64 BudgetBytes)
+	{
+		BudgetOverrideBytes = BudgetBytes;
+		// pick up the new budget on the next frame rather than after the update interval
+		LastUpdateTime = -1.0;
+	}
+
+private:
+	uint64 GetBudgetBytes() const
+	{
+		if (BudgetOverrideBytes > 0)
+		{
+			return BudgetOverrideBytes;
+		}
+		return uint64(FMath::Max(0, CVarStreamlineVRAMBudgetMiB.GetValueOnGameThread())) * 1024 * 1024;
+	}
+
+	void GatherFootprints()
+	{
+		TArray<INVRenderingFeatureMemoryReporter*> Reporters = IModularFeatures::Get().GetModularFeatureImplementations<INVRenderingFeatureMemoryReporter>(INVRenderingFeatureMemoryReporter::GetModularFeatureName());
+
+		Status.Footprints.Reset();
+		FeatureReporters.Reset();
+		Status.TotalBytes = 0;
+
+		for (INVRenderingFeatureMemoryReporter* Reporter : Reporters)
+		{
+			if (Reporter->GetInterfaceVersion() != NV_RENDERING_FEATURE_MEMORY_INTERFACE_VERSION)
+			{
+				if (!IncompatibleReporters.Contains(Reporter))
+				{
+					IncompatibleReporters.Add(Reporter);
+					UE_LOG(LogStreamlineRHI, Warning, TEXT("VRAM budget: ignoring a memory reporter built against version %u of NVRenderingFeatureMemory.h instead of %u, update the DLSS and Streamline plugins to the same release"),
+						Reporter->GetInterfaceVersion(), NV_RENDERING_FEATURE_MEMORY_INTERFACE_VERSION);
+				}
+				continue;
+			}
+
+			const int32 FirstFootprint = Status.Footprints.Num();
+			Reporter->GetFootprints(Status.Footprints);
+
+			for (int32 Index = FirstFootprint; Index < Status.Footprints.Num(); ++Index)
+			{
+				FeatureReporters.Add(Status.Footprints[Index].Feature, Reporter);
+				Status.TotalBytes += Status.Footprints[Index].Bytes;
+			}
+		}
+
+		Status.BudgetBytes = GetBudgetBytes();
+		Status.bOverBudget = Status.BudgetBytes > 0 && Status.TotalBytes > Status.BudgetBytes;
+		Status.bOverWarnThreshold = Status.BudgetBytes > 0 && double(Status.TotalBytes) > double(Status.BudgetBytes) * CVarStreamlineVRAMBudgetWarnFraction.GetValueOnGameThread();
+	}
+
+	const FNVRenderingFeatureFootprint* FindFootprint(FName Feature) const
+	{
+		return Status.Footprints.FindByPredicate([Feature](const FNVRenderingFeatureFootprint& Footprint) { return Footprint.Feature == Feature; });
+	}
+
+	bool TryReduce()
+	{
+		// cheapest reduction first, and among those the feature that gives back the most
+		const FNVRenderingFeatureFootprint* Candidate = nullptr;
+		for (const FNVRenderingFeatureFootprint& Footprint : Status.Footprints)
+		{
+			if (Footprint.Reduction == ENVRenderingFeatureMemoryReduction::None || Footprint.Bytes == 0)
+			{
+				continue;
+			}
+			if (!Candidate || Footprint.Reduction < Candidate->Reduction || (Footprint.Reduction == Candidate->Reduction && Footprint.Bytes > Candidate->Bytes))
+			{
+				Candidate = &Footprint;
+			}
+		}
+
+		if (!Candidate)
+		{
+			return false;
+		}
+
+		INVRenderingFeatureMemoryReporter* Reporter = FeatureReporters.FindRef(Candidate->Feature);
+		if (!Reporter || !Reporter->ReduceFootprint(Candidate->Feature, Candidate->Reduction))
+		{
+			return false;
+		}
+
+		UE_LOG(LogStreamlineRHI, Log, TEXT("VRAM budget: %.1f MiB used of %.1f MiB, applying %s to %s (%.1f MiB)"),
+			ToMiB(Status.TotalBytes), ToMiB(Status.BudgetBytes), GetReductionName(Candidate->Reduction), *Candidate->Feature.ToString(), ToMiB(Candidate->Bytes));
+
+		FStreamlineVRAMBudgetReduction& Reduction = Status.Reductions.AddDefaulted_GetRef();
+		Reduction.Feature = Candidate->Feature;
+		Reduction.Reduction = Candidate->Reduction;
+		Reduction.BytesBeforeReduction = Candidate->Bytes;
+		INC_DWORD_STAT(STAT_StreamlineVRAMBudgetReductions);
+		return true;
+	}
+
+	void RestoreLast(bool bForce)
+	{
+		// undo in reverse order, so the most noticeable reductions go away first
+		const FStreamlineVRAMBudgetReduction& Reduction = Status.Reductions.Last();
+
+		INVRenderingFeatureMemoryReporter* Reporter = FeatureReporters.FindRef(Reduction.Feature);
+		if (Reporter && !bForce)
+		{
+			const FNVRenderingFeatureFootprint* Footprint = FindFootprint(Reduction.Feature);
+			const uint64 CurrentBytes = Footprint ? Footprint->Bytes : 0;
+			const uint64 ExpectedTotal = Status.TotalBytes - FMath::Min(CurrentBytes, Status.TotalBytes) + FMath::Max(CurrentBytes, Reduction.BytesBeforeReduction);
+			if (double(ExpectedTotal) >= double(Status.BudgetBytes) * CVarStreamlineVRAMBudgetRestoreFraction.GetValueOnGameThread())
+			{
+				return;
+			}
+		}
+
+		// a feature whose reporter went away (e.g. the DLSS plugin got unloaded) has nothing to restore anymore
+		if (Reporter)
+		{
+			UE_LOG(LogStreamlineRHI, Log, TEXT("VRAM budget: %.1f MiB used of %.1f MiB, undoing %s of %s"),
+				ToMiB(Status.TotalBytes), ToMiB(Status.BudgetBytes), GetReductionName(Reduction.Reduction), *Reduction.Feature.ToString());
+			Reporter->RestoreFootprint(Reduction.Feature, Reduction.Reduction);
+			INC_DWORD_STAT(STAT_StreamlineVRAMBudgetRestores);
+		}
+
+		Status.Reductions.Pop();
+	}
+
+	void Tick()
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (LastUpdateTime >= 0.0 && Now - LastUpdateTime < CVarStreamlineVRAMBudgetUpdateInterval.GetValueOnGameThread())
+		{
+			return;
+		}
+		LastUpdateTime = Now;
+
+		GatherFootprints();
+
+		SET_MEMORY_STAT(STAT_StreamlineVRAMBudgetTotal, Status.TotalBytes);
+		SET_MEMORY_STAT(STAT_StreamlineVRAMBudgetBudget, Status.BudgetBytes);
+
+		const bool bReduce = Status.BudgetBytes > 0 && CVarStreamlineVRAMBudgetPolicy.GetValueOnGameThread() > 0;
+
+		if (Status.bOverWarnThreshold && !bWarned)
+		{
+			UE_LOG(LogStreamlineRHI, Warning, TEXT("VRAM budget: NVIDIA rendering features use %.1f MiB of the %.1f MiB budget%s"),
+				ToMiB(Status.TotalBytes), ToMiB(Status.BudgetBytes), Status.bOverBudget ? (bReduce ? TEXT(", reducing") : TEXT(", r.Streamline.VRAMBudget.Policy is warn only")) : TEXT(""));
+			for (const FNVRenderingFeatureFootprint& Footprint : Status.Footprints)
+			{
+				UE_LOG(LogStreamlineRHI, Log, TEXT("  %s: %.1f MiB"), *Footprint.Feature.ToString(), ToMiB(Footprint.Bytes));
+			}
+		}
+		bWarned = Status.bOverWarnThreshold;
+
+		if (Status.bOverBudget && bReduce)
+		{
+			TryReduce();
+		}
+		else if (Status.Reductions.Num() > 0)
+		{
+			// no budget or reductions turned off means everything can come back right away
+			RestoreLast(!bReduce);
+		}
+
+		SET_DWORD_STAT(STAT_StreamlineVRAMBudgetActiveReductions, Status.Reductions.Num());
+	}
+
+	FDelegateHandle EndFrameHandle;
+	FStreamlineVRAMBudgetStatus Status;
+	// rebuilt on every update, reporters can come and go with their modules
+	TMap<FName, INVRenderingFeatureMemoryReporter*> FeatureReporters;
+	// only to warn once per reporter
+	TSet<INVRenderingFeatureMemoryReporter*> IncompatibleReporters;
+	uint64 BudgetOverrideBytes = 0;
+	double LastUpdateTime = -1.0;
+	bool bWarned = false;
+};
+
+} // anonymous namespace
+
+STREAMLINERHI_API FStreamlineVRAMBudgetStatus GetStreamlineVRAMBudgetStatus()
+{
+	check(IsInGameThread());
+	return FStreamlineVRAMBudgetManager::Get().GetStatus();
+}
+
+STREAMLINERHI_API uint64 GetStreamlineVRAMBudgetTotalBytes()
+{
+	check(IsInGameThread());
+	return FStreamlineVRAMBudgetManager::Get().GetStatus().TotalBytes;
+}
+
+STREAMLINERHI_API void SetStreamlineVRAMBudgetOverride(uint64 BudgetBytes)
+{
+	check(IsInGameThread());
+	FStreamlineVRAMBudgetManager::Get().SetBudgetOverride(BudgetBytes);
+}
+
+void RegisterStreamlineVRAMBudgetManager()
+{
+	FStreamlineVRAMBudgetManager::Get().Register();
+}
+
+void UnregisterStreamlineVRAMBudgetManager()
+{
+	FStreamlineVRAMBudgetManager::Get().Unregister();
+}
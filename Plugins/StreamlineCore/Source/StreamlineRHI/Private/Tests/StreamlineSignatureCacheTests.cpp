@@ -0,0 +1,258 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineSignatureCache.h"
+
+#include "HAL/FileManager.h"
+#include "Hash/Blake3.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	class FFakeStreamlineSignatureVerifier : public IStreamlineSignatureVerifier
+	{
+	public:
+		virtual bool VerifyEmbeddedSignature(const FString& PathToBinary) override
+		{
+			++NumCalls;
+			return bSigned;
+		}
+
+		int32 NumCalls = 0;
+		bool bSigned = true;
+	};
+
+	// BLAKE3 from the engine stands in for SHA-256, and a keyed hash for the HMAC, so the tests run on every platform.
+	// What's under test is how the cache uses them, not the primitives
+	class FFakeStreamlineSignatureCacheCrypto : public IStreamlineSignatureCacheCrypto
+	{
+	public:
+		virtual bool HashSHA256(TConstArrayView<uint8> Data, FStreamlineSHA256& OutHash) override
+		{
+			return HMACSHA256(TConstArrayView<uint8>(), Data, OutHash);
+		}
+
+		virtual bool HMACSHA256(TConstArrayView<uint8> InKey, TConstArrayView<uint8> Data, FStreamlineSHA256& OutHMAC) override
+		{
+			static_assert(sizeof(FBlake3Hash::ByteArray) == sizeof(OutHMAC.Hash), "BLAKE3 and SHA-256 digests have the same size");
+
+			FBlake3 Hasher;
+			Hasher.Update(InKey.GetData(), InKey.Num());
+			Hasher.Update(Data.GetData(), Data.Num());
+			FMemory::Memcpy(OutHMAC.Hash, Hasher.Finalize().GetBytes(), sizeof(OutHMAC.Hash));
+			return true;
+		}
+
+		virtual TArray<uint8> LoadOrCreateKey() override
+		{
+			return Key;
+		}
+
+		TArray<uint8> Key;
+	};
+
+	// a fake binary and the cache file in a scratch directory, deleted again at the end of the test
+	struct FStreamlineSignatureCacheTestFiles
+	{
+		FString Directory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("StreamlineSignatureCache"));
+		FString Binary = FPaths::Combine(Directory, TEXT("sl.fake.dll"));
+		FString CacheFile = FPaths::Combine(Directory, TEXT("SignatureCache.bin"));
+		FFakeStreamlineSignatureCacheCrypto Crypto;
+
+		FStreamlineSignatureCacheTestFiles()
+		{
+			IFileManager::Get().DeleteDirectory(*Directory, false, true);
+			WriteBinary({ 1, 2, 3, 4, 5, 6, 7, 8 });
+			Crypto.Key.Init(0x5a, 32);
+		}
+
+		~FStreamlineSignatureCacheTestFiles()
+		{
+			IFileManager::Get().DeleteDirectory(*Directory, false, true);
+		}
+
+		void WriteBinary(const TArray<uint8>& Content) const
+		{
+			FFileHelper::SaveArrayToFile(Content, *Binary);
+		}
+
+		// every call uses a new cache instance, so everything but the first call goes through the cache file
+		bool Verify(IStreamlineSignatureVerifier& Verifier, bool& bOutCacheHit, const TArray<uint8>* OverrideKey = nullptr)
+		{
+			FFakeStreamlineSignatureCacheCrypto OverrideCrypto;
+			if (OverrideKey)
+			{
+				OverrideCrypto.Key = *OverrideKey;
+			}
+			FStreamlineSignatureCache Cache(Verifier, OverrideKey ? OverrideCrypto : Crypto, CacheFile);
+			return Cache.Verify(Binary, &bOutCacheHit);
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineSignatureCacheHitTest, "Plugins.Streamline.SignatureCache.Hit",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineSignatureCacheHitTest::RunTest(const FString& Parameters)
+{
+	FStreamlineSignatureCacheTestFiles Files;
+	FFakeStreamlineSignatureVerifier Verifier;
+	bool bCacheHit = false;
+
+	TestTrue(TEXT("First verification succeeds"), Files.Verify(Verifier, bCacheHit));
+	TestFalse(TEXT("First verification is a miss"), bCacheHit);
+	TestEqual(TEXT("First verification runs the verifier"), Verifier.NumCalls, 1);
+
+	TestTrue(TEXT("Second verification succeeds"), Files.Verify(Verifier, bCacheHit));
+	TestTrue(TEXT("Second verification is a hit"), bCacheHit);
+	TestEqual(TEXT("Second verification skips the verifier"), Verifier.NumCalls, 1);
+
+	// a different key can't authenticate the cache file
+	TArray<uint8> OtherKey;
+	OtherKey.Init(0xa5, 32);
+	TestTrue(TEXT("Verification with another key succeeds"), Files.Verify(Verifier, bCacheHit, &OtherKey));
+	TestFalse(TEXT("Verification with another key is a miss"), bCacheHit);
+	TestEqual(TEXT("Verification with another key runs the verifier"), Verifier.NumCalls, 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineSignatureCacheMissOnChangeTest, "Plugins.Streamline.SignatureCache.MissOnChange",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineSignatureCacheMissOnChangeTest::RunTest(const FString& Parameters)
+{
+	FStreamlineSignatureCacheTestFiles Files;
+	FFakeStreamlineSignatureVerifier Verifier;
+	bool bCacheHit = false;
+
+	Files.Verify(Verifier, bCacheHit);
+	Files.Verify(Verifier, bCacheHit);
+	TestTrue(TEXT("Unchanged binary is a hit"), bCacheHit);
+
+	// size
+	Files.WriteBinary({ 1, 2, 3, 4, 5, 6, 7, 8, 9 });
+	Files.Verify(Verifier, bCacheHit);
+	TestFalse(TEXT("Size change is a miss"), bCacheHit);
+	Files.Verify(Verifier, bCacheHit);
+	TestTrue(TEXT("Reverified binary is a hit"), bCacheHit);
+
+	// last write time only
+	const FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*Files.Binary);
+	IFileManager::Get().SetTimeStamp(*Files.Binary, TimeStamp + FTimespan::FromHours(1.0));
+	Files.Verify(Verifier, bCacheHit);
+	TestFalse(TEXT("Last write time change is a miss"), bCacheHit);
+
+	// content only, same size and last write time
+	const FDateTime ContentTimeStamp = IFileManager::Get().GetTimeStamp(*Files.Binary);
+	Files.WriteBinary({ 9, 8, 7, 6, 5, 4, 3, 2, 1 });
+	IFileManager::Get().SetTimeStamp(*Files.Binary, ContentTimeStamp);
+	Files.Verify(Verifier, bCacheHit);
+	TestFalse(TEXT("Content change is a miss"), bCacheHit);
+
+	TestEqual(TEXT("Every miss runs the verifier"), Verifier.NumCalls, 4);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineSignatureCacheTamperTest, "Plugins.Streamline.SignatureCache.RejectsTamperedCache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineSignatureCacheTamperTest::RunTest(const FString& Parameters)
+{
+	FStreamlineSignatureCacheTestFiles Files;
+	FFakeStreamlineSignatureVerifier Verifier;
+	bool bCacheHit = false;
+
+	Files.Verify(Verifier, bCacheHit);
+
+	TArray<uint8> CacheData;
+	if (!TestTrue(TEXT("Cache file was written"), FFileHelper::LoadFileToArray(CacheData, *Files.CacheFile)))
+	{
+		return false;
+	}
+
+	// flip one bit of every byte in turn, none of these may be accepted
+	for (int32 ByteIndex = 0; ByteIndex < CacheData.Num(); ++ByteIndex)
+	{
+		TArray<uint8> Tampered = CacheData;
+		Tampered[ByteIndex] ^= 0x01;
+		FFileHelper::SaveArrayToFile(Tampered, *Files.CacheFile);
+
+		Files.Verify(Verifier, bCacheHit);
+		if (!TestFalse(FString::Printf(TEXT("Cache with byte %d modified is rejected"), ByteIndex), bCacheHit))
+		{
+			break;
+		}
+	}
+
+	// a rejected cache doesn't stop a valid one from getting written again
+	Files.Verify(Verifier, bCacheHit);
+	TestTrue(TEXT("Cache is rebuilt after tampering"), bCacheHit);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineSignatureCacheDropFailedTest, "Plugins.Streamline.SignatureCache.DropsFailedEntries",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineSignatureCacheDropFailedTest::RunTest(const FString& Parameters)
+{
+	FStreamlineSignatureCacheTestFiles Files;
+	FFakeStreamlineSignatureVerifier Verifier;
+	bool bCacheHit = false;
+
+	Files.Verify(Verifier, bCacheHit);
+
+	// the binary gets replaced by one that doesn't verify
+	Files.WriteBinary({ 42, 42, 42 });
+	Verifier.bSigned = false;
+	{
+		FStreamlineSignatureCache Cache(Verifier, Files.Crypto, Files.CacheFile);
+		TestFalse(TEXT("Unsigned binary fails"), Cache.Verify(Files.Binary, &bCacheHit));
+		TestFalse(TEXT("Unsigned binary is not served from the cache"), bCacheHit);
+		TestEqual(TEXT("Failed entry is dropped"), Cache.GetNumEntries(), 0);
+	}
+
+	// also from the cache file, so it can't come back on the next launch, not even after restoring the original binary
+	Files.WriteBinary({ 1, 2, 3, 4, 5, 6, 7, 8 });
+	TestFalse(TEXT("Failed verifications are never cached"), Files.Verify(Verifier, bCacheHit));
+	TestFalse(TEXT("Restored binary is a miss"), bCacheHit);
+	TestEqual(TEXT("Every verification ran the verifier"), Verifier.NumCalls, 3);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineSignatureCacheNoKeyTest, "Plugins.Streamline.SignatureCache.DisabledWithoutKey",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineSignatureCacheNoKeyTest::RunTest(const FString& Parameters)
+{
+	FStreamlineSignatureCacheTestFiles Files;
+	FFakeStreamlineSignatureVerifier Verifier;
+	bool bCacheHit = false;
+
+	// e.g. DPAPI not being usable, then every verification is a full one and nothing gets written
+	Files.Crypto.Key.Reset();
+	Files.Verify(Verifier, bCacheHit);
+	Files.Verify(Verifier, bCacheHit);
+	TestFalse(TEXT("Verification without a key is a miss"), bCacheHit);
+	TestEqual(TEXT("Every verification without a key runs the verifier"), Verifier.NumCalls, 2);
+	TestFalse(TEXT("No cache file is written without a key"), IFileManager::Get().FileExists(*Files.CacheFile));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
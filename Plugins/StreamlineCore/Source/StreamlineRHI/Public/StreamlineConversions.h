@@ -77,3 +77,38 @@ inline sl::BufferType ToSL(EStreamlineResource InResourceTag)
 	}
 }
 
+inline sl::Constants ToSL(const FRHIStreamlineArguments& InArguments)
+{
+	sl::Constants StreamlineConstants = {};
+
+	StreamlineConstants.reset = ToSL(InArguments.bReset);
+	StreamlineConstants.jitterOffset = ToSL(InArguments.JitterOffset);
+
+	StreamlineConstants.depthInverted = ToSL(InArguments.bIsDepthInverted);
+
+	StreamlineConstants.mvecScale = ToSL(InArguments.MotionVectorScale);
+	StreamlineConstants.motionVectorsDilated = ToSL(InArguments.bAreMotionVectorsDilated);
+	StreamlineConstants.cameraMotionIncluded = sl::eTrue;
+	StreamlineConstants.motionVectors3D = sl::eFalse;
+
+	StreamlineConstants.orthographicProjection = ToSL(InArguments.bIsOrthographicProjection);
+	StreamlineConstants.cameraViewToClip = ToSL(InArguments.CameraViewToClip, InArguments.bIsOrthographicProjection);
+	StreamlineConstants.clipToCameraView = ToSL(InArguments.ClipToCameraView);
+	StreamlineConstants.clipToLensClip = ToSL(InArguments.ClipToLenseClip);
+	StreamlineConstants.clipToPrevClip = ToSL(InArguments.ClipToPrevClip);
+	StreamlineConstants.prevClipToClip = ToSL(InArguments.PrevClipToClip);
+
+	StreamlineConstants.cameraPos = ToSL(InArguments.CameraOrigin);
+	StreamlineConstants.cameraUp = ToSL(InArguments.CameraUp);
+	StreamlineConstants.cameraRight = ToSL(InArguments.CameraRight);
+	StreamlineConstants.cameraFwd = ToSL(InArguments.CameraForward);
+
+	StreamlineConstants.cameraNear = InArguments.CameraNear;
+	StreamlineConstants.cameraFar = InArguments.CameraFar;
+	StreamlineConstants.cameraFOV = FMath::DegreesToRadians(InArguments.CameraFOV);
+	StreamlineConstants.cameraAspectRatio = InArguments.CameraAspectRatio;
+
+	StreamlineConstants.cameraPinholeOffset = ToSL(InArguments.CameraPinholeOffset);
+
+	return StreamlineConstants;
+}
@@ -224,6 +224,8 @@ public:
 	virtual ~FStreamlineRHI();
 
 	virtual void SetStreamlineData(FRHICommandList& CmdList, const FRHIStreamlineArguments& InArguments);
+	// sets the constants of multiple views (e.g. split screen) back to back
+	virtual void SetStreamlineData(FRHICommandList& CmdList, TConstArrayView<FRHIStreamlineArguments> InArguments);
 	void StreamlineEvaluateDeepDVC(FRHICommandList& CmdList, const FRHIStreamlineResource& InputOutput, sl::FrameToken* FrameToken, uint32 ViewID);
 	
 	void TagTextures(FRHICommandList& CmdList, uint32 InViewID, const sl::FrameToken& FrameToken, std::initializer_list< FRHIStreamlineResource> InResources)
@@ -282,6 +284,9 @@ public:
 	bool IsSwapchainHookingAllowed() const;
 	bool IsSwapchainProviderInstalled() const;
 	void ReleaseStreamlineResourcesForAllFeatures(uint32 ViewID);
+	void ReleaseStreamlineResources(sl::Feature Feature, uint32 ViewID);
+	// DeviceTexture only selects the GPU whose command list the allocation gets recorded into
+	void AllocateStreamlineResources(FRHICommandList& CmdList, sl::Feature Feature, uint32 ViewID, FRHITexture* DeviceTexture);
 
 	// that needs to call some virtual methods that we can't call in the ctor. Just C++ things
 	void PostPlatformRHICreateInit();
@@ -0,0 +1,81 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Config.h"
+#include "Trace/Trace.h"
+
+#ifndef STREAMLINE_TRACE_ENABLED
+#define STREAMLINE_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif
+
+class FRHIStreamlineResource;
+
+// Event types of the "Streamline" trace logger. Keep in sync with FStreamlineTraceAnalyzer in the StreamlineInsights module
+enum class EStreamlineTraceScope : uint8
+{
+	Evaluate,
+	Present,
+};
+
+#if STREAMLINE_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(StreamlineChannel, STREAMLINERHI_API)
+
+struct STREAMLINERHI_API FStreamlineTrace
+{
+	// A new sl::FrameToken got handed out for an engine frame
+	static void OutputFrameToken(uint64 FrameCounter, uint32 FrameIndex);
+
+	// Reflex/PCL marker (sl::PCLMarker) set for an engine frame
+	static void OutputReflexMarker(uint64 FrameCounter, uint32 FrameIndex, uint32 Marker);
+
+	// slSetTag/slSetTagForFrame for a view. ResourceMask has one bit per EStreamlineResource
+	static void OutputTag(uint32 FrameIndex, uint32 ViewId, const TArrayView<const FRHIStreamlineResource> Resources);
+
+	// slSetConstants for a view
+	static void OutputConstants(uint32 FrameIndex, uint32 ViewId);
+
+	// CPU time spent in an evaluate or present callback, emitted as one event once the scope closes.
+	// Frame is the sl::FrameToken index for evaluate scopes and the engine frame counter for present scopes
+	struct STREAMLINERHI_API FScope
+	{
+		FScope(EStreamlineTraceScope InType, uint32 InFeature, uint64 InFrame, uint32 InViewId);
+		~FScope();
+
+	private:
+		uint64 StartCycle = 0;
+		uint64 Frame = 0;
+		uint32 Feature = 0;
+		uint32 ViewId = 0;
+		EStreamlineTraceScope Type;
+		bool bEnabled = false;
+	};
+};
+
+#define TRACE_STREAMLINE_FRAME_TOKEN(FrameCounter, FrameIndex) FStreamlineTrace::OutputFrameToken(FrameCounter, FrameIndex)
+#define TRACE_STREAMLINE_REFLEX_MARKER(FrameCounter, FrameIndex, Marker) FStreamlineTrace::OutputReflexMarker(FrameCounter, FrameIndex, Marker)
+#define TRACE_STREAMLINE_TAG(FrameIndex, ViewId, Resources) FStreamlineTrace::OutputTag(FrameIndex, ViewId, Resources)
+#define TRACE_STREAMLINE_CONSTANTS(FrameIndex, ViewId) FStreamlineTrace::OutputConstants(FrameIndex, ViewId)
+#define TRACE_STREAMLINE_EVALUATE_SCOPE(Feature, FrameIndex, ViewId) FStreamlineTrace::FScope PREPROCESSOR_JOIN(StreamlineTraceScope, __LINE__)(EStreamlineTraceScope::Evaluate, Feature, FrameIndex, ViewId)
+#define TRACE_STREAMLINE_PRESENT_SCOPE(Feature, FrameCounter) FStreamlineTrace::FScope PREPROCESSOR_JOIN(StreamlineTraceScope, __LINE__)(EStreamlineTraceScope::Present, Feature, FrameCounter, 0)
+
+#else
+
+#define TRACE_STREAMLINE_FRAME_TOKEN(FrameCounter, FrameIndex)
+#define TRACE_STREAMLINE_REFLEX_MARKER(FrameCounter, FrameIndex, Marker)
+#define TRACE_STREAMLINE_TAG(FrameIndex, ViewId, Resources)
+#define TRACE_STREAMLINE_CONSTANTS(FrameIndex, ViewId)
+#define TRACE_STREAMLINE_EVALUATE_SCOPE(Feature, FrameIndex, ViewId)
+#define TRACE_STREAMLINE_PRESENT_SCOPE(Feature, FrameCounter)
+
+#endif
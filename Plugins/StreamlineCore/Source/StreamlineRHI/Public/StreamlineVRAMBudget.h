@@ -0,0 +1,44 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NVRenderingFeatureMemory.h"
+
+struct FStreamlineVRAMBudgetReduction
+{
+	FName Feature;
+	ENVRenderingFeatureMemoryReduction Reduction = ENVRenderingFeatureMemoryReduction::None;
+	// footprint of the feature right before the reduction got applied, what restoring it is expected to cost again
+	uint64 BytesBeforeReduction = 0;
+};
+
+struct FStreamlineVRAMBudgetStatus
+{
+	// sum of all footprints reported by DLSS-SR/RR, DLSS-FG, DeepDVC, ... as of the last budget update
+	uint64 TotalBytes = 0;
+	// 0 if no budget is configured
+	uint64 BudgetBytes = 0;
+	bool bOverBudget = false;
+	bool bOverWarnThreshold = false;
+	TArray<FNVRenderingFeatureFootprint> Footprints;
+	// currently applied reductions, oldest first
+	TArray<FStreamlineVRAMBudgetReduction> Reductions;
+};
+
+// game thread. Single query for streaming budget code to account for what the NVIDIA rendering features currently hold
+extern STREAMLINERHI_API FStreamlineVRAMBudgetStatus GetStreamlineVRAMBudgetStatus();
+extern STREAMLINERHI_API uint64 GetStreamlineVRAMBudgetTotalBytes();
+// overrides r.Streamline.VRAMBudget.MiB, pass 0 to go back to the cvar
+extern STREAMLINERHI_API void SetStreamlineVRAMBudgetOverride(uint64 BudgetBytes);
+
+void RegisterStreamlineVRAMBudgetManager();
+void UnregisterStreamlineVRAMBudgetManager();
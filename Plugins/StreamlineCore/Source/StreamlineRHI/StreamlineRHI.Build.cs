@@ -47,6 +47,7 @@ public class StreamlineRHI : ModuleRules
 				"RenderCore",
 				"RHI",
 				"Streamline",
+				"TraceLog",
 			}
 			);
 		DynamicallyLoadedModuleNames.AddRange(
@@ -0,0 +1,78 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineAsyncCompute.h"
+#include "NVInputPassUtils.h"
+
+#include "HAL/IConsoleManager.h"
+#include "RenderingThread.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogStreamlineAsyncCompute, Log, All);
+
+static TAutoConsoleVariable<int32> CVarStreamlineAsyncCompute(
+	TEXT("r.Streamline.AsyncCompute"),
+	0,
+	TEXT("Whether the Streamline input passes listed in r.Streamline.AsyncCompute.Passes get added as async compute passes (default = 0)\n")
+	TEXT("They only overlap with graphics work if the RHI supports async compute and r.RDG.AsyncCompute is enabled\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<FString> CVarStreamlineAsyncComputePasses(
+	TEXT("r.Streamline.AsyncCompute.Passes"),
+	TEXT("VelocityCombine,UIHintExtraction,UICoverage"),
+	TEXT("Comma separated list of the Streamline input passes r.Streamline.AsyncCompute applies to. Can be set per project or platform in the [SystemSettings] ini section\n")
+	TEXT("Valid names: VelocityCombine, UIHintExtraction, UICoverage (default = VelocityCombine,UIHintExtraction,UICoverage)\n"),
+	ECVF_RenderThreadSafe);
+
+static const TCHAR* const GStreamlineComputePassNames[] =
+{
+	TEXT("VelocityCombine"),
+	TEXT("UIHintExtraction"),
+	TEXT("UICoverage"),
+};
+static_assert(UE_ARRAY_COUNT(GStreamlineComputePassNames) == uint32(EStreamlineComputePass::Num), "GStreamlineComputePassNames does not match EStreamlineComputePass");
+
+namespace
+{
+	// r.Streamline.AsyncCompute.Passes parsed into one bit per EStreamlineComputePass. Render thread only
+	TNVAsyncComputePolicy<EStreamlineComputePass> GStreamlineAsyncComputePolicy(GStreamlineComputePassNames);
+
+	void UpdateStreamlineAsyncComputePolicy()
+	{
+		if (GStreamlineAsyncComputePolicy.Update(CVarStreamlineAsyncComputePasses.GetValueOnRenderThread()))
+		{
+			for (const FString& UnknownPass : GStreamlineAsyncComputePolicy.GetUnknownPasses())
+			{
+				UE_LOG(LogStreamlineAsyncCompute, Warning, TEXT("Ignoring unknown pass '%s' in r.Streamline.AsyncCompute.Passes"), *UnknownPass);
+			}
+		}
+	}
+}
+
+const TCHAR* GetStreamlineComputePassName(EStreamlineComputePass Pass)
+{
+	return GStreamlineComputePassNames[int32(Pass)];
+}
+
+ERDGPassFlags GetStreamlineComputePassFlags(EStreamlineComputePass Pass)
+{
+	check(IsInRenderingThread());
+
+	if (CVarStreamlineAsyncCompute.GetValueOnRenderThread() != 0)
+	{
+		UpdateStreamlineAsyncComputePolicy();
+		if (GStreamlineAsyncComputePolicy.IsAsync(Pass))
+		{
+			return ERDGPassFlags::AsyncCompute;
+		}
+	}
+
+	return ERDGPassFlags::Compute;
+}
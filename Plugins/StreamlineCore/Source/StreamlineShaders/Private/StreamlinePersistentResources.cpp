@@ -0,0 +1,87 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlinePersistentResources.h"
+
+#include "HAL/IConsoleManager.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "RenderingThread.h"
+#include "RenderUtils.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogStreamlinePersistentResources, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("Streamline Persistent Resources"), STATGROUP_StreamlinePersistentResources, STATCAT_Advanced);
+DECLARE_MEMORY_STAT(TEXT("Persistent Textures"), STAT_StreamlinePersistentTextureMemory, STATGROUP_StreamlinePersistentResources);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Textures Registered"), STAT_StreamlinePersistentTexturesRegistered, STATGROUP_StreamlinePersistentResources);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Textures Created"), STAT_StreamlinePersistentTexturesCreated, STATGROUP_StreamlinePersistentResources);
+
+static TGlobalResource<FStreamlinePersistentResources> GStreamlinePersistentResources;
+
+FStreamlinePersistentResources& FStreamlinePersistentResources::Get()
+{
+	return GStreamlinePersistentResources;
+}
+
+FRDGTextureRef FStreamlinePersistentResources::RegisterTexture(FRDGBuilder& GraphBuilder, const TCHAR* Name, const FRDGTextureDesc& Desc, TFunctionRef<void(FRDGBuilder&, FRDGTextureRef)> Initialize)
+{
+	check(IsInRenderingThread());
+	INC_DWORD_STAT(STAT_StreamlinePersistentTexturesRegistered);
+
+	FPersistentTexture& Texture = Textures.FindOrAdd(FName(Name));
+	if (Texture.PooledTexture.IsValid() && Texture.Desc == Desc)
+	{
+		return GraphBuilder.RegisterExternalTexture(Texture.PooledTexture);
+	}
+
+	INC_DWORD_STAT(STAT_StreamlinePersistentTexturesCreated);
+
+	FRDGTextureRef RDGTexture = GraphBuilder.CreateTexture(Desc, Name);
+	Initialize(GraphBuilder, RDGTexture);
+
+	MemorySize -= Texture.Size;
+	Texture.PooledTexture = GraphBuilder.ConvertToExternalTexture(RDGTexture);
+	Texture.Desc = Desc;
+	Texture.Size = CalcTextureSize(Desc.Extent.X, Desc.Extent.Y, Desc.Format, Desc.NumMips) * Desc.ArraySize * Desc.Depth;
+	MemorySize += Texture.Size;
+	SET_MEMORY_STAT(STAT_StreamlinePersistentTextureMemory, MemorySize);
+
+	return RDGTexture;
+}
+
+FRDGTextureRef FStreamlinePersistentResources::RegisterClearedTexture(FRDGBuilder& GraphBuilder, const TCHAR* Name, const FRDGTextureDesc& Desc)
+{
+	return RegisterTexture(GraphBuilder, Name, Desc, [](FRDGBuilder& InGraphBuilder, FRDGTextureRef Texture)
+	{
+		AddClearRenderTargetPass(InGraphBuilder, Texture);
+	});
+}
+
+void FStreamlinePersistentResources::ReleaseRHI()
+{
+	Textures.Empty();
+	MemorySize = 0;
+	SET_MEMORY_STAT(STAT_StreamlinePersistentTextureMemory, 0);
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommand CCmdStreamlinePersistentResourcesLog(
+	TEXT("r.Streamline.PersistentResources.Log"),
+	TEXT("Logs the persistent textures of the Streamline plugins and their memory footprint"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		ENQUEUE_RENDER_COMMAND(LogStreamlinePersistentResources)([](FRHICommandListImmediate& RHICmdList)
+		{
+			const FStreamlinePersistentResources& Resources = FStreamlinePersistentResources::Get();
+			UE_LOG(LogStreamlinePersistentResources, Log, TEXT("%d Streamline persistent textures, %llu bytes"), Resources.GetNumTextures(), Resources.GetMemorySize());
+		});
+	}));
+#endif
@@ -0,0 +1,43 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineAsyncCompute.h"
+#include "NVInputPassUtils.h"
+
+#include "Misc/AutomationTest.h"
+#include "RHIAccess.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Every pass r.Streamline.AsyncCompute.Passes can name, on the graphics and on the async compute pipe, feeding a pass declared like the
+// Streamline resource tagging pass. Runs with -nullrhi, so it can be part of headless automation runs
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineAsyncComputeGraphTest, "Plugins.Streamline.AsyncCompute.Graph",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineAsyncComputeGraphTest::RunTest(const FString& Parameters)
+{
+	TArray<const TCHAR*> PassNames;
+	for (int32 PassIndex = 0; PassIndex < int32(EStreamlineComputePass::Num); ++PassIndex)
+	{
+		PassNames.Add(GetStreamlineComputePassName(EStreamlineComputePass(PassIndex)));
+	}
+
+	const ERDGPassFlags TagFlags = ERDGPassFlags::Raster | ERDGPassFlags::Compute | ERDGPassFlags::Copy | ERDGPassFlags::NeverCull | ERDGPassFlags::NeverMerge | ERDGPassFlags::SkipRenderPass;
+	for (const bool bAsync : { false, true })
+	{
+		TestEqual(*FString::Printf(TEXT("RDG errors with the passes on the %s pipe"), bAsync ? TEXT("async compute") : TEXT("graphics")),
+			ValidateNVAsyncComputeGraph(PassNames, bAsync, ERHIAccess::CopySrc, TagFlags), 0);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
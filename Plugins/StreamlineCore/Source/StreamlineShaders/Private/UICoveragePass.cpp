@@ -0,0 +1,92 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "UICoveragePass.h"
+#include "StreamlineAsyncCompute.h"
+
+#include "Runtime/Launch/Resources/Version.h"
+#if (ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 2)
+#include "DataDrivenShaderPlatformInfo.h"
+#endif
+
+static const int32 kUICoverageComputeTileSizeX = FComputeShaderUtils::kGolden2DGroupSize;
+static const int32 kUICoverageComputeTileSizeY = FComputeShaderUtils::kGolden2DGroupSize;
+
+class FStreamlineUICoverageCS : public FGlobalShader
+{
+public:
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		// Only cook for the platforms/RHIs where DLSS-FG is supported, which is DX11,DX12 [on Win64]
+		return 	IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5) &&
+				IsPCPlatform(Parameters.Platform) && IsD3DPlatform(Parameters.Platform);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEX"), kUICoverageComputeTileSizeX);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEY"), kUICoverageComputeTileSizeY);
+	}
+	DECLARE_GLOBAL_SHADER(FStreamlineUICoverageCS);
+	SHADER_USE_PARAMETER_STRUCT(FStreamlineUICoverageCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER(float, AlphaThreshold)
+		SHADER_PARAMETER(FIntPoint, ViewRectMin)
+		SHADER_PARAMETER(FIntPoint, ViewRectMax)
+		// Input images
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, Backbuffer)
+
+		// Output buffers
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, OutUICoverage)
+	END_SHADER_PARAMETER_STRUCT()
+};
+
+IMPLEMENT_GLOBAL_SHADER(FStreamlineUICoverageCS, "/Plugin/StreamlineCore/Private/UICoverage.usf", "UICoverageMain", SF_Compute);
+
+FRDGBufferRef AddStreamlineUICoveragePass(
+	FRDGBuilder& GraphBuilder,
+	const float InAlphaThreshold,
+	const FTextureRHIRef& InBackBuffer,
+	const FIntRect& InViewRect
+)
+{
+	FRDGBufferRef UICoverageBuffer = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), UI_COVERAGE_NUM_COUNTERS),
+		TEXT("Streamline.UICoverage"));
+	FRDGBufferUAVRef UICoverageUAV = GraphBuilder.CreateUAV(UICoverageBuffer, PF_R32_UINT);
+
+	AddClearUAVPass(GraphBuilder, UICoverageUAV, 0u);
+
+	FStreamlineUICoverageCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FStreamlineUICoverageCS::FParameters>();
+	PassParameters->AlphaThreshold = FMath::Clamp(InAlphaThreshold, 0.0f, 1.0f);
+	PassParameters->ViewRectMin = InViewRect.Min;
+	PassParameters->ViewRectMax = InViewRect.Max;
+	PassParameters->Backbuffer = GraphBuilder.RegisterExternalTexture(CreateRenderTarget(InBackBuffer, TEXT("InBackBuffer")));
+	PassParameters->OutUICoverage = UICoverageUAV;
+
+	TShaderMapRef<FStreamlineUICoverageCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("Streamline UI Coverage (%dx%d) [%d,%d -> %d,%d]",
+			InViewRect.Width(), InViewRect.Height(),
+			InViewRect.Min.X, InViewRect.Min.Y,
+			InViewRect.Max.X, InViewRect.Max.Y
+		),
+		GetStreamlineComputePassFlags(EStreamlineComputePass::UICoverage),
+		ComputeShader,
+		PassParameters,
+		FComputeShaderUtils::GetGroupCount(InViewRect.Size(), FComputeShaderUtils::kGolden2DGroupSize));
+
+	return UICoverageBuffer;
+}
@@ -10,6 +10,7 @@
 */
 
 #include "UIHintExtractionPass.h"
+#include "StreamlineAsyncCompute.h"
 
 #include "Runtime/Launch/Resources/Version.h"
 #if (ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 2)
@@ -102,6 +103,7 @@ FRDGTextureRef AddStreamlineUIHintExtractionPass(
 			OutputViewRect.Min.X, OutputViewRect.Min.Y,
 			OutputViewRect.Max.X, OutputViewRect.Max.Y
 		),
+		GetStreamlineComputePassFlags(EStreamlineComputePass::UIHintExtraction),
 		ComputeShader,
 		PassParameters,
 		FComputeShaderUtils::GetGroupCount(OutputViewRect.Size(), FComputeShaderUtils::kGolden2DGroupSize));
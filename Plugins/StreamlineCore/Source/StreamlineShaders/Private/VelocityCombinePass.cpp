@@ -10,6 +10,7 @@
 */
 
 #include "VelocityCombinePass.h"
+#include "StreamlineAsyncCompute.h"
 
 #include "Runtime/Launch/Resources/Version.h"
 #if (ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 2)
@@ -163,6 +164,7 @@ FRDGTextureRef AddStreamlineVelocityCombinePass(
 			InputViewRect.Width(), InputViewRect.Height(),
 			OutputViewRect.Width(), OutputViewRect.Height()
 		),
+		GetStreamlineComputePassFlags(EStreamlineComputePass::VelocityCombine),
 		ComputeShader,
 		PassParameters,
 		FComputeShaderUtils::GetGroupCount(OutputViewRect.Size(), kVelocityCombineComputeTileSize));
@@ -0,0 +1,31 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderGraphDefinitions.h"
+
+// compute passes that r.Streamline.AsyncCompute.Passes can move to the async compute pipe
+enum class EStreamlineComputePass : uint8
+{
+	VelocityCombine,
+	UIHintExtraction,
+	UICoverage,
+	Num
+};
+
+// name of the pass in r.Streamline.AsyncCompute.Passes
+extern STREAMLINESHADERS_API const TCHAR* GetStreamlineComputePassName(EStreamlineComputePass Pass);
+
+// ERDGPassFlags::AsyncCompute if r.Streamline.AsyncCompute opts the pass in, ERDGPassFlags::Compute otherwise.
+// RDG adds the fences and transitions to the graphics pipe consumers, and runs the pass on the graphics pipe where async compute isn't available
+extern STREAMLINESHADERS_API ERDGPassFlags GetStreamlineComputePassFlags(EStreamlineComputePass Pass);
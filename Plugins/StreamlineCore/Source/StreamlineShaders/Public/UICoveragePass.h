@@ -0,0 +1,36 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RendererInterface.h"
+#include "ScreenPass.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+#if ENGINE_MAJOR_VERSION == 4  || ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION < 1
+#define FTextureRHIRef FTexture2DRHIRef
+#endif
+
+// layout of the buffer returned by AddStreamlineUICoveragePass, matches UICoverage.usf
+#define UI_COVERAGE_COVERED_PIXELS	0
+#define UI_COVERAGE_ALPHA_SUM		1
+#define UI_COVERAGE_NUM_COUNTERS	2
+// covered pixels add their alpha, quantized to 0..UI_COVERAGE_ALPHA_SCALE, to UI_COVERAGE_ALPHA_SUM
+#define UI_COVERAGE_ALPHA_SCALE		255.0f
+
+// Counts the pixels in InViewRect whose backbuffer alpha (i.e. UI) is above InAlphaThreshold and sums their alpha.
+// Returns a UI_COVERAGE_NUM_COUNTERS element uint32 buffer meant to be read back asynchronously
+extern STREAMLINESHADERS_API FRDGBufferRef AddStreamlineUICoveragePass(
+	FRDGBuilder& GraphBuilder,
+	const float InAlphaThreshold,
+	const FTextureRHIRef& InBackBuffer,
+	const FIntRect& InViewRect
+);
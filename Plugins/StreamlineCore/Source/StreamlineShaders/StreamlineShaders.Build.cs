@@ -48,7 +48,8 @@ public class StreamlineShaders : ModuleRules
 			{
 					"Engine",
 					"RHI",
-					"Projects"
+					"Projects",
+					"NVInputPassUtils",
 			}
 			);
 
@@ -17,6 +17,7 @@
 #include "StreamlineRHI.h"
 #include "StreamlineReflex.h"
 #include "StreamlineDLSSG.h"
+#include "StreamlineHibernation.h"
 #include "StreamlineAPI.h"
 
 #include "sl.h"
@@ -291,6 +292,114 @@ STREAMLINEDLSSGBLUEPRINT_API void UStreamlineLibraryDLSSG::GetDLSSGFrameTiming(f
 #endif
 }
 
+FStreamlineDLSSGRenderedFramePacingReport UStreamlineLibraryDLSSG::GetDLSSGRenderedFramePacingReport(bool bIncludeHistogram)
+{
+	FStreamlineDLSSGRenderedFramePacingReport Report;
+
+	TRY_INIT_STREAMLINE_DLSSG_LIBRARY_AND_RETURN(Report);
+
+#if WITH_STREAMLINE
+	FStreamlineDLSSGPacingStats Stats;
+	GetStreamlineDLSSGPacingStats(Stats, bIncludeHistogram);
+
+	Report.NumRenderedFrames = Stats.NumRenderedFrames;
+	Report.NumPresentedFrames = Stats.NumPresentedFrames;
+	Report.GeneratedToPresentedRatio = Stats.GeneratedToPresentedRatio;
+	Report.AverageFrameIntervalMs = Stats.AverageFrameIntervalMs;
+	Report.FrameIntervalVarianceMs2 = Stats.FrameIntervalVarianceMs2;
+	Report.FrameIntervalStdDevMs = Stats.FrameIntervalStdDevMs;
+	Report.MaxFrameIntervalMs = Stats.MaxFrameIntervalMs;
+	Report.AverageRenderedFPS = Stats.AverageRenderedFPS;
+	Report.OnePercentLowRenderedFPS = Stats.OnePercentLowRenderedFPS;
+	Report.PointOnePercentLowRenderedFPS = Stats.PointOnePercentLowRenderedFPS;
+	Report.HistogramBucketWidthMs = Stats.HistogramBucketWidthMs;
+	Report.FrameIntervalHistogram = MoveTemp(Stats.FrameIntervalHistogram);
+#endif
+	return Report;
+}
+
+void UStreamlineLibraryDLSSG::ResetDLSSGPacingReport()
+{
+	TRY_INIT_STREAMLINE_DLSSG_LIBRARY_AND_RETURN(void());
+
+#if WITH_STREAMLINE
+	ResetStreamlineDLSSGPacingStats();
+#endif
+}
+
+FString UStreamlineLibraryDLSSG::DumpDLSSGPacingToCSV(const FString& FileName)
+{
+	TRY_INIT_STREAMLINE_DLSSG_LIBRARY_AND_RETURN(FString());
+
+#if WITH_STREAMLINE
+	return DumpStreamlineDLSSGPacingToCSV(FileName);
+#else
+	return FString();
+#endif
+}
+
+void UStreamlineLibraryDLSSG::SetDLSSGHibernationPolicy(const FStreamlineResourceHibernationPolicy& Policy)
+{
+	TRY_INIT_STREAMLINE_DLSSG_LIBRARY_AND_RETURN(void());
+
+#if WITH_STREAMLINE
+	FStreamlineHibernationSettings Settings;
+	Settings.GracePeriodSeconds = Policy.GracePeriodSeconds;
+	Settings.bReleaseOnMemoryPressure = Policy.bReleaseOnMemoryPressure;
+	SetStreamlineHibernationSettings(EStreamlineHibernationFeature::DLSSG, Settings);
+#endif
+}
+
+void UStreamlineLibraryDLSSG::ResetDLSSGHibernationPolicy()
+{
+	TRY_INIT_STREAMLINE_DLSSG_LIBRARY_AND_RETURN(void());
+
+#if WITH_STREAMLINE
+	ResetStreamlineHibernationSettings(EStreamlineHibernationFeature::DLSSG);
+#endif
+}
+
+FStreamlineResourceHibernationPolicy UStreamlineLibraryDLSSG::GetDLSSGHibernationPolicy()
+{
+	FStreamlineResourceHibernationPolicy Policy;
+
+	TRY_INIT_STREAMLINE_DLSSG_LIBRARY_AND_RETURN(Policy);
+
+#if WITH_STREAMLINE
+	const FStreamlineHibernationSettings Settings = GetStreamlineHibernationSettings(EStreamlineHibernationFeature::DLSSG);
+	Policy.GracePeriodSeconds = Settings.GracePeriodSeconds;
+	Policy.bReleaseOnMemoryPressure = Settings.bReleaseOnMemoryPressure;
+#endif
+	return Policy;
+}
+
+FStreamlineResourceHibernationStats UStreamlineLibraryDLSSG::GetDLSSGHibernationStats()
+{
+	FStreamlineResourceHibernationStats Stats;
+
+	TRY_INIT_STREAMLINE_DLSSG_LIBRARY_AND_RETURN(Stats);
+
+#if WITH_STREAMLINE
+	const FStreamlineHibernationStats HibernationStats = GetStreamlineHibernationStats(EStreamlineHibernationFeature::DLSSG);
+	Stats.HitchesAvoided = HibernationStats.HitchesAvoided;
+	Stats.Reallocations = HibernationStats.Reallocations;
+	Stats.GracePeriodReleases = HibernationStats.GracePeriodReleases;
+	Stats.MemoryPressureReleases = HibernationStats.MemoryPressureReleases;
+	Stats.Prewarms = HibernationStats.Prewarms;
+	Stats.NumHibernatingViews = HibernationStats.NumHibernatingViews;
+#endif
+	return Stats;
+}
+
+void UStreamlineLibraryDLSSG::PrewarmDLSSGResources()
+{
+	TRY_INIT_STREAMLINE_DLSSG_LIBRARY_AND_RETURN(void());
+
+#if WITH_STREAMLINE
+	PrewarmStreamlineHibernatingFeature(EStreamlineHibernationFeature::DLSSG);
+#endif
+}
+
 EStreamlineDLSSGMode UStreamlineLibraryDLSSG::GetDLSSGMode()
 {
 
@@ -40,6 +40,43 @@ enum class EStreamlineDLSSGMode : uint8
 	On4X = 31  UMETA(DisplayName = "4X"),
 };
 
+USTRUCT(BlueprintType)
+struct FStreamlineDLSSGRenderedFramePacingReport
+{
+	GENERATED_BODY()
+public:
+
+	/** Number of rendered frames the report covers. The pacing of the generated frames in between isn't reported by Streamline, so it isn't covered */
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline|DLSS-FG")
+	int32 NumRenderedFrames = 0;
+	/** Rendered and generated frames presented over the rendered frames of the report */
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline|DLSS-FG")
+	int32 NumPresentedFrames = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline|DLSS-FG")
+	float GeneratedToPresentedRatio = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline|DLSS-FG")
+	float AverageFrameIntervalMs = 0.0f;
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline|DLSS-FG")
+	float FrameIntervalVarianceMs2 = 0.0f;
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline|DLSS-FG")
+	float FrameIntervalStdDevMs = 0.0f;
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline|DLSS-FG")
+	float MaxFrameIntervalMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline|DLSS-FG")
+	float AverageRenderedFPS = 0.0f;
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline|DLSS-FG")
+	float OnePercentLowRenderedFPS = 0.0f;
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline|DLSS-FG")
+	float PointOnePercentLowRenderedFPS = 0.0f;
+
+	/** Bucket i counts rendered frame intervals in [i * HistogramBucketWidthMs, (i + 1) * HistogramBucketWidthMs), the last bucket also everything above */
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline|DLSS-FG")
+	float HistogramBucketWidthMs = 0.0f;
+	UPROPERTY(BlueprintReadOnly, Category = "Streamline|DLSS-FG")
+	TArray<int32> FrameIntervalHistogram;
+};
 
 UCLASS(MinimalAPI)
 class  UStreamlineLibraryDLSSG : public UBlueprintFunctionLibrary
@@ -87,6 +124,36 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Streamline|DLSS-FG", meta = (DisplayName = "Get DLSS-FG  frame rate and presented frames"))
 	static STREAMLINEDLSSGBLUEPRINT_API void GetDLSSGFrameTiming(float& FrameRateInHertz, int32& FramesPresented);
 
+	/* Returns the pacing of the recent rendered frames: frame interval histogram, variance, 1% and 0.1% lows, and the share of generated frames. See r.Streamline.DLSSG.Pacing.HistorySize */
+	UFUNCTION(BlueprintPure, Category = "Streamline|DLSS-FG", meta = (DisplayName = "Get DLSS-FG Rendered Frame Pacing Report"))
+	static STREAMLINEDLSSGBLUEPRINT_API FStreamlineDLSSGRenderedFramePacingReport GetDLSSGRenderedFramePacingReport(bool bIncludeHistogram = true);
+
+	/* Clears the rendered frames recorded for the pacing report, e.g. at the start of a benchmark section */
+	UFUNCTION(BlueprintCallable, Category = "Streamline|DLSS-FG", meta = (DisplayName = "Reset DLSS-FG Pacing Report"))
+	static STREAMLINEDLSSGBLUEPRINT_API void ResetDLSSGPacingReport();
+
+	/* Writes the rendered frames recorded for the pacing report to a CSV file. An empty file name picks one in the profiling directory. Returns the file name written, empty on failure */
+	UFUNCTION(BlueprintCallable, Category = "Streamline|DLSS-FG", meta = (DisplayName = "Dump DLSS-FG Pacing To CSV"))
+	static STREAMLINEDLSSGBLUEPRINT_API FString DumpDLSSGPacingToCSV(const FString& FileName);
+
+	/* Sets how long DLSS-FG keeps its resources after getting turned off, so turning it back on doesn't cause a reallocation hitch. Overrides the r.Streamline.Hibernation.* console variables */
+	UFUNCTION(BlueprintCallable, Category = "Streamline|DLSS-FG", meta = (DisplayName = "Set DLSS-FG Hibernation Policy"))
+	static STREAMLINEDLSSGBLUEPRINT_API void SetDLSSGHibernationPolicy(const FStreamlineResourceHibernationPolicy& Policy);
+
+	/* Goes back to the r.Streamline.Hibernation.* console variables */
+	UFUNCTION(BlueprintCallable, Category = "Streamline|DLSS-FG", meta = (DisplayName = "Reset DLSS-FG Hibernation Policy"))
+	static STREAMLINEDLSSGBLUEPRINT_API void ResetDLSSGHibernationPolicy();
+
+	UFUNCTION(BlueprintPure, Category = "Streamline|DLSS-FG", meta = (DisplayName = "Get DLSS-FG Hibernation Policy"))
+	static STREAMLINEDLSSGBLUEPRINT_API FStreamlineResourceHibernationPolicy GetDLSSGHibernationPolicy();
+
+	UFUNCTION(BlueprintPure, Category = "Streamline|DLSS-FG", meta = (DisplayName = "Get DLSS-FG Hibernation Stats"))
+	static STREAMLINEDLSSGBLUEPRINT_API FStreamlineResourceHibernationStats GetDLSSGHibernationStats();
+
+	/* Allocates released DLSS-FG resources ahead of turning it back on, e.g. from a level sequence event a few seconds before the cut that enables it */
+	UFUNCTION(BlueprintCallable, Category = "Streamline|DLSS-FG", meta = (DisplayName = "Prewarm DLSS-FG Resources"))
+	static STREAMLINEDLSSGBLUEPRINT_API void PrewarmDLSSGResources();
+
 	static void Startup();
 	static void Shutdown();
 private:
@@ -16,6 +16,7 @@
 #include "StreamlineCore.h"
 #include "StreamlineRHI.h"
 #include "StreamlineDeepDVC.h"
+#include "StreamlineHibernation.h"
 #include "StreamlineAPI.h"
 #include "sl.h"
 #include "sl_deepdvc.h"
@@ -289,6 +290,68 @@ STREAMLINEDEEPDVCBLUEPRINT_API float UStreamlineLibraryDeepDVC::GetDeepDVCSatura
 	return  0.0f;
 }
 
+void UStreamlineLibraryDeepDVC::SetDeepDVCHibernationPolicy(const FStreamlineResourceHibernationPolicy& Policy)
+{
+	TRY_INIT_STREAMLINE_DEEPDVC_LIBRARY_AND_RETURN(void());
+
+#if WITH_STREAMLINE
+	FStreamlineHibernationSettings Settings;
+	Settings.GracePeriodSeconds = Policy.GracePeriodSeconds;
+	Settings.bReleaseOnMemoryPressure = Policy.bReleaseOnMemoryPressure;
+	SetStreamlineHibernationSettings(EStreamlineHibernationFeature::DeepDVC, Settings);
+#endif
+}
+
+void UStreamlineLibraryDeepDVC::ResetDeepDVCHibernationPolicy()
+{
+	TRY_INIT_STREAMLINE_DEEPDVC_LIBRARY_AND_RETURN(void());
+
+#if WITH_STREAMLINE
+	ResetStreamlineHibernationSettings(EStreamlineHibernationFeature::DeepDVC);
+#endif
+}
+
+FStreamlineResourceHibernationPolicy UStreamlineLibraryDeepDVC::GetDeepDVCHibernationPolicy()
+{
+	FStreamlineResourceHibernationPolicy Policy;
+
+	TRY_INIT_STREAMLINE_DEEPDVC_LIBRARY_AND_RETURN(Policy);
+
+#if WITH_STREAMLINE
+	const FStreamlineHibernationSettings Settings = GetStreamlineHibernationSettings(EStreamlineHibernationFeature::DeepDVC);
+	Policy.GracePeriodSeconds = Settings.GracePeriodSeconds;
+	Policy.bReleaseOnMemoryPressure = Settings.bReleaseOnMemoryPressure;
+#endif
+	return Policy;
+}
+
+FStreamlineResourceHibernationStats UStreamlineLibraryDeepDVC::GetDeepDVCHibernationStats()
+{
+	FStreamlineResourceHibernationStats Stats;
+
+	TRY_INIT_STREAMLINE_DEEPDVC_LIBRARY_AND_RETURN(Stats);
+
+#if WITH_STREAMLINE
+	const FStreamlineHibernationStats HibernationStats = GetStreamlineHibernationStats(EStreamlineHibernationFeature::DeepDVC);
+	Stats.HitchesAvoided = HibernationStats.HitchesAvoided;
+	Stats.Reallocations = HibernationStats.Reallocations;
+	Stats.GracePeriodReleases = HibernationStats.GracePeriodReleases;
+	Stats.MemoryPressureReleases = HibernationStats.MemoryPressureReleases;
+	Stats.Prewarms = HibernationStats.Prewarms;
+	Stats.NumHibernatingViews = HibernationStats.NumHibernatingViews;
+#endif
+	return Stats;
+}
+
+void UStreamlineLibraryDeepDVC::PrewarmDeepDVCResources()
+{
+	TRY_INIT_STREAMLINE_DEEPDVC_LIBRARY_AND_RETURN(void());
+
+#if WITH_STREAMLINE
+	PrewarmStreamlineHibernatingFeature(EStreamlineHibernationFeature::DeepDVC);
+#endif
+}
+
 #if WITH_STREAMLINE
 
 // Delayed initialization, which allows this module to be available early so blueprints can be loaded before DLSS is available in PostEngineInit
@@ -93,6 +93,24 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Streamline|DeepDVC", meta = (DisplayName = "Get DeepDVC Saturation Boost"))
 	static STREAMLINEDEEPDVCBLUEPRINT_API float GetDeepDVCSaturationBoost();
 
+	/* Sets how long DeepDVC keeps its resources after getting turned off, so turning it back on doesn't cause a reallocation hitch. Overrides the r.Streamline.Hibernation.* console variables */
+	UFUNCTION(BlueprintCallable, Category = "Streamline|DeepDVC", meta = (DisplayName = "Set DeepDVC Hibernation Policy"))
+	static STREAMLINEDEEPDVCBLUEPRINT_API void SetDeepDVCHibernationPolicy(const FStreamlineResourceHibernationPolicy& Policy);
+
+	/* Goes back to the r.Streamline.Hibernation.* console variables */
+	UFUNCTION(BlueprintCallable, Category = "Streamline|DeepDVC", meta = (DisplayName = "Reset DeepDVC Hibernation Policy"))
+	static STREAMLINEDEEPDVCBLUEPRINT_API void ResetDeepDVCHibernationPolicy();
+
+	UFUNCTION(BlueprintPure, Category = "Streamline|DeepDVC", meta = (DisplayName = "Get DeepDVC Hibernation Policy"))
+	static STREAMLINEDEEPDVCBLUEPRINT_API FStreamlineResourceHibernationPolicy GetDeepDVCHibernationPolicy();
+
+	UFUNCTION(BlueprintPure, Category = "Streamline|DeepDVC", meta = (DisplayName = "Get DeepDVC Hibernation Stats"))
+	static STREAMLINEDEEPDVCBLUEPRINT_API FStreamlineResourceHibernationStats GetDeepDVCHibernationStats();
+
+	/* Allocates released DeepDVC resources ahead of turning it back on, e.g. from a level sequence event a few seconds before the cut that enables it */
+	UFUNCTION(BlueprintCallable, Category = "Streamline|DeepDVC", meta = (DisplayName = "Prewarm DeepDVC Resources"))
+	static STREAMLINEDEEPDVCBLUEPRINT_API void PrewarmDeepDVCResources();
+
 
 
 